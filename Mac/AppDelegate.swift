@@ -8,6 +8,7 @@
 
 import AppKit
 import UserNotifications
+import UniformTypeIdentifiers
 import os
 import Articles
 import Account
@@ -355,6 +356,7 @@ let appName = "NetNewsWire"
 	func applicationWillTerminate(_ notification: Notification) {
 		shuttingDown = true
 		saveState()
+		AccountManager.shared.saveAll()
 
 		ArticleThemeDownloader.shared.cleanUp()
 
@@ -512,6 +514,10 @@ let appName = "NetNewsWire"
 			(item as! NSMenuItem).state = AppDefaults.shared.webInspectorEnabled ? .on : .off
 		}
 
+		if item.action == #selector(debugToggleDatabaseProfiling(_:)) {
+			(item as! NSMenuItem).state = AccountManager.shared.isProfilingDatabaseQueries ? .on : .off
+		}
+
 		return true
 	}
 
@@ -782,6 +788,24 @@ extension AppDelegate {
 		AccountManager.shared.defaultAccount.debugRunSearch()
 	}
 
+	@IBAction func debugToggleDatabaseProfiling(_ sender: Any?) {
+		AccountManager.shared.isProfilingDatabaseQueries.toggle()
+	}
+
+	@IBAction func debugExportDatabaseProfile(_ sender: Any?) {
+		let panel = NSSavePanel()
+		panel.allowedContentTypes = [UTType.json]
+		panel.nameFieldStringValue = "DatabaseProfile.json"
+		guard panel.runModal() == .OK, let url = panel.url else {
+			return
+		}
+		do {
+			try AccountManager.shared.databaseProfileJSON().write(to: url)
+		} catch {
+			NSApplication.shared.presentError(error)
+		}
+	}
+
 	@IBAction func debugDropConditionalGetInfo(_ sender: Any?) {
 #if DEBUG
 		for account in AccountManager.shared.activeAccounts {
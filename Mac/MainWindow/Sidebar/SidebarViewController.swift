@@ -59,6 +59,10 @@ extension Notification.Name {
     var undoableCommands = [UndoableCommand]()
 	private var animatingChanges = false
 
+	/// True when the outline view’s rows may not match the tree — before the
+	/// first load, or after rows were removed ahead of the model.
+	private var outlineViewNeedsReload = true
+
 	var renameWindowController: RenameWindowController?
 
 	var selectedObjects: [AnyObject] {
@@ -77,6 +81,7 @@ extension Notification.Name {
 
 		NotificationCenter.default.addObserver(self, selector: #selector(unreadCountDidInitialize(_:)), name: .UnreadCountDidInitialize, object: nil)
 		NotificationCenter.default.addObserver(self, selector: #selector(unreadCountDidChange(_:)), name: .UnreadCountDidChange, object: nil)
+		NotificationCenter.default.addObserver(self, selector: #selector(unreadCountsDidChange(_:)), name: .UnreadCountsDidChange, object: nil)
 		NotificationCenter.default.addObserver(self, selector: #selector(containerChildrenDidChange(_:)), name: .ChildrenDidChange, object: nil)
 		NotificationCenter.default.addObserver(self, selector: #selector(accountsDidChange(_:)), name: .UserDidAddAccount, object: nil)
 		NotificationCenter.default.addObserver(self, selector: #selector(accountsDidChange(_:)), name: .UserDidDeleteAccount, object: nil)
@@ -90,6 +95,7 @@ extension Notification.Name {
 		DistributedNotificationCenter.default().addObserver(self, selector: #selector(appleSideBarDefaultIconSizeChanged(_:)), name: .appleSideBarDefaultIconSizeChanged, object: nil)
 
 		outlineView.reloadData()
+		outlineViewNeedsReload = false
 
 		// Expand top level items by default.  If there is state to restore, overlay this.
 		for topLevelNode in treeController.rootNode.childNodes {
@@ -210,8 +216,31 @@ extension Notification.Name {
 		}
 	}
 
+	@objc func unreadCountsDidChange(_ note: Notification) {
+		// Feeds report unread count changes only in the change set.
+		// Folders and accounts also post UnreadCountDidChange, handled above.
+		guard let changeSet = note.userInfo?[UnreadCountChangeSet.userInfoKey] as? UnreadCountChangeSet, !changeSet.feedDeltas.isEmpty else {
+			return
+		}
+		let feeds = changeSet.feeds
+		applyToAvailableCells { cell, node in
+			if let feed = node.representedObject as? Feed, feeds.contains(feed) {
+				configureUnreadCount(cell, node)
+			}
+		}
+
+		if AccountManager.shared.areUnreadCountsInitialized && isReadFiltered {
+			queueRebuildTreeAndRestoreSelection()
+		}
+	}
+
 	@objc func containerChildrenDidChange(_ note: Notification) {
-		rebuildTreeAndRestoreSelection()
+		guard let container = note.object as? Container else {
+			rebuildTreeAndRestoreSelection()
+			return
+		}
+		treeController.markDirty(container as AnyObject)
+		rebuildTreeAndRestoreSelection(dirtyNodesOnly: true)
 	}
 
 	@objc func accountsDidChange(_ notification: Notification) {
@@ -480,6 +509,7 @@ extension Notification.Name {
 		}
 
 		animatingChanges = true
+		outlineViewNeedsReload = true
 		outlineView.beginUpdates()
 
 		let indexSetsGroupedByParent = Node.indexSetsGroupedByParent(nodesToDelete)
@@ -603,7 +633,7 @@ private extension SidebarViewController {
 	}
 
 	func addParentFolderToFilterExceptions(_ sidebarItem: SidebarItem) {
-		guard let node = treeController.rootNode.descendantNodeRepresentingObject(sidebarItem as AnyObject),
+		guard let node = treeController.nodeInTreeRepresentingObject(sidebarItem as AnyObject),
 			let folder = node.parent?.representedObject as? Folder,
 			let folderSidebarItemID = folder.sidebarItemID else {
 				return
@@ -617,10 +647,14 @@ private extension SidebarViewController {
 	}
 
 	@objc func rebuildTreeAndRestoreSelection() {
+		rebuildTreeAndRestoreSelection(dirtyNodesOnly: false)
+	}
+
+	func rebuildTreeAndRestoreSelection(dirtyNodesOnly: Bool) {
 		let savedAccounts = accountNodes
 		let savedSelection = selectedNodes
 
-		rebuildTreeAndReloadDataIfNeeded()
+		rebuildTreeAndReloadDataIfNeeded(dirtyNodesOnly: dirtyNodesOnly)
 		restoreSelection(to: savedSelection, sendNotificationIfChanged: true)
 
 		// Automatically expand any new or newly active accounts
@@ -632,12 +666,19 @@ private extension SidebarViewController {
 		}
 	}
 
-	func rebuildTreeAndReloadDataIfNeeded() {
+	/// Updates the changed rows in place — or reloads, if the outline view may be out of sync.
+	/// With `dirtyNodesOnly`, only containers marked dirty in the tree controller are rebuilt.
+	func rebuildTreeAndReloadDataIfNeeded(dirtyNodesOnly: Bool = false) {
 		if !animatingChanges && !BatchUpdate.shared.isPerforming {
 			addAllSelectedToFilterExceptions()
-			treeController.rebuild()
+			let changes = dirtyNodesOnly ? treeController.rebuildDirtyNodes() : treeController.rebuildReportingChanges()
 			treeControllerDelegate.resetFilterExceptions()
-			outlineView.reloadData()
+			if outlineViewNeedsReload {
+				outlineView.reloadData()
+				outlineViewNeedsReload = false
+			} else {
+				outlineView.apply(changes, rootNode: treeController.rootNode)
+			}
 			expandNodes()
 			prefetchFeedIcons()
 		}
@@ -149,6 +149,13 @@ final class TimelineViewController: NSViewController, UndoableCommandRunner, Unr
 			articleRowMap = [String: [Int]]()
 			tableView.reloadData()
 			IconImageCache.shared.prefetchImagesForArticles(articles)
+
+			if !articles.isEmpty {
+				// After this run loop turn, when the rows have been drawn.
+				DispatchQueue.main.async {
+					AccountManager.shared.runDeferredStartupWork()
+				}
+			}
 		}
 	}
 
@@ -164,6 +171,9 @@ final class TimelineViewController: NSViewController, UndoableCommandRunner, Unr
 
 	private var fetchSerialNumber = 0
 	private let fetchRequestQueue = FetchRequestQueue()
+	private var timelinePager: TimelinePager? // Set while pages are still loading
+	private static let firstPageSize = 100 // More than fit in a tall window
+	private static let maximumPageSize = 5000
 	private var exceptionArticleFetcher: ArticleFetcher?
 	private var articleRowMap = [String: [Int]]() // articleID: rowIndex
 	private var cellAppearance: TimelineCellAppearance!
@@ -269,6 +279,7 @@ final class TimelineViewController: NSViewController, UndoableCommandRunner, Unr
 	// MARK: - API
 
 	func markAllAsRead(completion: (() -> Void)? = nil) {
+		finishLoadingPagesIfNeeded()
 		guard let undoManager = undoManager, let markReadCommand = MarkStatusCommand(initialArticles: articles, markingRead: true, undoManager: undoManager, completion: completion) else {
 			return
 		}
@@ -276,7 +287,7 @@ final class TimelineViewController: NSViewController, UndoableCommandRunner, Unr
 	}
 
 	func canMarkAllAsRead() -> Bool {
-		return articles.canMarkAllAsRead()
+		return articles.canMarkAllAsRead() || timelinePager != nil
 	}
 
 	func canMarkSelectedArticlesAsRead() -> Bool {
@@ -640,7 +651,15 @@ final class TimelineViewController: NSViewController, UndoableCommandRunner, Unr
 	}
 
 	func indexOfNextUnreadArticle(wrappingToTop wrapping: Bool = false) -> Int? {
-		return articles.rowOfNextUnreadArticle(tableView.selectedRow, wrappingToTop: wrapping)
+		if let row = articles.rowOfNextUnreadArticle(tableView.selectedRow, wrappingToTop: wrapping) {
+			return row
+		}
+		if timelinePager != nil {
+			// The next unread article may be in a page that hasn’t loaded yet.
+			finishLoadingPagesIfNeeded()
+			return articles.rowOfNextUnreadArticle(tableView.selectedRow, wrappingToTop: wrapping)
+		}
+		return nil
 	}
 
 	func focus() {
@@ -1123,6 +1142,7 @@ private extension TimelineViewController {
 	}
 
 	func sortParametersDidChange() {
+		finishLoadingPagesIfNeeded()
 		performBlockAndRestoreSelection {
 			let unsortedArticles = Set(articles)
 			replaceArticles(with: unsortedArticles)
@@ -1220,10 +1240,63 @@ private extension TimelineViewController {
 			exceptionArticleFetcher = nil
 		}
 
+		if let timelinePager = makeTimelinePager(for: representedObjects) {
+			replaceArticlesPageByPage(timelinePager)
+			return
+		}
+
 		let fetchedArticles = fetchUnsortedArticlesSync(for: representedObjects)
 		replaceArticles(with: fetchedArticles)
 	}
 
+	/// Nil when the timeline can’t be paged — see `TimelinePager` —
+	/// or when articles are grouped by feed, which needs them all to sort.
+	func makeTimelinePager(for representedObjects: [AnyObject]) -> TimelinePager? {
+		guard !groupByFeed, representedObjects.count == 1, let fetcher = representedObjects.first as? ArticleFetcher else {
+			return nil
+		}
+		let unreadOnly = (fetcher as? SidebarItem)?.readFiltered(readFilterEnabledTable: readFilterEnabledTable) ?? true
+		return TimelinePager(fetcher: fetcher, unreadOnly: unreadOnly, sortDirection: sortDirection)
+	}
+
+	/// Shows the first page right away, so time to first row doesn’t depend on
+	/// how many articles there are. The rest load in the background, in pages
+	/// that grow each time, and are appended as they arrive.
+	func replaceArticlesPageByPage(_ pager: TimelinePager) {
+		articles = pager.nextPage(limit: Self.firstPageSize)
+		guard !pager.isFinished else {
+			return
+		}
+
+		timelinePager = pager
+		Task { @MainActor in
+			var pageSize = Self.firstPageSize
+			while !pager.isFinished {
+				pageSize = min(pageSize * 4, Self.maximumPageSize)
+				let page = await pager.nextPageAsync(limit: pageSize)
+				guard pager === timelinePager else {
+					return // Superseded by another fetch
+				}
+				articles += page
+			}
+			timelinePager = nil
+		}
+	}
+
+	/// For changes that need every article, such as re-sorting or marking all as read.
+	func finishLoadingPagesIfNeeded() {
+		guard let pager = timelinePager else {
+			return
+		}
+		timelinePager = nil
+
+		var remainingArticles = [Article]()
+		while !pager.isFinished {
+			remainingArticles += pager.nextPage(limit: Self.maximumPageSize)
+		}
+		articles += remainingArticles
+	}
+
 	func fetchAndReplaceArticlesAsync(completion: (() -> Void)? = nil) {
 		// To be called when we need to do an entire fetch, but an async delay is okay.
 		// Example: we have the Today feed selected, and the calendar day just changed.
@@ -1247,6 +1320,7 @@ private extension TimelineViewController {
 	func cancelPendingAsyncFetches() {
 		fetchSerialNumber += 1
 		fetchRequestQueue.cancelAllRequests()
+		timelinePager = nil
 	}
 
 	func replaceArticles(with unsortedArticles: Set<Article>) {
@@ -23,7 +23,8 @@ let package = Package(
 		.package(path: "../RSParser"),
 		.package(path: "../RSCore"),
 		.package(path: "../RSDatabase"),
-		.package(path: "../NewsBlur")
+		.package(path: "../NewsBlur"),
+		.package(path: "../RefreshBenchmark")
 	],
 	targets: [
 		.target(
@@ -50,9 +51,13 @@ let package = Package(
 		),
 		.testTarget(
 			name: "AccountTests",
-			dependencies: ["Account"],
+			dependencies: [
+				"Account",
+				.product(name: "RefreshBenchmark", package: "RefreshBenchmark")
+			],
 			resources: [
-				.copy("JSON")
+				.copy("JSON"),
+				.copy("OPML")
 			],
 			swiftSettings: [.swiftLanguageMode(.v6)]
 		)
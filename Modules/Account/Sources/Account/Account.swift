@@ -78,7 +78,7 @@ nonisolated public enum AccountType: Int, Codable, Sendable {
 	}
 }
 
-public enum FetchType {
+public enum FetchType: Sendable {
     case starred(_: Int? = nil)
 	case unread(_: Int? = nil)
 	case today(_: Int? = nil)
@@ -239,6 +239,7 @@ public enum FetchType {
 
 	private var fetchingAllUnreadCounts = false
 	var areUnreadCountsInitialized = false
+	private var didRunDeferredStartupWork = false
 
 	public let dataFolder: String
 	let database: ArticlesDatabase
@@ -262,6 +263,7 @@ public enum FetchType {
         didSet {
             if unreadCount != oldValue {
                 postUnreadCountDidChangeNotification()
+                UnreadCountAggregator.shared.accountUnreadCountDidChange(self)
             }
         }
     }
@@ -320,17 +322,19 @@ public enum FetchType {
 
 		let databaseFilePath = (dataFolder as NSString).appendingPathComponent("DB.sqlite3")
 		let retentionStyle: ArticlesDatabase.RetentionStyle = (type == .onMyMac || type == .cloudKit) ? .feedBased : .syncSystem
-		self.database = ArticlesDatabase(databaseFilePath: databaseFilePath, accountID: accountID, retentionStyle: retentionStyle)
-
-		defaultName = type.displayName
-
 		let feedSettingsDatabasePath = (dataFolder as NSString).appendingPathComponent("FeedSettings.db")
+
+		let openDatabasesInterval = StartupProfiler.shared.begin(.openDatabases)
+		let compressesBodies = UserDefaults.standard.bool(forKey: AccountManager.compressArticleBodiesKey)
+		self.database = ArticlesDatabase(databaseFilePath: databaseFilePath, accountID: accountID, retentionStyle: retentionStyle, compressesBodies: compressesBodies)
 		self.feedSettingsDatabase = FeedSettingsDatabase(databasePath: feedSettingsDatabasePath)
+		StartupProfiler.shared.end(openDatabasesInterval)
+
+		defaultName = type.displayName
 
 		self.settings = AccountSettings(accountID: accountID, dataFolder: dataFolder)
 
 		NotificationCenter.default.addObserver(self, selector: #selector(progressInfoDidChange(_:)), name: .progressInfoDidChange, object: delegate)
-		NotificationCenter.default.addObserver(self, selector: #selector(unreadCountDidChange(_:)), name: .UnreadCountDidChange, object: nil)
         NotificationCenter.default.addObserver(self, selector: #selector(batchUpdateDidPerform(_:)), name: .BatchUpdateDidPerform, object: nil)
 		NotificationCenter.default.addObserver(self, selector: #selector(displayNameDidChange(_:)), name: .DisplayNameDidChange, object: nil)
 		NotificationCenter.default.addObserver(self, selector: #selector(childrenDidChange(_:)), name: .ChildrenDidChange, object: nil)
@@ -340,11 +344,12 @@ public enum FetchType {
 		FeedSettingsImporter.importIfNeeded(dataFolder: dataFolder, database: feedSettingsDatabase)
 		populateFeedSettingsCache()
 
-		opmlFile.load()
-		feedSettingsDatabase.deleteSettingsForFeedsNotIn(flattenedFeedURLs)
+		StartupProfiler.shared.measure(.loadSubscriptions) {
+			opmlFile.load()
+		}
 
+		// Cleanup and other housekeeping wait for runDeferredStartupWork.
 		DispatchQueue.main.async {
-			self.database.cleanupDatabaseAtStartup(subscribedToFeedIDs: self.flattenedFeedsIDs)
 			self._fetchAllUnreadCounts()
 		}
 
@@ -548,12 +553,46 @@ public enum FetchType {
 		_fetchAllUnreadCounts()
 	}
 
+	// MARK: - Startup
+
+	/// Run the startup work that can wait until the UI is up:
+	/// pruning orphaned feed settings, database cleanup, and other
+	/// database housekeeping. Does nothing after the first call.
+	func runDeferredStartupWork() {
+		guard !didRunDeferredStartupWork else {
+			return
+		}
+		didRunDeferredStartupWork = true
+
+		let profiler = StartupProfiler.shared
+		profiler.measure(.pruneFeedSettings) {
+			feedSettingsDatabase.deleteSettingsForFeedsNotIn(flattenedFeedURLs)
+		}
+		profiler.measure(.cleanupDatabase) {
+			database.cleanupDatabaseAtStartup(subscribedToFeedIDs: flattenedFeedsIDs)
+		}
+		profiler.measure(.databaseHousekeeping) {
+			database.runDeferredStartupWork()
+		}
+	}
+
 	// MARK: - Data
 
 	public func save() {
 		MainActor.assumeIsolated {
 			opmlFile.save()
 		}
+		feedSettingsDatabase.writePendingChanges()
+	}
+
+	/// Write feed settings changes that are waiting to be written together.
+	func writePendingFeedSettings() {
+		feedSettingsDatabase.writePendingChanges()
+	}
+
+	/// Transactions committed by the feed settings database since launch.
+	var feedSettingsCommitCount: Int {
+		feedSettingsDatabase.commitCount
 	}
 
 	public func prepareForDeletion() {
@@ -564,23 +603,36 @@ public enum FetchType {
 		settings.deleteSettings()
 	}
 
+	/// Add feeds as a batch: their settings are written in one transaction,
+	/// and each container gets one children-did-change notification —
+	/// not one per feed. OPML files can have thousands of feeds.
 	func addOPMLItems(_ items: [OPMLItem], isManualImport: Bool) {
-		for item in items {
-			if let feedSpecifier = item.feedSpecifier {
-				addFeedToTreeAtTopLevel(newFeed(with: feedSpecifier, isManualImport: isManualImport))
-			} else {
-				if let title = item.titleFromAttributes, let folder = ensureFolder(with: title) {
-					folder.externalID = item.attributes?["nnw_externalID"]
-					if let itemChildren = item.children {
-						for itemChild in itemChildren {
-							if let feedSpecifier = itemChild.feedSpecifier {
-								folder.addFeedToTreeAtTopLevel(newFeed(with: feedSpecifier, isManualImport: isManualImport))
+		var topLevelFeedsToAdd = Set<Feed>()
+		var folderFeedsToAdd = [Folder: Set<Feed>]()
+
+		feedSettingsDatabase.inTransaction {
+			for item in items {
+				if let feedSpecifier = item.feedSpecifier {
+					topLevelFeedsToAdd.insert(newFeed(with: feedSpecifier, isManualImport: isManualImport))
+				} else {
+					if let title = item.titleFromAttributes, let folder = ensureFolder(with: title) {
+						folder.externalID = item.attributes?["nnw_externalID"]
+						if let itemChildren = item.children {
+							for itemChild in itemChildren {
+								if let feedSpecifier = itemChild.feedSpecifier {
+									folderFeedsToAdd[folder, default: Set<Feed>()].insert(newFeed(with: feedSpecifier, isManualImport: isManualImport))
+								}
 							}
 						}
 					}
 				}
 			}
 		}
+
+		for (folder, feeds) in folderFeedsToAdd {
+			folder.addFeeds(feeds)
+		}
+		addFeeds(topLevelFeedsToAdd)
 	}
 
 	/// Pass `isManualImport: true` for a file the user chose to import, `false` when restoring our own file.
@@ -655,20 +707,17 @@ public enum FetchType {
 	func newFeed(with opmlFeedSpecifier: OPMLFeedSpecifier, isManualImport: Bool) -> Feed {
 		let feedURL = opmlFeedSpecifier.feedURL
 		let settings = feedSettings(feedURL: feedURL, feedID: feedURL)
-		let feed = Feed(account: self, url: opmlFeedSpecifier.feedURL, settings: settings)
-
-		if let feedTitle = opmlFeedSpecifier.title {
-			feed.name = feedTitle
+		let feedTitle = opmlFeedSpecifier.title
 
-			// A title in a file the user imported is a title the user chose, so it goes in
-			// editedName too and survives refreshes. A title in our own file is just the name.
-			// <https://github.com/Ranchero-Software/NetNewsWire/issues/609>
-			if isManualImport && feed.editedName == nil {
-				feed.editedName = feedTitle
-			}
+		// A title in a file the user imported is a title the user chose, so it goes in
+		// editedName too and survives refreshes. A title in our own file is just the name.
+		// <https://github.com/Ranchero-Software/NetNewsWire/issues/609>
+		// (Set before the Feed exists, so there’s no per-feed change notification.)
+		if isManualImport, let feedTitle, !feedTitle.isEmpty, settings.editedName?.isEmpty ?? true {
+			settings.editedName = feedTitle
 		}
 
-		return feed
+		return Feed(account: self, url: feedURL, settings: settings, name: feedTitle)
 	}
 
 	func addFeed(_ feed: Feed, container: Container) async throws {
@@ -825,29 +874,49 @@ public enum FetchType {
 		}
 	}
 
-	public func fetchArticlesAsync(_ fetchType: FetchType) async -> Set<Article> {
+	/// Pass a `cancellationToken` to make the fetch cancelable — see
+	/// `ArticlesDatabase`. Fetches by articleID always run to completion.
+	public func fetchArticlesAsync(_ fetchType: FetchType, cancellationToken: DatabaseCancellationToken? = nil) async -> Set<Article> {
 		switch fetchType {
 		case .starred(let limit):
-			return await _fetchStarredArticlesAsync(limit: limit)
+			return await _fetchStarredArticlesAsync(limit: limit, cancellationToken: cancellationToken)
 		case .unread(let limit):
-			return await _fetchUnreadArticlesAsync(limit: limit)
+			return await _fetchUnreadArticlesAsync(limit: limit, cancellationToken: cancellationToken)
 		case .today(let limit):
-			return await _fetchTodayArticlesAsync(limit: limit)
+			return await _fetchTodayArticlesAsync(limit: limit, cancellationToken: cancellationToken)
 		case .folder(let folder, let readFilter):
 			if readFilter {
-				return await _fetchUnreadArticlesAsync(container: folder)
+				return await _fetchUnreadArticlesAsync(container: folder, cancellationToken: cancellationToken)
 			} else {
-				return await _fetchArticlesAsync(container: folder)
+				return await _fetchArticlesAsync(container: folder, cancellationToken: cancellationToken)
 			}
 		case .feed(let feed):
-			return await _fetchArticlesAsync(feed: feed)
+			return await _fetchArticlesAsync(feed: feed, cancellationToken: cancellationToken)
 		case .articleIDs(let articleIDs):
 			return await _fetchArticlesAsync(articleIDs: articleIDs)
 		case .search(let searchString):
-			return await _fetchArticlesMatchingAsync(searchString: searchString)
+			return await _fetchArticlesMatchingAsync(searchString: searchString, cancellationToken: cancellationToken)
 		case .searchWithArticleIDs(let searchString, let articleIDs):
-			return await _fetchArticlesMatchingWithArticleIDsAsync(searchString: searchString, articleIDs: articleIDs)
+			return await _fetchArticlesMatchingWithArticleIDsAsync(searchString: searchString, articleIDs: articleIDs, cancellationToken: cancellationToken)
+		}
+	}
+
+	/// One page of `fetchType`’s articles in timeline order, after `cursor`.
+	/// See `ArticlesDatabase.fetchArticlesPage`. A fetch type’s own limit is
+	/// ignored. Article ID and search fetches aren’t paged: they return
+	/// everything as a single page.
+	public func fetchArticlesPage(_ fetchType: FetchType, unreadOnly: Bool, sortDirection: ComparisonResult, after cursor: ArticlesPageCursor?, limit: Int) -> ArticlesPage {
+		guard let query = _pageQuery(fetchType, unreadOnly: unreadOnly) else {
+			return cursor == nil ? _singlePage(fetchArticles(fetchType), unreadOnly: unreadOnly, sortDirection: sortDirection) : ArticlesPage(articles: [], nextCursor: nil)
+		}
+		return database.fetchArticlesPage(feedIDs: query.feedIDs, filter: query.filter, sortDirection: sortDirection, after: cursor, limit: limit)
+	}
+
+	public func fetchArticlesPageAsync(_ fetchType: FetchType, unreadOnly: Bool, sortDirection: ComparisonResult, after cursor: ArticlesPageCursor?, limit: Int) async -> ArticlesPage {
+		guard let query = _pageQuery(fetchType, unreadOnly: unreadOnly) else {
+			return cursor == nil ? _singlePage(await fetchArticlesAsync(fetchType), unreadOnly: unreadOnly, sortDirection: sortDirection) : ArticlesPage(articles: [], nextCursor: nil)
 		}
+		return await database.fetchArticlesPageAsync(feedIDs: query.feedIDs, filter: query.filter, sortDirection: sortDirection, after: cursor, limit: limit)
 	}
 
 	public func fetchUnreadCountForStarredArticlesAsync() async -> Int {
@@ -1082,6 +1151,15 @@ public enum FetchType {
 		postChildrenDidChangeNotification()
 	}
 
+	public func addFeeds(_ feeds: Set<Feed>) {
+		guard !feeds.isEmpty else {
+			return
+		}
+		topLevelFeeds.formUnion(feeds)
+		structureDidChange()
+		postChildrenDidChangeNotification()
+	}
+
 	func addFeedIfNotInAnyFolder(_ feed: Feed) {
 		if !flattenedFeeds().contains(feed) {
 			addFeedToTreeAtTopLevel(feed)
@@ -1151,12 +1229,6 @@ public enum FetchType {
 		progressInfo = delegate.progressInfo
 	}
 
-	@objc func unreadCountDidChange(_ note: Notification) {
-		if let feed = note.object as? Feed, feed.account === self {
-			updateUnreadCount()
-		}
-	}
-
     @objc func batchUpdateDidPerform(_ note: Notification) {
 		flattenedFeedsNeedUpdate = true
 		rebuildFeedDictionaries()
@@ -1210,14 +1282,38 @@ extension Account {
 
 private extension Account {
 
+	// MARK: - Pages
+
+	func _pageQuery(_ fetchType: FetchType, unreadOnly: Bool) -> (feedIDs: Set<String>, filter: ArticlesPageFilter)? {
+		switch fetchType {
+		case .starred:
+			return (flattenedFeedsIDs, ArticlesPageFilter(unreadOnly: unreadOnly, starredOnly: true))
+		case .unread:
+			return (flattenedFeedsIDs, ArticlesPageFilter(unreadOnly: true))
+		case .today:
+			return (flattenedFeedsIDs, ArticlesPageFilter(unreadOnly: unreadOnly, todayOnly: true))
+		case .folder(let folder, let readFilter):
+			return (folder.flattenedFeeds().feedIDs(), ArticlesPageFilter(unreadOnly: unreadOnly || readFilter))
+		case .feed(let feed):
+			return (Set([feed.feedID]), ArticlesPageFilter(unreadOnly: unreadOnly))
+		case .articleIDs, .search, .searchWithArticleIDs:
+			return nil
+		}
+	}
+
+	func _singlePage(_ articles: Set<Article>, unreadOnly: Bool, sortDirection: ComparisonResult) -> ArticlesPage {
+		let filteredArticles = unreadOnly ? articles.unreadArticles() : articles
+		return ArticlesPage(articles: filteredArticles.sortedByLogicalDate(sortDirection), nextCursor: nil)
+	}
+
 	// MARK: - Starred Articles
 
 	func _fetchStarredArticles(limit: Int? = nil) -> Set<Article> {
 		database.fetchStarredArticles(feedIDs: flattenedFeedsIDs, limit: limit)
 	}
 
-	func _fetchStarredArticlesAsync(limit: Int? = nil) async -> Set<Article> {
-		await database.fetchedStarredArticlesAsync(feedIDs: flattenedFeedsIDs, limit: limit)
+	func _fetchStarredArticlesAsync(limit: Int? = nil, cancellationToken: DatabaseCancellationToken? = nil) async -> Set<Article> {
+		await database.fetchedStarredArticlesAsync(feedIDs: flattenedFeedsIDs, limit: limit, cancellationToken: cancellationToken)
 	}
 
 	// MARK: - Account Unread Articles
@@ -1226,8 +1322,8 @@ private extension Account {
 		_fetchUnreadArticles(container: self, limit: limit)
 	}
 
-	func _fetchUnreadArticlesAsync(limit: Int? = nil) async -> Set<Article> {
-		await _fetchUnreadArticlesAsync(container: self, limit: limit)
+	func _fetchUnreadArticlesAsync(limit: Int? = nil, cancellationToken: DatabaseCancellationToken? = nil) async -> Set<Article> {
+		await _fetchUnreadArticlesAsync(container: self, limit: limit, cancellationToken: cancellationToken)
 	}
 
 	// MARK: - Today Articles
@@ -1236,8 +1332,8 @@ private extension Account {
 		database.fetchTodayArticles(feedIDs: flattenedFeedsIDs, limit: limit)
 	}
 
-	func _fetchTodayArticlesAsync(limit: Int? = nil) async -> Set<Article> {
-		await database.fetchTodayArticlesAsync(feedIDs: flattenedFeedsIDs, limit: limit)
+	func _fetchTodayArticlesAsync(limit: Int? = nil, cancellationToken: DatabaseCancellationToken? = nil) async -> Set<Article> {
+		await database.fetchTodayArticlesAsync(feedIDs: flattenedFeedsIDs, limit: limit, cancellationToken: cancellationToken)
 	}
 
 	// MARK: - Container Articles
@@ -1249,10 +1345,13 @@ private extension Account {
 		return articles
 	}
 
-	func _fetchArticlesAsync(container: Container) async -> Set<Article> {
+	func _fetchArticlesAsync(container: Container, cancellationToken: DatabaseCancellationToken? = nil) async -> Set<Article> {
 		let feeds = container.flattenedFeeds()
-		let articles = await database.fetchArticlesAsync(feedIDs: feeds.feedIDs())
-		validateUnreadCountsAfterFetchingUnreadArticles(feeds: feeds, articles: articles)
+		let articles = await database.fetchArticlesAsync(feedIDs: feeds.feedIDs(), cancellationToken: cancellationToken)
+		// A canceled fetch comes back empty — it says nothing about unread counts.
+		if cancellationToken?.isCanceled != true {
+			validateUnreadCountsAfterFetchingUnreadArticles(feeds: feeds, articles: articles)
+		}
 		return articles
 	}
 
@@ -1269,13 +1368,13 @@ private extension Account {
 		return articles
 	}
 
-	func _fetchUnreadArticlesAsync(container: Container, limit: Int? = nil) async -> Set<Article> {
+	func _fetchUnreadArticlesAsync(container: Container, limit: Int? = nil, cancellationToken: DatabaseCancellationToken? = nil) async -> Set<Article> {
 		let feeds = container.flattenedFeeds()
-		let articles = await database.fetchUnreadArticlesAsync(feedIDs: feeds.feedIDs(), limit: limit)
+		let articles = await database.fetchUnreadArticlesAsync(feedIDs: feeds.feedIDs(), limit: limit, cancellationToken: cancellationToken)
 
 		// We don't validate limit queries because they, by definition, won't correctly match the
 		// complete unread state for the given container.
-		if limit == nil {
+		if limit == nil && cancellationToken?.isCanceled != true {
 			validateUnreadCountsAfterFetchingUnreadArticles(feeds: feeds, articles: articles)
 		}
 
@@ -1290,9 +1389,11 @@ private extension Account {
 		return articles
 	}
 
-	func _fetchArticlesAsync(feed: Feed) async -> Set<Article> {
-		let articles = await database.fetchArticlesAsync(feedID: feed.feedID)
-		validateUnreadCount(feed: feed, articles: articles)
+	func _fetchArticlesAsync(feed: Feed, cancellationToken: DatabaseCancellationToken? = nil) async -> Set<Article> {
+		let articles = await database.fetchArticlesAsync(feedID: feed.feedID, cancellationToken: cancellationToken)
+		if cancellationToken?.isCanceled != true {
+			validateUnreadCount(feed: feed, articles: articles)
+		}
 		return articles
 	}
 
@@ -1318,16 +1419,16 @@ private extension Account {
 		database.fetchArticlesMatching(searchString: searchString, feedIDs: flattenedFeedsIDs)
 	}
 
-	func _fetchArticlesMatchingAsync(searchString: String) async -> Set<Article> {
-		await database.fetchArticlesMatchingAsync(searchString: searchString, feedIDs: flattenedFeedsIDs)
+	func _fetchArticlesMatchingAsync(searchString: String, cancellationToken: DatabaseCancellationToken? = nil) async -> Set<Article> {
+		await database.fetchArticlesMatchingAsync(searchString: searchString, feedIDs: flattenedFeedsIDs, cancellationToken: cancellationToken)
 	}
 
 	func _fetchArticlesMatchingWithArticleIDs(searchString: String, articleIDs: Set<String>) -> Set<Article> {
 		database.fetchArticlesMatchingWithArticleIDs(searchString: searchString, articleIDs: articleIDs)
 	}
 
-	func _fetchArticlesMatchingWithArticleIDsAsync(searchString: String, articleIDs: Set<String>) async -> Set<Article> {
-		await database.fetchArticlesMatchingWithArticleIDsAsync(searchString: searchString, articleIDs: articleIDs)
+	func _fetchArticlesMatchingWithArticleIDsAsync(searchString: String, articleIDs: Set<String>, cancellationToken: DatabaseCancellationToken? = nil) async -> Set<Article> {
+		await database.fetchArticlesMatchingWithArticleIDsAsync(searchString: searchString, articleIDs: articleIDs, cancellationToken: cancellationToken)
 	}
 
 	// MARK: - Unread Counts
@@ -1405,8 +1506,15 @@ private extension Account {
 
 	func _fetchAllUnreadCounts() {
 		fetchingAllUnreadCounts = true
+		let startupInterval = areUnreadCountsInitialized ? nil : StartupProfiler.shared.begin(.fetchUnreadCounts)
 
 		Task { @MainActor in
+			defer {
+				if let startupInterval {
+					StartupProfiler.shared.end(startupInterval)
+				}
+			}
+
 			guard let unreadCountDictionary = await database.fetchAllUnreadCountsAsync() else {
 				fetchingAllUnreadCounts = false
 				return
@@ -1481,10 +1589,13 @@ private extension Account {
 		feedDictionariesNeedUpdate = false
 	}
 
+	// Feed unread count changes arrive as deltas via UnreadCountAggregator.
+	// This full recount is for when the set of feeds changes.
     func updateUnreadCount() {
 		if fetchingAllUnreadCounts {
 			return
 		}
+		UnreadCountAggregator.shared.flush()
 		var updatedUnreadCount = 0
 		for feed in flattenedFeeds() {
 			updatedUnreadCount += feed.unreadCount
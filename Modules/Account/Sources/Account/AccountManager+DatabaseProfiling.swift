@@ -0,0 +1,60 @@
+//
+//  AccountManager+DatabaseProfiling.swift
+//  Account
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import RSDatabase
+import ActivityLog
+
+/// Query profiling for every database. Off by default; when on, slow
+/// statements show up in the Activity log, and the full profile can be
+/// exported as JSON.
+public extension AccountManager {
+
+	nonisolated static let profileDatabaseQueriesKey = "ProfileDatabaseQueries"
+
+	/// Statements at least this slow are logged, with their query plans.
+	nonisolated static let slowDatabaseQueryThresholdMilliseconds = 100.0
+
+	var isProfilingDatabaseQueries: Bool {
+		get {
+			DatabaseQueue.isProfilingEnabled
+		}
+		set {
+			UserDefaults.standard.set(newValue, forKey: Self.profileDatabaseQueriesKey)
+			Self.setDatabaseProfilingEnabled(newValue)
+		}
+	}
+
+	/// Profiles for every open database, as pretty-printed JSON.
+	func databaseProfileJSON() throws -> Data {
+		try DatabaseProfile.jsonData(DatabaseQueue.profiles())
+	}
+}
+
+extension AccountManager {
+
+	static func startDatabaseProfilingIfNeeded() {
+		if UserDefaults.standard.bool(forKey: profileDatabaseQueriesKey) {
+			setDatabaseProfilingEnabled(true)
+		}
+	}
+}
+
+private extension AccountManager {
+
+	static func setDatabaseProfilingEnabled(_ enabled: Bool) {
+		DatabaseQueue.setProfilingEnabled(enabled, slowStatementThresholdMilliseconds: slowDatabaseQueryThresholdMilliseconds, capturesQueryPlans: true) { slowStatement in
+			var message = "\(String(format: "%.1f", slowStatement.milliseconds)) ms, \(slowStatement.rows) rows: \(slowStatement.fingerprint)"
+			if let queryPlan = slowStatement.queryPlan, !queryPlan.isEmpty {
+				message += "\n" + queryPlan.joined(separator: "\n")
+			}
+			Task { @MainActor in
+				ActivityLog.shared.logCompletedActivity(owner: .app, kind: .slowDatabaseQuery, detail: slowStatement.databaseName, message: message)
+			}
+		}
+	}
+}
@@ -10,6 +10,7 @@ import Foundation
 import os
 import RSCore
 import RSWeb
+import RSDatabase
 import Articles
 import ArticlesDatabase
 import ErrorLog
@@ -31,6 +32,9 @@ import ActivityLog
 	private let defaultAccountFolderName = "OnMyMac"
 	private let defaultAccountIdentifier = "OnMyMac"
 
+	private var didRunDeferredStartupWork = false
+	private static let deferredStartupWorkFallbackDelay: TimeInterval = 5
+
 	private var lastStatusRepairDate: Date?
 	private static let statusRepairInterval: TimeInterval = 1 * 60 * 60
 
@@ -38,6 +42,10 @@ import ActivityLog
 
 	nonisolated static let syncArticleContentForUnreadArticlesKey = "iCloudSyncArticleContentForUnreadArticles"
 
+	/// Hidden preference: store article bodies compressed. Takes effect for
+	/// bodies written after launch; existing bodies stay as they are.
+	nonisolated static let compressArticleBodiesKey = "CompressArticleBodies"
+
 	public var syncArticleContentForUnreadArticles: Bool {
 		get {
 			assert(Thread.isMainThread)
@@ -135,6 +143,9 @@ import ActivityLog
 	private var isActive = false
 
 	public init() {
+		// Before any database is opened, so every one is profiled.
+		Self.startDatabaseProfilingIfNeeded()
+
 		self.accountsFolder = AppConfig.dataSubfolder(named: "Accounts").path
 
 		// The local "On My Mac" account must always exist, even if it's empty.
@@ -178,6 +189,26 @@ import ActivityLog
 		DispatchQueue.main.async {
 			self.updateUnreadCount()
 		}
+
+		// In case the UI never reports its first timeline paint (empty timeline, say).
+		DispatchQueue.main.asyncAfter(deadline: .now() + Self.deferredStartupWorkFallbackDelay) {
+			self.runDeferredStartupWork()
+		}
+	}
+
+	/// Run startup work that isn’t needed to show the UI — database cleanup,
+	/// schema housekeeping, search indexing, etc.
+	///
+	/// Call this once the first timeline has been displayed. It’s safe to call
+	/// more than once: only the first call does anything.
+	public func runDeferredStartupWork() {
+		guard isActive, !didRunDeferredStartupWork else {
+			return
+		}
+		didRunDeferredStartupWork = true
+		for account in accounts {
+			account.runDeferredStartupWork()
+		}
 	}
 
 	// MARK: - API
@@ -201,6 +232,9 @@ import ActivityLog
 
 		let account = Account(dataFolder: accountFolder, type: type, accountID: accountID)
 		accountsDictionary[accountID] = account
+		if didRunDeferredStartupWork {
+			account.runDeferredStartupWork()
+		}
 
 		var userInfo = [String: Any]()
 		userInfo[Account.UserInfoKey.account] = account
@@ -420,20 +454,51 @@ import ActivityLog
 		return articles
 	}
 
-	public func fetchArticlesAsync(_ fetchType: FetchType) async -> Set<Article> {
+	public func fetchArticlesAsync(_ fetchType: FetchType, cancellationToken: DatabaseCancellationToken? = nil) async -> Set<Article> {
 		precondition(Thread.isMainThread)
 
 		guard activeAccounts.count > 0 else {
 			return Set<Article>()
 		}
 
-		var allFetchedArticles = Set<Article>()
-		for account in activeAccounts {
-			let articles = await account.fetchArticlesAsync(fetchType)
-			allFetchedArticles.formUnion(articles)
+		// Each account has its own database, so they’re all queried at once.
+		return await withTaskGroup(of: Set<Article>.self, isolation: MainActor.shared) { group in
+			for account in activeAccounts {
+				group.addTask {
+					await account.fetchArticlesAsync(fetchType, cancellationToken: cancellationToken)
+				}
+			}
+
+			var allFetchedArticles = Set<Article>()
+			for await articles in group {
+				allFetchedArticles.formUnion(articles)
+			}
+			return allFetchedArticles
+		}
+	}
+
+	/// Like `fetchArticlesAsync`, but returns the articles in timeline order.
+	/// Each account’s articles are sorted in that account’s child task, off the
+	/// main thread, and the sorted arrays are then merged.
+	public func fetchArticlesSortedByDateAsync(_ fetchType: FetchType, sortDirection: ComparisonResult = .orderedDescending) async -> [Article] {
+		precondition(Thread.isMainThread)
+
+		let sortedArrays = await withTaskGroup(of: [Article].self, isolation: MainActor.shared) { group in
+			for account in activeAccounts {
+				group.addTask {
+					let articles = await account.fetchArticlesAsync(fetchType)
+					return articles.sortedByLogicalDate(sortDirection)
+				}
+			}
+
+			var sortedArrays = [[Article]]()
+			for await articles in group {
+				sortedArrays.append(articles)
+			}
+			return sortedArrays
 		}
 
-		return allFetchedArticles
+		return .mergedByLogicalDate(sortedArrays, sortDirection: sortDirection)
 	}
 
 	/// Fetch a single article (synchronously) by accountID and articleID.
@@ -510,6 +575,7 @@ import ActivityLog
 			return
 		}
 		if areUnreadCountsInitialized {
+			StartupProfiler.shared.unreadCountsDidInitialize()
 			postUnreadCountDidInitializeNotification()
 		}
 	}
@@ -9,12 +9,18 @@
 import Foundation
 import Articles
 import ArticlesDatabase
+import RSDatabase
 
 @MainActor public protocol ArticleFetcher {
 	func fetchArticles() -> Set<Article>
 	func fetchArticlesAsync() async -> Set<Article>
 	func fetchUnreadArticles() -> Set<Article>
 	func fetchUnreadArticlesAsync() async -> Set<Article>
+
+	// For the timeline and search, which cancel fetches they no longer need.
+	// A canceled fetch returns an empty set.
+	func fetchArticlesAsync(cancellationToken: DatabaseCancellationToken) async -> Set<Article>
+	func fetchUnreadArticlesAsync(cancellationToken: DatabaseCancellationToken) async -> Set<Article>
 }
 
 extension Feed: ArticleFetcher {
@@ -24,11 +30,11 @@ extension Feed: ArticleFetcher {
 	}
 
 	public func fetchArticlesAsync() async -> Set<Article> {
-		guard let account else {
-			assertionFailure("Expected feed.account, but got nil.")
-			return Set<Article>()
-		}
-		return await account.fetchArticlesAsync(.feed(self))
+		await _fetchArticlesAsync(cancellationToken: nil)
+	}
+
+	public func fetchArticlesAsync(cancellationToken: DatabaseCancellationToken) async -> Set<Article> {
+		await _fetchArticlesAsync(cancellationToken: cancellationToken)
 	}
 
 	public func fetchUnreadArticles() -> Set<Article> {
@@ -36,13 +42,23 @@ extension Feed: ArticleFetcher {
 	}
 
 	public func fetchUnreadArticlesAsync() async -> Set<Article> {
+		// TODO: fetch only unread articles rather than filtering.
+		await _fetchArticlesAsync(cancellationToken: nil).unreadArticles()
+	}
+
+	public func fetchUnreadArticlesAsync(cancellationToken: DatabaseCancellationToken) async -> Set<Article> {
+		await _fetchArticlesAsync(cancellationToken: cancellationToken).unreadArticles()
+	}
+}
+
+private extension Feed {
+
+	func _fetchArticlesAsync(cancellationToken: DatabaseCancellationToken?) async -> Set<Article> {
 		guard let account else {
 			assertionFailure("Expected feed.account, but got nil.")
 			return Set<Article>()
 		}
-		// TODO: fetch only unread articles rather than filtering.
-		let articles = await account.fetchArticlesAsync(.feed(self))
-		return articles.unreadArticles()
+		return await account.fetchArticlesAsync(.feed(self), cancellationToken: cancellationToken)
 	}
 }
 
@@ -57,11 +73,11 @@ extension Folder: ArticleFetcher {
 	}
 
 	public func fetchArticlesAsync() async -> Set<Article> {
-		guard let account else {
-			assertionFailure("Expected folder.account, but got nil.")
-			return Set<Article>()
-		}
-		return await account.fetchArticlesAsync(.folder(self, false))
+		await _fetchArticlesAsync(unreadOnly: false, cancellationToken: nil)
+	}
+
+	public func fetchArticlesAsync(cancellationToken: DatabaseCancellationToken) async -> Set<Article> {
+		await _fetchArticlesAsync(unreadOnly: false, cancellationToken: cancellationToken)
 	}
 
 	public func fetchUnreadArticles() -> Set<Article> {
@@ -73,10 +89,21 @@ extension Folder: ArticleFetcher {
 	}
 
 	public func fetchUnreadArticlesAsync() async -> Set<Article> {
+		await _fetchArticlesAsync(unreadOnly: true, cancellationToken: nil)
+	}
+
+	public func fetchUnreadArticlesAsync(cancellationToken: DatabaseCancellationToken) async -> Set<Article> {
+		await _fetchArticlesAsync(unreadOnly: true, cancellationToken: cancellationToken)
+	}
+}
+
+private extension Folder {
+
+	func _fetchArticlesAsync(unreadOnly: Bool, cancellationToken: DatabaseCancellationToken?) async -> Set<Article> {
 		guard let account else {
 			assertionFailure("Expected folder.account, but got nil.")
 			return Set<Article>()
 		}
-		return await account.fetchArticlesAsync(.folder(self, true))
+		return await account.fetchArticlesAsync(.folder(self, unreadOnly), cancellationToken: cancellationToken)
 	}
 }
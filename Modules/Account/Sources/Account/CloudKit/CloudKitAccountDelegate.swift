@@ -48,7 +48,7 @@ enum CloudKitAccountDelegateError: LocalizedError, Sendable {
 	private let articlesZone: CloudKitArticlesZone
 	private let syncArticleContentForUnreadArticles: @Sendable () -> Bool
 
-	private let mainThreadOperationQueue = MainThreadOperationQueue()
+	private let operationExecutor = OperationExecutor()
 	private let refresher: LocalAccountRefresher
 	private var syncErrorHandler: CloudKitSyncErrorHandler?
 
@@ -133,14 +133,10 @@ enum CloudKitAccountDelegateError: LocalizedError, Sendable {
 		Self.logger.debug("CloudKitAccountDelegate: \(#function, privacy: .public)")
 		ActivityLog.shared.logCompletedActivity(owner: account.activityOwner, kind: .receiveCloudKitNotification)
 
-		await withCheckedContinuation { continuation in
-			let op = CloudKitRemoteNotificationOperation(accountZone: accountZone, articlesZone: articlesZone, accountID: account.accountID, accountDisplayName: account.nameForDisplay, userInfo: userInfo)
-			op.completionBlock = { _ in
-				Self.logger.debug("CloudKitAccountDelegate: \(#function, privacy: .public) did complete")
-				continuation.resume()
-			}
-			mainThreadOperationQueue.add(op)
-		}
+		let op = CloudKitRemoteNotificationOperation(accountZone: accountZone, articlesZone: articlesZone, accountID: account.accountID, accountDisplayName: account.nameForDisplay, userInfo: userInfo)
+		await operationExecutor.add(op)
+		await op.waitUntilFinished()
+		Self.logger.debug("CloudKitAccountDelegate: \(#function, privacy: .public) did complete")
 	}
 
 	func refreshAll() async throws {
@@ -232,17 +228,12 @@ enum CloudKitAccountDelegateError: LocalizedError, Sendable {
 			return
 		}
 		Self.logger.debug("CloudKitAccountDelegate: \(#function, privacy: .public)")
-		return try await withCheckedThrowingContinuation { (continuation: CheckedContinuation<Void, Error>) in
-			let op = CloudKitReceiveStatusOperation(articlesZone: articlesZone, accountID: account.accountID, accountDisplayName: account.nameForDisplay)
-			op.completionBlock = { mainThreadOperation in
-				Self.logger.debug("CloudKitAccountDelegate: \(#function, privacy: .public) did complete")
-				if mainThreadOperation.isCanceled {
-					continuation.resume(throwing: CloudKitAccountDelegateError.unknown)
-				} else {
-					continuation.resume(returning: ())
-				}
-			}
-			mainThreadOperationQueue.add(op)
+		let op = CloudKitReceiveStatusOperation(articlesZone: articlesZone, accountID: account.accountID, accountDisplayName: account.nameForDisplay)
+		await operationExecutor.add(op)
+		await op.waitUntilFinished()
+		Self.logger.debug("CloudKitAccountDelegate: \(#function, privacy: .public) did complete")
+		if op.isCanceled {
+			throw CloudKitAccountDelegateError.unknown
 		}
 	}
 
@@ -1134,22 +1125,18 @@ private extension CloudKitAccountDelegate {
 	/// Returns the number of statuses successfully sent.
 	func sendArticleStatus(account: Account, showProgress: Bool) async throws -> Int {
 		Self.logger.debug("CloudKitAccountDelegate: \(#function, privacy: .public)")
-		return try await withCheckedThrowingContinuation { (continuation: CheckedContinuation<Int, Error>) in
-			let op = CloudKitSendStatusOperation(account: account,
-												 articlesZone: articlesZone,
-												 database: syncDatabase,
-												 syncArticleContentForUnreadArticles: syncArticleContentForUnreadArticles,
-												 syncErrorHandler: syncErrorHandler)
-			op.completionBlock = { mainThreadOperation in
-				Self.logger.debug("CloudKitAccountDelegate: \(#function, privacy: .public) did complete")
-				if mainThreadOperation.isCanceled {
-					continuation.resume(throwing: CloudKitAccountDelegateError.unknown)
-				} else {
-					continuation.resume(returning: op.sentCount)
-				}
-			}
-			mainThreadOperationQueue.add(op)
+		let op = CloudKitSendStatusOperation(account: account,
+											 articlesZone: articlesZone,
+											 database: syncDatabase,
+											 syncArticleContentForUnreadArticles: syncArticleContentForUnreadArticles,
+											 syncErrorHandler: syncErrorHandler)
+		await operationExecutor.add(op)
+		await op.waitUntilFinished()
+		Self.logger.debug("CloudKitAccountDelegate: \(#function, privacy: .public) did complete")
+		if op.isCanceled {
+			throw CloudKitAccountDelegateError.unknown
 		}
+		return op.sentCount
 	}
 
 	func removeFeedFromCloud(for account: Account, with feed: Feed, from container: Container) async throws {
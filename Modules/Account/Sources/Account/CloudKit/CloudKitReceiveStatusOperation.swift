@@ -12,7 +12,7 @@ import RSCore
 import CloudKitSync
 import ActivityLog
 
-final class CloudKitReceiveStatusOperation: MainThreadOperation, @unchecked Sendable {
+final class CloudKitReceiveStatusOperation: AsyncOperation, @unchecked Sendable {
 	private weak var articlesZone: CloudKitArticlesZone?
 	private let accountID: String
 	private let accountDisplayName: String
@@ -25,31 +25,32 @@ final class CloudKitReceiveStatusOperation: MainThreadOperation, @unchecked Send
 		super.init(name: "CloudKitReceiveStatusOperation")
 	}
 
-	@MainActor override func run() {
+	override func run() async {
+		await receiveStatuses()
+	}
+}
+
+private extension CloudKitReceiveStatusOperation {
+
+	/// The articles zone and the activity log are main-actor objects.
+	@MainActor func receiveStatuses() async {
 		guard let articlesZone else {
-			self.didComplete()
 			return
 		}
 
-		Task { @MainActor in
-			defer {
-				self.didComplete()
-			}
-
-			let activityLog = ActivityLog.shared
-			let taskNumber = activityLog.nextTaskNumberString()
-			let activityID = activityLog.createActivity(owner: .account(accountID: accountID, displayName: accountDisplayName), kind: .refreshArticleStatuses, detail: "Receiving article statuses \(taskNumber)")
-			activityLog.didStart(id: activityID)
-
-			Self.logger.debug("iCloud: Refreshing article statuses")
-			do {
-				let totals = try await articlesZone.refreshArticles()
-				Self.logger.debug("iCloud: Finished refreshing article statuses")
-				activityLog.didComplete(id: activityID, message: cloudKitSyncMessage(changed: totals.changed, deleted: totals.deleted))
-			} catch {
-				Self.logger.error("iCloud: Receive status error: \(error.localizedDescription)")
-				activityLog.didFail(id: activityID, error: error)
-			}
+		let activityLog = ActivityLog.shared
+		let taskNumber = activityLog.nextTaskNumberString()
+		let activityID = activityLog.createActivity(owner: .account(accountID: accountID, displayName: accountDisplayName), kind: .refreshArticleStatuses, detail: "Receiving article statuses \(taskNumber)")
+		activityLog.didStart(id: activityID)
+
+		Self.logger.debug("iCloud: Refreshing article statuses")
+		do {
+			let totals = try await articlesZone.refreshArticles()
+			Self.logger.debug("iCloud: Finished refreshing article statuses")
+			activityLog.didComplete(id: activityID, message: cloudKitSyncMessage(changed: totals.changed, deleted: totals.deleted))
+		} catch {
+			Self.logger.error("iCloud: Receive status error: \(error.localizedDescription)")
+			activityLog.didFail(id: activityID, error: error)
 		}
 	}
 }
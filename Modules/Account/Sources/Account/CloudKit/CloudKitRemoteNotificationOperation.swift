@@ -12,7 +12,7 @@ import RSCore
 import CloudKitSync
 import ActivityLog
 
-@MainActor final class CloudKitRemoteNotificationOperation: MainThreadOperation, @unchecked Sendable {
+final class CloudKitRemoteNotificationOperation: AsyncOperation, @unchecked Sendable {
 	private weak var accountZone: CloudKitAccountZone?
 	private weak var articlesZone: CloudKitArticlesZone?
 	private let accountID: String
@@ -29,31 +29,35 @@ import ActivityLog
 		super.init(name: "CloudKitRemoteNotificationOperation")
 	}
 
-	override func run() {
+	override func run() async {
+		await processRemoteNotification()
+	}
+}
+
+private extension CloudKitRemoteNotificationOperation {
+
+	/// Both zones and the activity log are main-actor objects.
+	@MainActor func processRemoteNotification() async {
 		guard let accountZone, let articlesZone else {
-			didComplete()
 			return
 		}
 
-		Task { @MainActor in
-			let activityLog = ActivityLog.shared
-			let owner = ActivityOwner.account(accountID: accountID, displayName: accountDisplayName)
-			let taskNumber = activityLog.nextTaskNumberString()
+		let activityLog = ActivityLog.shared
+		let owner = ActivityOwner.account(accountID: accountID, displayName: accountDisplayName)
+		let taskNumber = activityLog.nextTaskNumberString()
 
-			let accountZoneActivityID = activityLog.createActivity(owner: owner, kind: .refreshFeedList, detail: "Receiving account changes \(taskNumber)")
-			activityLog.didStart(id: accountZoneActivityID)
+		let accountZoneActivityID = activityLog.createActivity(owner: owner, kind: .refreshFeedList, detail: "Receiving account changes \(taskNumber)")
+		activityLog.didStart(id: accountZoneActivityID)
 
-			Self.logger.debug("iCloud: Processing remote notification")
-			await accountZone.receiveRemoteNotification(userInfo: userInfo)
-			activityLog.didComplete(id: accountZoneActivityID)
+		Self.logger.debug("iCloud: Processing remote notification")
+		await accountZone.receiveRemoteNotification(userInfo: userInfo)
+		activityLog.didComplete(id: accountZoneActivityID)
 
-			let articlesZoneActivityID = activityLog.createActivity(owner: owner, kind: .refreshArticleStatuses, detail: "Receiving article changes \(taskNumber)")
-			activityLog.didStart(id: articlesZoneActivityID)
-			await articlesZone.receiveRemoteNotification(userInfo: self.userInfo)
-			activityLog.didComplete(id: articlesZoneActivityID)
+		let articlesZoneActivityID = activityLog.createActivity(owner: owner, kind: .refreshArticleStatuses, detail: "Receiving article changes \(taskNumber)")
+		activityLog.didStart(id: articlesZoneActivityID)
+		await articlesZone.receiveRemoteNotification(userInfo: userInfo)
+		activityLog.didComplete(id: articlesZoneActivityID)
 
-			Self.logger.debug("iCloud: Finished processing remote notification")
-			didComplete()
-		}
+		Self.logger.debug("iCloud: Finished processing remote notification")
 	}
 }
@@ -15,7 +15,7 @@ import SyncDatabase
 import CloudKitSync
 import ActivityLog
 
-final class CloudKitSendStatusOperation: MainThreadOperation, @unchecked Sendable {
+final class CloudKitSendStatusOperation: AsyncOperation, @unchecked Sendable {
 	private let blockSize = 150
 	private weak var account: Account?
 	private weak var articlesZone: CloudKitArticlesZone?
@@ -39,7 +39,14 @@ final class CloudKitSendStatusOperation: MainThreadOperation, @unchecked Sendabl
 		super.init(name: "CloudKitSendStatusOperation")
 	}
 
-	@MainActor override func run() {
+	override func run() async {
+		await sendStatuses()
+	}
+}
+
+@MainActor private extension CloudKitSendStatusOperation {
+
+	func sendStatuses() async {
 		Self.logger.debug("iCloud: Sending article statuses")
 
 		let activityLog = ActivityLog.shared
@@ -47,32 +54,26 @@ final class CloudKitSendStatusOperation: MainThreadOperation, @unchecked Sendabl
 		let activityID = activityLog.createActivity(owner: .account(accountID: accountID, displayName: account?.nameForDisplay ?? accountID), kind: .sendArticleStatuses, detail: "Sending article statuses \(taskNumber)")
 		activityLog.didStart(id: activityID)
 
-		Task { @MainActor in
-			do {
-				let result = try await selectForProcessing()
-				self.sentCount = result.sent
-				Self.logger.debug("iCloud: Finished sending article statuses")
-				if isCanceled {
-					activityLog.didFail(id: activityID, error: CloudKitAccountDelegateError.unknown)
-				} else if result.sent == 0 {
-					activityLog.didComplete(id: activityID, message: "No statuses to send", durationIsSignificant: false)
-				} else {
-					var message = "\(result.sent) status\(result.sent == 1 ? "" : "es") sent"
-					if result.withContent > 0 {
-						message += " (\(result.withContent) with content)"
-					}
-					activityLog.didComplete(id: activityID, message: message)
+		do {
+			let result = try await selectForProcessing()
+			self.sentCount = result.sent
+			Self.logger.debug("iCloud: Finished sending article statuses")
+			if isCanceled {
+				activityLog.didFail(id: activityID, error: CloudKitAccountDelegateError.unknown)
+			} else if result.sent == 0 {
+				activityLog.didComplete(id: activityID, message: "No statuses to send", durationIsSignificant: false)
+			} else {
+				var message = "\(result.sent) status\(result.sent == 1 ? "" : "es") sent"
+				if result.withContent > 0 {
+					message += " (\(result.withContent) with content)"
 				}
-			} catch {
-				Self.logger.debug("iCloud: Send status error: \(error.localizedDescription)")
-				activityLog.didFail(id: activityID, error: error)
+				activityLog.didComplete(id: activityID, message: message)
 			}
-			didComplete()
+		} catch {
+			Self.logger.debug("iCloud: Send status error: \(error.localizedDescription)")
+			activityLog.didFail(id: activityID, error: error)
 		}
 	}
-}
-
-@MainActor private extension CloudKitSendStatusOperation {
 
 	typealias SendResult = (sent: Int, withContent: Int)
 
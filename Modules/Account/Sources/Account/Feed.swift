@@ -228,11 +228,12 @@ import Articles
 			account?.unreadCount(for: self) ?? 0
 		}
 		set {
-			if unreadCount == newValue {
+			let oldValue = unreadCount
+			if oldValue == newValue {
 				return
 			}
 			account?.setUnreadCount(newValue, for: self)
-			postUnreadCountDidChangeNotification()
+			UnreadCountAggregator.shared.feedUnreadCountDidChange(self, delta: newValue - oldValue)
 		}
 	}
 
@@ -257,7 +258,7 @@ import Articles
 
 	// MARK: - Init
 
-	init(account: Account, url: String, settings: FeedSettings) {
+	init(account: Account, url: String, settings: FeedSettings, name: String? = nil) {
 		let accountID = account.accountID
 		let feedID = settings.feedID
 		self.accountID = accountID
@@ -266,6 +267,7 @@ import Articles
 		self.sidebarItemID = SidebarItemIdentifier.feed(accountID, feedID)
 
 		self.url = url
+		self.name = name
 		self.settings = settings
 		self.settings.feed = self
 	}
@@ -60,6 +60,38 @@ final class FeedSettingsDatabase: Sendable {
 	private let serialDispatchQueue: DispatchQueue
 	private static let logger = Logger(subsystem: Logger.nnwSubsystem, category: "FeedSettingsDatabase")
 
+	/// Setters don’t write right away. Their changes are coalesced here, by feed,
+	/// and written together in one transaction — see `writePendingChanges`.
+	/// A refresh sets several columns for every feed, and one transaction per
+	/// column per feed was the bulk of the disk I/O during a refresh.
+	///
+	/// Row creation and deletion go through here too, so that a setter called
+	/// right after `ensureFeedExists` — or right after `deleteSettings` — is
+	/// written after it, not before.
+	private let pendingChanges = OSAllocatedUnfairLock(initialState: PendingChanges())
+	private static let writeDelay: TimeInterval = 1.0
+
+	/// Number of transactions committed so far. Compare before and after
+	/// some work (a refresh, for instance) to see how many it took.
+	var commitCount: Int {
+		commits.withLock { $0 }
+	}
+	private let commits = OSAllocatedUnfairLock(initialState: 0)
+
+	private struct PendingChanges {
+		/// Written first. Setters called before a deletion are dropped with it.
+		var feedURLsToDelete = Set<String>()
+		/// feedURL → feedID, written next, with INSERT OR IGNORE — so the first feedID wins.
+		var feedIDsToInsert = [String: String]()
+		// nil values are written as NULL.
+		var columnValues = [String: [Column: (any Sendable)?]]()
+		var isWriteScheduled = false
+
+		var isEmpty: Bool {
+			feedURLsToDelete.isEmpty && feedIDsToInsert.isEmpty && columnValues.isEmpty
+		}
+	}
+
 	init(databasePath: String) {
 		self.databasePath = databasePath
 		self.serialDispatchQueue = DispatchQueue(label: "FeedSettingsDatabase")
@@ -76,6 +108,7 @@ final class FeedSettingsDatabase: Sendable {
 	func vacuum() async {
 		await withCheckedContinuation { continuation in
 			serialDispatchQueue.async {
+				self.writePendingChangesOnQueue()
 				self.database.vacuum()
 				continuation.resume()
 			}
@@ -84,12 +117,14 @@ final class FeedSettingsDatabase: Sendable {
 
 	func vacuumIfNeeded() {
 		serialDispatchQueue.async {
+			self.writePendingChangesOnQueue()
 			self.database.vacuumIfNeeded()
 		}
 	}
 
 	var isEmpty: Bool {
 		serialDispatchQueue.sync {
+			self.writePendingChangesOnQueue()
 			guard let resultSet = self.database.executeQuery("SELECT 1 FROM feedSettings LIMIT 1;", withArgumentsIn: []) else {
 				return true
 			}
@@ -100,11 +135,42 @@ final class FeedSettingsDatabase: Sendable {
 		}
 	}
 
+	// MARK: - Transactions
+
+	/// Writes made during `block` run in a single transaction, instead of one
+	/// transaction (and disk sync) each. All writes are queued asynchronously
+	/// on the serial queue, so bracketing them with begin and commit is enough.
+	func inTransaction(_ block: () -> Void) {
+		serialDispatchQueue.async {
+			self.writePendingChangesOnQueue()
+			self.database.beginTransaction()
+		}
+		block()
+		serialDispatchQueue.async {
+			self.writePendingChangesOnQueue()
+			self.database.commit()
+			self.didCommit()
+		}
+	}
+
+	/// Write pending setter changes now, and wait until they’re written.
+	/// Call at the end of a refresh and before quitting.
+	func writePendingChanges() {
+		serialDispatchQueue.sync {
+			self.writePendingChangesOnQueue()
+		}
+	}
+
 	// MARK: - Feed Existence
 
 	func ensureFeedExists(_ feedURL: String, feedID: String) {
+		pendingChanges.withLock { pendingChanges in
+			if pendingChanges.feedIDsToInsert[feedURL] == nil {
+				pendingChanges.feedIDsToInsert[feedURL] = feedID
+			}
+		}
 		serialDispatchQueue.async {
-			self.database.executeUpdate("INSERT OR IGNORE INTO feedSettings (feedURL, feedID) VALUES (?, ?);", withArgumentsIn: [feedURL, feedID])
+			self.writePendingChangesOnQueue()
 		}
 	}
 
@@ -118,7 +184,9 @@ final class FeedSettingsDatabase: Sendable {
 		}
 		nonisolated(unsafe) let capturedDictionary = dictionary
 		serialDispatchQueue.async {
+			self.writePendingChangesOnQueue()
 			self.database.insertRow(capturedDictionary, insertType: .orReplace, tableName: "feedSettings")
+			self.didCommit()
 		}
 	}
 
@@ -126,6 +194,7 @@ final class FeedSettingsDatabase: Sendable {
 
 	func allRows() -> [String: Row] {
 		serialDispatchQueue.sync {
+			self.writePendingChangesOnQueue()
 			guard let resultSet = self.database.executeQuery("SELECT * FROM feedSettings;", withArgumentsIn: []) else {
 				return [:]
 			}
@@ -146,101 +215,62 @@ final class FeedSettingsDatabase: Sendable {
 	// MARK: - String
 
 	func setString(_ value: String?, for feedURL: String, column: Column) {
-		let name = column.rawValue
-		serialDispatchQueue.async {
-			if let value {
-				self.database.executeUpdate("UPDATE feedSettings SET \(name) = ? WHERE feedURL = ?;", withArgumentsIn: [value, feedURL])
-			} else {
-				self.database.executeUpdate("UPDATE feedSettings SET \(name) = NULL WHERE feedURL = ?;", withArgumentsIn: [feedURL])
-			}
-		}
+		setPendingValues([column: value], for: feedURL)
 	}
 
 	// MARK: - Bool
 
 	func setBool(_ value: Bool, for feedURL: String, column: Column) {
-		let name = column.rawValue
-		serialDispatchQueue.async {
-			self.database.executeUpdate("UPDATE feedSettings SET \(name) = ? WHERE feedURL = ?;", withArgumentsIn: [value, feedURL])
-		}
+		setPendingValues([column: value], for: feedURL)
 	}
 
 	// MARK: - Int
 
 	func setInt(_ value: Int?, for feedURL: String, column: Column) {
-		let name = column.rawValue
-		serialDispatchQueue.async {
-			if let value {
-				self.database.executeUpdate("UPDATE feedSettings SET \(name) = ? WHERE feedURL = ?;", withArgumentsIn: [value, feedURL])
-			} else {
-				self.database.executeUpdate("UPDATE feedSettings SET \(name) = NULL WHERE feedURL = ?;", withArgumentsIn: [feedURL])
-			}
-		}
+		setPendingValues([column: value], for: feedURL)
 	}
 
 	// MARK: - Date
 
 	func setDate(_ value: Date?, for feedURL: String, column: Column) {
-		let name = column.rawValue
-		serialDispatchQueue.async {
-			if let value {
-				self.database.executeUpdate("UPDATE feedSettings SET \(name) = ? WHERE feedURL = ?;", withArgumentsIn: [value.timeIntervalSinceReferenceDate, feedURL])
-			} else {
-				self.database.executeUpdate("UPDATE feedSettings SET \(name) = NULL WHERE feedURL = ?;", withArgumentsIn: [feedURL])
-			}
-		}
+		setPendingValues([column: value?.timeIntervalSinceReferenceDate], for: feedURL)
 	}
 
 	// MARK: - Compound Types
 
 	func setConditionalGetInfo(_ info: HTTPConditionalGetInfo?, for feedURL: String) {
-		serialDispatchQueue.async {
-			if let info {
-				self.database.executeUpdate("UPDATE feedSettings SET conditionalGetInfoLastModified = ?, conditionalGetInfoEtag = ? WHERE feedURL = ?;", withArgumentsIn: [info.lastModified as Any, info.etag as Any, feedURL])
-			} else {
-				self.database.executeUpdate("UPDATE feedSettings SET conditionalGetInfoLastModified = NULL, conditionalGetInfoEtag = NULL WHERE feedURL = ?;", withArgumentsIn: [feedURL])
-			}
-		}
+		setPendingValues([.conditionalGetInfoLastModified: info?.lastModified, .conditionalGetInfoEtag: info?.etag], for: feedURL)
 	}
 
 	func setCacheControlInfo(_ info: CacheControlInfo?, for feedURL: String) {
-		serialDispatchQueue.async {
-			if let info {
-				self.database.executeUpdate("UPDATE feedSettings SET cacheControlInfoDateCreated = ?, cacheControlInfoMaxAge = ? WHERE feedURL = ?;", withArgumentsIn: [info.dateCreated.timeIntervalSinceReferenceDate, info.maxAge, feedURL])
-			} else {
-				self.database.executeUpdate("UPDATE feedSettings SET cacheControlInfoDateCreated = NULL, cacheControlInfoMaxAge = NULL WHERE feedURL = ?;", withArgumentsIn: [feedURL])
-			}
-		}
+		setPendingValues([.cacheControlInfoDateCreated: info?.dateCreated.timeIntervalSinceReferenceDate, .cacheControlInfoMaxAge: info?.maxAge], for: feedURL)
 	}
 
 	func setAuthors(_ authors: Set<Author>?, for feedURL: String) {
-		serialDispatchQueue.async {
-			if let authors {
-				let jsonString = authors.json()
-				self.database.executeUpdate("UPDATE feedSettings SET authors = ? WHERE feedURL = ?;", withArgumentsIn: [jsonString as Any, feedURL])
-			} else {
-				self.database.executeUpdate("UPDATE feedSettings SET authors = NULL WHERE feedURL = ?;", withArgumentsIn: [feedURL])
-			}
-		}
+		setPendingValues([.authors: authors?.json()], for: feedURL)
 	}
 
 	func setFolderRelationship(_ relationship: [String: String]?, for feedURL: String) {
-		serialDispatchQueue.async {
-			if let relationship {
-				if let data = try? JSONSerialization.data(withJSONObject: relationship), let jsonString = String(data: data, encoding: .utf8) {
-					self.database.executeUpdate("UPDATE feedSettings SET folderRelationship = ? WHERE feedURL = ?;", withArgumentsIn: [jsonString, feedURL])
-				}
-			} else {
-				self.database.executeUpdate("UPDATE feedSettings SET folderRelationship = NULL WHERE feedURL = ?;", withArgumentsIn: [feedURL])
+		var jsonString: String?
+		if let relationship {
+			guard let data = try? JSONSerialization.data(withJSONObject: relationship), let s = String(data: data, encoding: .utf8) else {
+				return
 			}
+			jsonString = s
 		}
+		setPendingValues([.folderRelationship: jsonString], for: feedURL)
 	}
 
 	// MARK: - Deletion
 
 	func deleteSettings(for feedURL: String) {
+		pendingChanges.withLock { pendingChanges in
+			pendingChanges.feedURLsToDelete.insert(feedURL)
+			pendingChanges.feedIDsToInsert[feedURL] = nil
+			pendingChanges.columnValues[feedURL] = nil
+		}
 		serialDispatchQueue.async {
-			self.database.executeUpdate("DELETE FROM feedSettings WHERE feedURL = ?;", withArgumentsIn: [feedURL])
+			self.writePendingChangesOnQueue()
 		}
 	}
 
@@ -253,9 +283,11 @@ final class FeedSettingsDatabase: Sendable {
 
 		let feedURLsArray = Array(feedURLs)
 		serialDispatchQueue.async {
+			self.writePendingChangesOnQueue()
 			let placeholders = NSString.rs_SQLValueList(withPlaceholders: UInt(feedURLsArray.count))!
 			let sql = "DELETE FROM feedSettings WHERE feedURL NOT IN \(placeholders);"
 			self.database.executeUpdate(sql, withArgumentsIn: feedURLsArray)
+			self.didCommit()
 
 			#if DEBUG
 			let numberOfRowChanges: Int32 = self.database.changes()
@@ -271,6 +303,82 @@ final class FeedSettingsDatabase: Sendable {
 
 private extension FeedSettingsDatabase {
 
+	// MARK: - Write-Behind
+
+	func setPendingValues(_ values: [Column: (any Sendable)?], for feedURL: String) {
+		let shouldScheduleWrite = pendingChanges.withLock { pendingChanges in
+			pendingChanges.columnValues[feedURL, default: [:]].merge(values) { _, new in new }
+			if pendingChanges.isWriteScheduled {
+				return false
+			}
+			pendingChanges.isWriteScheduled = true
+			return true
+		}
+
+		if shouldScheduleWrite {
+			serialDispatchQueue.asyncAfter(deadline: .now() + Self.writeDelay) {
+				self.writePendingChangesOnQueue()
+			}
+		}
+	}
+
+	/// Must be called on the serial queue. Every other queued operation calls this
+	/// first, so reads see pending changes.
+	///
+	/// Deletions, then row creations, then column updates: a feed’s pending
+	/// entries were all made after its last deletion (which dropped the ones
+	/// before it), and an update needs its row to exist.
+	func writePendingChangesOnQueue() {
+		let changes = pendingChanges.withLock { pendingChanges in
+			let changes = pendingChanges
+			pendingChanges = PendingChanges()
+			return changes
+		}
+		guard !changes.isEmpty else {
+			return
+		}
+
+		// Already in a transaction when called from inside `inTransaction`.
+		let ownsTransaction = !database.inTransaction()
+		if ownsTransaction {
+			database.beginTransaction()
+		}
+
+		for feedURL in changes.feedURLsToDelete {
+			database.executeUpdate("DELETE FROM feedSettings WHERE feedURL = ?;", withArgumentsIn: [feedURL])
+		}
+		for (feedURL, feedID) in changes.feedIDsToInsert {
+			database.executeUpdate("INSERT OR IGNORE INTO feedSettings (feedURL, feedID) VALUES (?, ?);", withArgumentsIn: [feedURL, feedID])
+		}
+		for (feedURL, values) in changes.columnValues {
+			// Sorted so that the SQL — and its cached statement — is the same for the same set of columns.
+			let columns = values.keys.sorted { $0.rawValue < $1.rawValue }
+			let assignments = columns.map { "\($0.rawValue) = ?" }.joined(separator: ", ")
+			var arguments = [Any]()
+			for column in columns {
+				if let value = values[column]! {
+					arguments.append(value)
+				} else {
+					arguments.append(NSNull())
+				}
+			}
+			arguments.append(feedURL)
+			database.executeUpdate("UPDATE feedSettings SET \(assignments) WHERE feedURL = ?;", withArgumentsIn: arguments)
+		}
+
+		if ownsTransaction {
+			database.commit()
+			didCommit()
+		}
+	}
+
+	/// Call after each write that commits — a transaction, or a statement outside one.
+	func didCommit() {
+		if !database.inTransaction() {
+			commits.withLock { $0 += 1 }
+		}
+	}
+
 	static let tableCreationStatements = """
 	CREATE TABLE IF NOT EXISTS feedSettings (feedURL TEXT PRIMARY KEY, feedID TEXT NOT NULL DEFAULT '', homePageURL TEXT, iconURL TEXT, faviconURL TEXT, editedName TEXT, contentHash TEXT, newArticleNotificationsEnabled INTEGER NOT NULL DEFAULT 0, readerViewAlwaysEnabled INTEGER NOT NULL DEFAULT 0, authors TEXT, conditionalGetInfoLastModified TEXT, conditionalGetInfoEtag TEXT, conditionalGetInfoDate REAL, cacheControlInfoDateCreated REAL, cacheControlInfoMaxAge REAL, externalID TEXT, folderRelationship TEXT, lastCheckDate REAL, lastResponseCode INTEGER);
 	"""
@@ -940,23 +940,16 @@ private extension FeedbinAccountDelegate {
 	}
 
 	func processEntries(account: Account, entries: [FeedbinEntry]?) async {
-		let parsedItems = mapEntriesToParsedItems(entries: entries)
-		let feedIDsAndItems = Dictionary(grouping: parsedItems, by: { item in item.feedURL }).mapValues { Set($0) }
+		guard let entries else {
+			return
+		}
+		let feedIDsAndItems = await ParsedItemMapping.parsedItemsByFeedID(entries, service: "Feedbin") { Self.parsedItem(entry: $0) }
 		await account.updateAsync(feedIDsAndItems: feedIDsAndItems, defaultRead: true)
 	}
 
-	func mapEntriesToParsedItems(entries: [FeedbinEntry]?) -> Set<ParsedItem> {
-		guard let entries = entries else {
-			return Set<ParsedItem>()
-		}
-
-		let parsedItems: [ParsedItem] = entries.map { entry in
-			let authors = Set([ParsedAuthor(name: entry.authorName, url: entry.jsonFeed?.jsonFeedAuthor?.url, avatarURL: entry.jsonFeed?.jsonFeedAuthor?.avatarURL, emailAddress: nil)])
-			return ParsedItem(syncServiceID: String(entry.articleID), uniqueID: String(entry.articleID), feedURL: String(entry.feedID), url: entry.url, externalURL: entry.jsonFeed?.jsonFeedExternalURL, title: entry.title, language: nil, contentHTML: entry.contentHTML, contentText: nil, markdown: nil, summary: entry.summary, imageURL: nil, bannerImageURL: nil, datePublished: entry.parsedDatePublished, dateModified: nil, authors: authors, tags: nil, attachments: nil)
-		}
-
-		return Set(parsedItems)
-
+	nonisolated static func parsedItem(entry: FeedbinEntry) -> ParsedItem? {
+		let authors = Set([ParsedAuthor(name: entry.authorName, url: entry.jsonFeed?.jsonFeedAuthor?.url, avatarURL: entry.jsonFeed?.jsonFeedAuthor?.avatarURL, emailAddress: nil)])
+		return ParsedItem(syncServiceID: String(entry.articleID), uniqueID: String(entry.articleID), feedURL: String(entry.feedID), url: entry.url, externalURL: entry.jsonFeed?.jsonFeedExternalURL, title: entry.title, language: nil, contentHTML: entry.contentHTML, contentText: nil, markdown: nil, summary: entry.summary, imageURL: nil, bannerImageURL: nil, datePublished: entry.parsedDatePublished, dateModified: nil, authors: authors, tags: nil, attachments: nil)
 	}
 
 	func syncArticleReadState(account: Account, articleIDs: [Int]?) async -> Int {
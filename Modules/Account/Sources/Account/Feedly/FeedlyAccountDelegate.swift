@@ -1207,8 +1207,9 @@ private extension FeedlyAccountDelegate {
 	/// Ingest entries, reporting the new-article count and which of the new articles are unread on the server.
 	@discardableResult
 	func ingest(entries: [FeedlyEntry], into account: Account) async -> IngestResult {
-		let parsedItems = entries.compactMap { FeedlyEntryParser(entry: $0).parsedItemRepresentation }
-		let feedIDsAndItems = Dictionary(grouping: parsedItems, by: { $0.feedURL }).mapValues { Set($0) }
+		let feedIDsAndItems = await ParsedItemMapping.parsedItemsByFeedID(entries, service: "Feedly") { entry in
+			FeedlyEntryParser(entry: entry).parsedItemRepresentation
+		}
 		let changes = await account.updateAsync(feedIDsAndItems: feedIDsAndItems, defaultRead: true)
 
 		let newArticleIDs = Set(changes.new?.map { $0.articleID } ?? [])
@@ -52,6 +52,7 @@ public final class Folder: SidebarItem, Renamable, Container, Hashable {
 		didSet {
 			if unreadCount != oldValue {
 				postUnreadCountDidChangeNotification()
+				UnreadCountAggregator.shared.folderUnreadCountDidChange(self)
 			}
 		}
 	}
@@ -83,25 +84,19 @@ public final class Folder: SidebarItem, Renamable, Container, Hashable {
 		Folder.incrementingID += 1
 		self.folderID = folderID
 
-		NotificationCenter.default.addObserver(self, selector: #selector(unreadCountDidChange(_:)), name: .UnreadCountDidChange, object: nil)
 		NotificationCenter.default.addObserver(self, selector: #selector(childrenDidChange(_:)), name: .ChildrenDidChange, object: self)
 	}
 
 	// MARK: - Notifications
 
-	@objc func unreadCountDidChange(_ note: Notification) {
-		if let object = note.object {
-			if objectIsChild(object as AnyObject) {
-				CoalescingQueue.standard.add(self, #selector(updateUnreadCount))
-			}
-		}
-	}
-
 	@objc func childrenDidChange(_ note: Notification) {
 		updateUnreadCount()
 	}
 
-	@objc func updateUnreadCount() {
+	// Recount when feeds are added or removed. Changes to the feeds’
+	// own counts are applied as deltas by UnreadCountAggregator.
+	func updateUnreadCount() {
+		UnreadCountAggregator.shared.flush()
 		var updatedUnreadCount = 0
 		for feed in topLevelFeeds {
 			updatedUnreadCount += feed.unreadCount
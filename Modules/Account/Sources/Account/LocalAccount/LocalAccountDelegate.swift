@@ -7,6 +7,7 @@
 //
 
 import Foundation
+import os
 import RSCore
 import RSParser
 import Articles
@@ -33,6 +34,8 @@ import Secrets
 	var credentials: Credentials?
 	var accountSettings: AccountSettings?
 
+	private static let logger = Logger(subsystem: Logger.nnwSubsystem, category: "LocalAccountDelegate")
+
 	private lazy var refresher: LocalAccountRefresher = {
 		let refresher = LocalAccountRefresher()
 		refresher.delegate = self
@@ -52,9 +55,13 @@ import Secrets
 		}
 
 		let feeds = account.flattenedFeeds()
+		let feedSettingsCommitCount = account.feedSettingsCommitCount
 		refresher.accountID = account.accountID
 		await refresher.refreshFeeds(feeds)
+		account.writePendingFeedSettings()
 		account.lastRefreshCompletedDate = Date()
+
+		Self.logger.info("LocalAccountDelegate: refreshed \(feeds.count, privacy: .public) feeds with \(account.feedSettingsCommitCount - feedSettingsCommitCount, privacy: .public) feed settings commits")
 	}
 
 	@MainActor func syncArticleStatus() async throws -> Bool {
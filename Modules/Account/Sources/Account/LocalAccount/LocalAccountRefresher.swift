@@ -53,6 +53,16 @@ import os
 		return parts.joined(separator: ", ")
 	}
 
+	/// True once downloads are done and every downloaded feed has been parsed
+	/// and saved. `refreshFeeds` returns when downloads finish, which can be before that.
+	var isRefreshComplete: Bool {
+		downloadSessionIsComplete && outstandingParseTasks == 0
+	}
+
+	/// Stage timings for the most recent finished refresh. Also added to
+	/// `RefreshTelemetry.shared`.
+	private(set) var lastRefreshMetrics: RefreshMetrics?
+
 	private var refreshActivityID: Int?
 	private var feedsTotal = 0
 	private var feedsSkipped = 0
@@ -61,6 +71,9 @@ import os
 	private var updatedArticlesCount = 0
 	private var outstandingParseTasks = 0
 	private var downloadSessionIsComplete = false
+	private var feedMetrics = [String: FeedRefreshMetrics]() // feed URL: metrics
+	private var refreshStartDate: Date?
+	private var refreshSignpostState: OSSignpostIntervalState?
 
 	private var completion: (() -> Void)?
 	private var isSuspended = false
@@ -74,6 +87,7 @@ import os
 	private var urlToFeedDictionary = [String: Feed]()
 
 	private static let logger = Logger(subsystem: Logger.nnwSubsystem, category: "LocalAccountRefresher")
+	private static let signposter = OSSignposter(subsystem: Logger.nnwSubsystem, category: .pointsOfInterest)
 
 	@MainActor public func refreshFeeds(_ feeds: Set<Feed>) async {
 		await withCheckedContinuation { continuation in
@@ -108,6 +122,9 @@ import os
 		updatedArticlesCount = 0
 		outstandingParseTasks = 0
 		downloadSessionIsComplete = false
+		feedMetrics.removeAll()
+		refreshStartDate = Date()
+		refreshSignpostState = Self.signposter.beginInterval("Refresh", id: Self.signposter.makeSignpostID(), "\(filteredFeeds.count) feeds")
 
 		// Create a pending activity for each feed that will be fetched,
 		// to be completed later by the DownloadSessionDelegate callbacks.
@@ -221,6 +238,13 @@ import os
 		ActivityLog.shared.logCompletedActivity(owner: owner, kind: .followFeedRedirect, detail: detail, message: "\(statusCode) \(HTTPURLResponse.localizedString(forStatusCode: statusCode)): \(fromURL.absoluteString) → \(toURL.absoluteString)")
 	}
 
+	func downloadSession(_ downloadSession: DownloadSession, didCollect metrics: DownloadMetrics, url: URL) {
+		guard let feed = urlToFeedDictionary[url.absoluteString] else {
+			return
+		}
+		updateMetrics(feed) { $0.download = metrics }
+	}
+
 	func downloadSession(_ downloadSession: DownloadSession, didSkip url: URL, reason: String) {
 		guard let owner = activityOwner else {
 			return
@@ -244,6 +268,11 @@ import os
 
 		let activityKind = ActivityKind.refreshFeedContent(feedURL: feed.url)
 
+		updateMetrics(feed) { metrics in
+			metrics.statusCode = (response as? HTTPURLResponse)?.statusCode
+			metrics.downloadedBytes = data.count
+		}
+
 		if let error {
 			reportFeedRefreshError(feed: feed, error: error, activityKind: activityKind)
 			return
@@ -275,6 +304,7 @@ import os
 
 		guard statusIsOK else {
 			// 304 Not Modified
+			updateMetrics(feed) { $0.outcome = .notModified }
 			if let activityOwner {
 				ActivityLog.shared.didComplete(activityOwner, kind: activityKind, message: "304 Not Modified", durationIsSignificant: false)
 			}
@@ -289,6 +319,7 @@ import os
 		let dataHash = data.md5String
 		let dataSizeMessage = ActivityLog.dataSizeMessage(data)
 		if dataHash == feed.contentHash {
+			updateMetrics(feed) { $0.outcome = .unchanged }
 			if let activityOwner {
 				ActivityLog.shared.didComplete(activityOwner, kind: activityKind, message: "\(dataSizeMessage), content unchanged")
 			}
@@ -306,8 +337,18 @@ import os
 
 			let parserData = ParserData(url: feed.url, data: data)
 			let parsedFeed: ParsedFeed
+			let parseSignpostState = Self.signposter.beginInterval("Parse feed", id: Self.signposter.makeSignpostID(), "\(url.absoluteString, privacy: .public)")
 			do {
-				guard let result = try await FeedParser.parse(parserData) else {
+				let (result, timing) = try await FeedParser.timedParse(parserData)
+				Self.signposter.endInterval("Parse feed", parseSignpostState, "\(result?.items.count ?? 0) items")
+				self.updateMetrics(feed) { metrics in
+					metrics.parseQueueWaitMilliseconds = timing.queueWaitMilliseconds
+					metrics.parseMilliseconds = timing.parseMilliseconds
+					metrics.parseCPUMilliseconds = timing.parseCPUMilliseconds
+					metrics.itemsParsed = result?.items.count
+				}
+				guard let result else {
+					self.updateMetrics(feed) { $0.outcome = .notAFeed }
 					if let activityOwner {
 						ActivityLog.shared.didComplete(activityOwner, kind: activityKind, message: dataSizeMessage)
 					}
@@ -315,6 +356,8 @@ import os
 				}
 				parsedFeed = result
 			} catch {
+				Self.signposter.endInterval("Parse feed", parseSignpostState, "error")
+				self.updateMetrics(feed) { $0.outcome = .failed }
 				Self.logger.error("LocalAccountRefresher: feed parse error for \(url.absoluteString): \(error.localizedDescription)")
 				if let activityOwner {
 					ActivityLog.shared.didFail(activityOwner, kind: activityKind, error: error)
@@ -334,10 +377,22 @@ import os
 			}
 
 			assert(Thread.isMainThread)
+			let saveSignpostState = Self.signposter.beginInterval("Save articles", id: Self.signposter.makeSignpostID(), "\(url.absoluteString, privacy: .public)")
 			let articleChanges = await account.updateAsync(feed: feed, parsedFeed: parsedFeed)
+			Self.signposter.endInterval("Save articles", saveSignpostState)
 
 			self.newArticlesCount += articleChanges.new?.count ?? 0
 			self.updatedArticlesCount += articleChanges.updated?.count ?? 0
+			self.updateMetrics(feed) { metrics in
+				metrics.outcome = .updated
+				metrics.databaseQueueWaitMilliseconds = articleChanges.timing?.queueWaitMilliseconds
+				metrics.diffMilliseconds = articleChanges.timing?.diffMilliseconds
+				metrics.writeMilliseconds = articleChanges.timing?.writeMilliseconds
+				metrics.diffCPUMilliseconds = articleChanges.timing?.diffCPUMilliseconds
+				metrics.writeCPUMilliseconds = articleChanges.timing?.writeCPUMilliseconds
+				metrics.newArticles = articleChanges.new?.count ?? 0
+				metrics.updatedArticles = articleChanges.updated?.count ?? 0
+			}
 
 			Self.logger.debug("LocalAccountRefresher: setting contentHash for \(url.absoluteString)")
 			feed.contentHash = dataHash
@@ -357,6 +412,10 @@ import os
 
 		feed.lastCheckDate = Date()
 		feed.lastResponseCode = statusCode
+		updateMetrics(feed) { metrics in
+			metrics.statusCode = statusCode
+			metrics.outcome = .failed
+		}
 
 		let webserviceError = WebserviceError.httpError(status: statusCode)
 		let statusDescription = webserviceError.localizedDescription
@@ -375,6 +434,7 @@ import os
 	}
 
 	private func reportFeedRefreshError(feed: Feed, error: Error, activityKind: ActivityKind) {
+		updateMetrics(feed) { $0.outcome = .failed }
 		if let activityOwner {
 			ActivityLog.shared.didFail(activityOwner, kind: activityKind, error: error)
 		}
@@ -418,6 +478,8 @@ import os
 		guard downloadSessionIsComplete && outstandingParseTasks == 0 else {
 			return
 		}
+		finishRefreshMetrics()
+
 		guard let refreshActivityID else {
 			return
 		}
@@ -449,6 +511,34 @@ import os
 
 }
 
+// MARK: - Telemetry
+
+@MainActor private extension LocalAccountRefresher {
+
+	func updateMetrics(_ feed: Feed, _ update: (inout FeedRefreshMetrics) -> Void) {
+		update(&feedMetrics[feed.url, default: FeedRefreshMetrics(feedURL: feed.url)])
+	}
+
+	/// Called when the refresh is complete — the first time only.
+	func finishRefreshMetrics() {
+		guard let refreshStartDate else {
+			return
+		}
+		self.refreshStartDate = nil
+
+		if let refreshSignpostState {
+			Self.signposter.endInterval("Refresh", refreshSignpostState, "\(self.refreshStatsMessage, privacy: .public)")
+			self.refreshSignpostState = nil
+		}
+
+		let durationMilliseconds = Date().timeIntervalSince(refreshStartDate) * 1000
+		let refreshMetrics = RefreshMetrics(accountID: accountID, startDate: refreshStartDate, durationMilliseconds: durationMilliseconds, feedsSkipped: feedsSkipped, feeds: Array(feedMetrics.values))
+		feedMetrics.removeAll()
+		lastRefreshMetrics = refreshMetrics
+		RefreshTelemetry.shared.add(refreshMetrics)
+	}
+}
+
 // MARK: - Private
 
 private extension LocalAccountRefresher {
@@ -0,0 +1,222 @@
+//
+//  RefreshTelemetry.swift
+//  Account
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import RSDatabase
+import RSWeb
+
+/// A step in refreshing one feed, in the order they happen.
+public enum RefreshStage: String, CaseIterable, Codable, CodingKeyRepresentable, Sendable {
+	case domainLookup
+	case connect
+	case secureConnection
+	case timeToFirstByte
+	case transfer
+	case parseQueueWait
+	case parse
+	case databaseQueueWait
+	case diff
+	case write
+}
+
+/// Count, total, and percentiles for one `RefreshStage`. Percentiles
+/// come from a `LatencyHistogram`, so they’re within a factor of two.
+public struct RefreshStageSummary: Codable, Sendable {
+
+	public let count: Int
+	public let totalMilliseconds: Double
+	public let p50Milliseconds: Double
+	public let p95Milliseconds: Double
+	public let p99Milliseconds: Double
+	public let maximumMilliseconds: Double
+
+	init(_ histogram: LatencyHistogram) {
+		self.count = histogram.count
+		self.totalMilliseconds = histogram.totalMilliseconds
+		self.p50Milliseconds = histogram.percentileMilliseconds(0.5)
+		self.p95Milliseconds = histogram.percentileMilliseconds(0.95)
+		self.p99Milliseconds = histogram.percentileMilliseconds(0.99)
+		self.maximumMilliseconds = histogram.maximumMilliseconds
+	}
+}
+
+/// What happened to one feed during a refresh, and where its time went.
+/// Stages that didn’t happen — parsing a 304, say — are nil.
+public struct FeedRefreshMetrics: Codable, Sendable {
+
+	public enum Outcome: String, Codable, Sendable {
+		/// Parsed and saved.
+		case updated
+		case notModified
+		/// Downloaded, but the same bytes as last time, so not parsed.
+		case unchanged
+		/// Parsed, but not a feed.
+		case notAFeed
+		case failed
+	}
+
+	public let feedURL: String
+	public internal(set) var outcome: Outcome?
+	public internal(set) var statusCode: Int?
+	/// The size of the response body. Bytes written to the database aren’t recorded.
+	public internal(set) var downloadedBytes = 0
+	public internal(set) var download: DownloadMetrics?
+	public internal(set) var parseQueueWaitMilliseconds: Double?
+	public internal(set) var parseMilliseconds: Double?
+	public internal(set) var itemsParsed: Int?
+	public internal(set) var databaseQueueWaitMilliseconds: Double?
+	public internal(set) var diffMilliseconds: Double?
+	public internal(set) var writeMilliseconds: Double?
+	/// Thread CPU time for the stages that run on one thread, start to finish.
+	public internal(set) var parseCPUMilliseconds: Double?
+	public internal(set) var diffCPUMilliseconds: Double?
+	public internal(set) var writeCPUMilliseconds: Double?
+	public internal(set) var newArticles = 0
+	public internal(set) var updatedArticles = 0
+
+	init(feedURL: String) {
+		self.feedURL = feedURL
+	}
+
+	func milliseconds(_ stage: RefreshStage) -> Double? {
+		switch stage {
+		case .domainLookup:
+			return download?.domainLookupMilliseconds
+		case .connect:
+			return download?.connectMilliseconds
+		case .secureConnection:
+			return download?.secureConnectionMilliseconds
+		case .timeToFirstByte:
+			return download?.timeToFirstByteMilliseconds
+		case .transfer:
+			return download?.transferMilliseconds
+		case .parseQueueWait:
+			return parseQueueWaitMilliseconds
+		case .parse:
+			return parseMilliseconds
+		case .databaseQueueWait:
+			return databaseQueueWaitMilliseconds
+		case .diff:
+			return diffMilliseconds
+		case .write:
+			return writeMilliseconds
+		}
+	}
+
+	func cpuMilliseconds(_ stage: RefreshStage) -> Double? {
+		switch stage {
+		case .parse:
+			return parseCPUMilliseconds
+		case .diff:
+			return diffCPUMilliseconds
+		case .write:
+			return writeCPUMilliseconds
+		default:
+			return nil
+		}
+	}
+}
+
+/// One refresh of an account’s feeds.
+public struct RefreshMetrics: Codable, Sendable {
+
+	public let accountID: String?
+	public let startDate: Date
+	public let durationMilliseconds: Double
+	public let feedsSkipped: Int
+	/// Feeds that were downloaded, or tried to be, sorted by URL.
+	public let feeds: [FeedRefreshMetrics]
+	public let stages: [RefreshStage: RefreshStageSummary]
+	/// CPU time for parse, diff, and write.
+	public let cpuStages: [RefreshStage: RefreshStageSummary]
+
+	public var downloadedBytes: Int {
+		feeds.reduce(0) { $0 + $1.downloadedBytes }
+	}
+
+	public var itemsParsed: Int {
+		feeds.reduce(0) { $0 + ($1.itemsParsed ?? 0) }
+	}
+
+	init(accountID: String?, startDate: Date, durationMilliseconds: Double, feedsSkipped: Int, feeds: [FeedRefreshMetrics]) {
+		self.accountID = accountID
+		self.startDate = startDate
+		self.durationMilliseconds = durationMilliseconds
+		self.feedsSkipped = feedsSkipped
+		self.feeds = feeds.sorted { $0.feedURL < $1.feedURL }
+
+		var histograms = [RefreshStage: LatencyHistogram]()
+		Self.record(feeds, &histograms)
+		self.stages = histograms.mapValues { RefreshStageSummary($0) }
+
+		var cpuHistograms = [RefreshStage: LatencyHistogram]()
+		Self.record(feeds, &cpuHistograms, milliseconds: { $0.cpuMilliseconds($1) })
+		self.cpuStages = cpuHistograms.mapValues { RefreshStageSummary($0) }
+	}
+
+	static func record(_ feeds: [FeedRefreshMetrics], _ histograms: inout [RefreshStage: LatencyHistogram], milliseconds: (FeedRefreshMetrics, RefreshStage) -> Double? = { $0.milliseconds($1) }) {
+		for feed in feeds {
+			for stage in RefreshStage.allCases {
+				if let milliseconds = milliseconds(feed, stage) {
+					histograms[stage, default: LatencyHistogram()].record(nanoseconds: UInt64(max(0, milliseconds) * 1_000_000))
+				}
+			}
+		}
+	}
+}
+
+/// Refresh stage timings across every `LocalAccountRefresher`, since launch
+/// or the last `reset()` — plus the most recent refreshes, feed by feed.
+/// Each stage is also marked with a signpost (Points of Interest in Instruments).
+@MainActor public final class RefreshTelemetry {
+
+	public static let shared = RefreshTelemetry()
+
+	public struct Report: Codable, Sendable {
+		public let startDate: Date
+		public let refreshCount: Int
+		public let stages: [RefreshStage: RefreshStageSummary]
+		/// Oldest first.
+		public let recentRefreshes: [RefreshMetrics]
+	}
+
+	/// Oldest first.
+	public private(set) var recentRefreshes = [RefreshMetrics]()
+
+	private var startDate = Date()
+	private var refreshCount = 0
+	private var histograms = [RefreshStage: LatencyHistogram]()
+
+	private static let maximumRecentRefreshes = 10
+
+	public var report: Report {
+		Report(startDate: startDate, refreshCount: refreshCount, stages: histograms.mapValues { RefreshStageSummary($0) }, recentRefreshes: recentRefreshes)
+	}
+
+	public func jsonData() throws -> Data {
+		let encoder = JSONEncoder()
+		encoder.outputFormatting = [.prettyPrinted, .sortedKeys]
+		encoder.dateEncodingStrategy = .iso8601
+		return try encoder.encode(report)
+	}
+
+	public func reset() {
+		startDate = Date()
+		refreshCount = 0
+		histograms.removeAll()
+		recentRefreshes.removeAll()
+	}
+
+	func add(_ refresh: RefreshMetrics) {
+		refreshCount += 1
+		RefreshMetrics.record(refresh.feeds, &histograms)
+		recentRefreshes.append(refresh)
+		if recentRefreshes.count > Self.maximumRecentRefreshes {
+			recentRefreshes.removeFirst(recentRefreshes.count - Self.maximumRecentRefreshes)
+		}
+	}
+}
@@ -19,13 +19,16 @@ final class OPMLNormalizer {
 		return opmlNormalizer.normalizedOPMLItems
 	}
 
+	// Duplicates are found with sets of feed URLs rather than by searching
+	// arrays — imported files can have thousands of feeds.
 	private func normalize(_ items: [OPMLItem], parentFolder: OPMLItem? = nil) {
 		var feedsToAdd = [OPMLItem]()
+		var feedURLsToAdd = Set<String>()
 
 		for item in items {
 
-			if item.feedSpecifier != nil {
-				if !feedsToAdd.contains(where: { $0.feedSpecifier?.feedURL == item.feedSpecifier?.feedURL }) {
+			if let feedURL = item.feedSpecifier?.feedURL {
+				if feedURLsToAdd.insert(feedURL).inserted {
 					feedsToAdd.append(item)
 				}
 				continue
@@ -50,17 +53,16 @@ final class OPMLNormalizer {
 		}
 
 		if let parentFolder = parentFolder {
+			// Subfolders aren’t supported: their feeds were flattened into parentFolder above,
+			// and the subfolders themselves are dropped.
+			var existingFeedURLs = Set(parentFolder.children?.compactMap { $0.feedSpecifier?.feedURL } ?? [])
 			for feed in feedsToAdd {
-				if !(parentFolder.children?.contains(where: { $0.feedSpecifier?.feedURL == feed.feedSpecifier?.feedURL}) ?? false) {
+				if let feedURL = feed.feedSpecifier?.feedURL, existingFeedURLs.insert(feedURL).inserted {
 					parentFolder.addChild(feed)
 				}
 			}
 		} else {
-			for feed in feedsToAdd {
-				normalizedOPMLItems.append(feed)
-			}
+			normalizedOPMLItems.append(contentsOf: feedsToAdd)
 		}
-
 	}
-
 }
@@ -0,0 +1,47 @@
+//
+//  ParsedItemMapping.swift
+//  Account
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import os
+import RSCore
+import RSParser
+
+/// Turns a page of decoded sync-service entries into parsed items grouped by
+/// feed ID, off the main actor.
+///
+/// A sync page can hold hundreds of full article bodies. The JSON is already
+/// decoded off the main actor (see `URLSession.send(request:resultType:)`);
+/// this keeps the mapping and hashing that follow off it too.
+nonisolated enum ParsedItemMapping {
+
+	private static let logger = Logger(subsystem: Logger.nnwSubsystem, category: "ParsedItemMapping")
+	private static let signposter = OSSignposter(subsystem: Logger.nnwSubsystem, category: .pointsOfInterest)
+
+	/// Maps and groups in a single pass, without building an array or set
+	/// of the whole page first. Entries that map to nil are skipped.
+	@concurrent
+	static func parsedItemsByFeedID<Entry: Sendable>(_ entries: [Entry], service: String, _ parsedItem: @Sendable (Entry) -> ParsedItem?) async -> [String: Set<ParsedItem>] {
+		assert(!Thread.isMainThread, "Mapping entries should not happen on the main thread.")
+
+		let signpostState = signposter.beginInterval("Map Entries", id: signposter.makeSignpostID(), "\(service, privacy: .public)")
+		let startTime = Date()
+
+		var feedIDsAndItems = [String: Set<ParsedItem>]()
+		for entry in entries {
+			guard let item = parsedItem(entry) else {
+				continue
+			}
+			feedIDsAndItems[item.feedURL, default: Set<ParsedItem>()].insert(item)
+		}
+
+		signposter.endInterval("Map Entries", signpostState)
+		let milliseconds = Date().timeIntervalSince(startTime) * 1000
+		logger.debug("ParsedItemMapping: \(service, privacy: .public) — mapped \(entries.count) entries in \(milliseconds, format: .fixed(precision: 1), privacy: .public) ms")
+
+		return feedIDsAndItems
+	}
+}
@@ -1108,55 +1108,50 @@ private extension ReaderAPIAccountDelegate {
 	}
 
 	func processEntries(account: Account, entries: [ReaderAPIEntry]?) async {
-		Self.logger.debug("ReaderAPIAccountDelegate: processEntries")
+		Self.logger.debug("ReaderAPIAccountDelegate: processEntries — entries.count \(entries?.count ?? 0)")
 
-		let parsedItems = mapEntriesToParsedItems(account: account, entries: entries)
-		let feedIDsAndItems = Dictionary(grouping: parsedItems, by: { item in item.feedURL }).mapValues { Set($0) }
+		guard let entries else {
+			return
+		}
+
+		let variant = self.variant
+		let feedIDsAndItems = await ParsedItemMapping.parsedItemsByFeedID(entries, service: "ReaderAPI") { entry in
+			Self.parsedItem(entry: entry, variant: variant)
+		}
 
 		await account.updateAsync(feedIDsAndItems: feedIDsAndItems, defaultRead: true)
 	}
 
-	func mapEntriesToParsedItems(account: Account, entries: [ReaderAPIEntry]?) -> Set<ParsedItem> {
-		Self.logger.debug("ReaderAPIAccountDelegate: mapEntriesToParsedItems — entries.count \(entries?.count ?? 0)")
-
-		guard let entries = entries else {
-			return Set<ParsedItem>()
+	nonisolated static func parsedItem(entry: ReaderAPIEntry, variant: ReaderAPIVariant) -> ParsedItem? {
+		guard let streamID = entry.origin.streamId else {
+			return nil
 		}
 
-		let parsedItems: [ParsedItem] = entries.compactMap { entry in
-			guard let streamID = entry.origin.streamId else {
+		var authors: Set<ParsedAuthor>? {
+			guard let name = entry.author else {
 				return nil
 			}
-
-			var authors: Set<ParsedAuthor>? {
-				guard let name = entry.author else {
-					return nil
-				}
-				return Set([ParsedAuthor(name: name.decodingFullwidthEscapedCharacters, url: nil, avatarURL: nil, emailAddress: nil)])
-			}
-
-			return ParsedItem(syncServiceID: entry.uniqueID(variant: variant),
-							  uniqueID: entry.uniqueID(variant: variant),
-							  feedURL: streamID,
-							  url: nil,
-							  externalURL: entry.alternates?.first?.url,
-							  title: entry.title?.decodingFullwidthEscapedCharacters,
-							  language: nil,
-							  contentHTML: entry.summary.content,
-							  contentText: nil,
-							  markdown: nil,
-							  summary: entry.summary.content,
-							  imageURL: nil,
-							  bannerImageURL: nil,
-							  datePublished: entry.parseDatePublished(),
-							  dateModified: nil,
-							  authors: authors,
-							  tags: nil,
-							  attachments: nil)
-		}
-
-		return Set(parsedItems)
-
+			return Set([ParsedAuthor(name: name.decodingFullwidthEscapedCharacters, url: nil, avatarURL: nil, emailAddress: nil)])
+		}
+
+		return ParsedItem(syncServiceID: entry.uniqueID(variant: variant),
+						  uniqueID: entry.uniqueID(variant: variant),
+						  feedURL: streamID,
+						  url: nil,
+						  externalURL: entry.alternates?.first?.url,
+						  title: entry.title?.decodingFullwidthEscapedCharacters,
+						  language: nil,
+						  contentHTML: entry.summary.content,
+						  contentText: nil,
+						  markdown: nil,
+						  summary: entry.summary.content,
+						  imageURL: nil,
+						  bannerImageURL: nil,
+						  datePublished: entry.parseDatePublished(),
+						  dateModified: nil,
+						  authors: authors,
+						  tags: nil,
+						  attachments: nil)
 	}
 
 	func syncArticleReadState(account: Account, articleIDs: [String]?) async -> Int {
@@ -9,6 +9,7 @@
 import Foundation
 import Articles
 import ArticlesDatabase
+import RSDatabase
 
 public struct SingleArticleFetcher: ArticleFetcher {
 
@@ -35,4 +36,14 @@ public struct SingleArticleFetcher: ArticleFetcher {
 	public func fetchUnreadArticlesAsync() async -> Set<Article> {
 		await account.fetchArticlesAsync(.articleIDs(Set([articleID])))
 	}
+
+	// Fetches by articleID always run to completion.
+
+	public func fetchArticlesAsync(cancellationToken: DatabaseCancellationToken) async -> Set<Article> {
+		await fetchArticlesAsync()
+	}
+
+	public func fetchUnreadArticlesAsync(cancellationToken: DatabaseCancellationToken) async -> Set<Article> {
+		await fetchUnreadArticlesAsync()
+	}
 }
@@ -0,0 +1,88 @@
+//
+//  StartupProfiler.swift
+//  Account
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import os
+import RSCore
+
+/// Launch work for an account.
+///
+/// Critical-path phases run while the app launches, since the sidebar needs
+/// them. Deferred phases wait until the first timeline paint — see
+/// `AccountManager.runDeferredStartupWork()`.
+public enum StartupPhase: String, CaseIterable, Sendable {
+	case openDatabases
+	case loadSubscriptions
+	case fetchUnreadCounts
+	case pruneFeedSettings
+	case cleanupDatabase
+	case databaseHousekeeping
+
+	public var isDeferred: Bool {
+		switch self {
+		case .openDatabases, .loadSubscriptions, .fetchUnreadCounts:
+			return false
+		case .pruneFeedSettings, .cleanupDatabase, .databaseHousekeeping:
+			return true
+		}
+	}
+}
+
+/// Times the startup phases and marks each one with a signpost interval
+/// (Points of Interest in Instruments). Durations are summed across accounts.
+///
+/// Deferred phases mostly schedule background work, so their durations are
+/// the main-thread cost of starting that work, not of the work itself.
+@MainActor public final class StartupProfiler {
+
+	public static let shared = StartupProfiler()
+
+	public private(set) var durations = [StartupPhase: TimeInterval]()
+
+	/// Seconds from the first startup phase — opening the first account’s
+	/// databases — until every active account has its unread counts.
+	public private(set) var timeToUnreadCountsInitialized: TimeInterval?
+
+	private let startTime = Date()
+
+	private static let logger = Logger(subsystem: Logger.nnwSubsystem, category: "StartupProfiler")
+	private static let signposter = OSSignposter(subsystem: Logger.nnwSubsystem, category: .pointsOfInterest)
+
+	struct Interval {
+		let phase: StartupPhase
+		let startTime: Date
+		let signpostState: OSSignpostIntervalState
+	}
+
+	func measure<T>(_ phase: StartupPhase, _ work: () -> T) -> T {
+		let interval = begin(phase)
+		defer {
+			end(interval)
+		}
+		return work()
+	}
+
+	func begin(_ phase: StartupPhase) -> Interval {
+		let signpostState = Self.signposter.beginInterval("Startup Phase", id: Self.signposter.makeSignpostID(), "\(phase.rawValue, privacy: .public)")
+		return Interval(phase: phase, startTime: Date(), signpostState: signpostState)
+	}
+
+	func end(_ interval: Interval) {
+		Self.signposter.endInterval("Startup Phase", interval.signpostState)
+		durations[interval.phase, default: 0] += Date().timeIntervalSince(interval.startTime)
+	}
+
+	func unreadCountsDidInitialize() {
+		guard timeToUnreadCountsInitialized == nil else {
+			return
+		}
+		let elapsed = Date().timeIntervalSince(startTime)
+		timeToUnreadCountsInitialized = elapsed
+		Self.signposter.emitEvent("Unread Counts Initialized")
+		Self.logger.info("StartupProfiler: unread counts initialized \(elapsed, format: .fixed(precision: 3), privacy: .public) seconds after launch")
+	}
+}
@@ -0,0 +1,136 @@
+//
+//  UnreadCountAggregator.swift
+//  Account
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+
+/// Everything whose unread count changed during one run loop tick.
+public struct UnreadCountChangeSet {
+
+	public static let userInfoKey = "unreadCountChangeSet"
+
+	/// The net change in each feed’s unread count. Feeds that changed and
+	/// then changed back aren’t included.
+	public let feedDeltas: [Feed: Int]
+	public let folders: Set<Folder>
+	public let accounts: Set<Account>
+
+	public var feeds: Set<Feed> {
+		Set(feedDeltas.keys)
+	}
+
+	/// Feeds, folders, and accounts together — for reconfiguring sidebar rows.
+	public var unreadCountProviders: [AnyObject] {
+		Array(feedDeltas.keys) as [AnyObject] + Array(folders) as [AnyObject] + Array(accounts) as [AnyObject]
+	}
+}
+
+/// Keeps folder and account unread counts current from per-feed deltas,
+/// and publishes the changes as one `UnreadCountsDidChange` per run loop tick.
+///
+/// A sync can change thousands of feeds’ unread counts at once. Feeds
+/// don’t post a notification for each change — they report the delta here.
+/// Once per tick the deltas are summed into the totals of the folders and
+/// accounts that contain those feeds, each of which then posts its own
+/// `UnreadCountDidChange` once.
+@MainActor public final class UnreadCountAggregator {
+
+	public static let shared = UnreadCountAggregator()
+
+	private var pendingFeedDeltas = [Feed: Int]()
+	private var changedFolders = Set<Folder>()
+	private var changedAccounts = Set<Account>()
+	private var isFlushScheduled = false
+
+	func feedUnreadCountDidChange(_ feed: Feed, delta: Int) {
+		pendingFeedDeltas[feed, default: 0] += delta
+		scheduleFlush()
+	}
+
+	func folderUnreadCountDidChange(_ folder: Folder) {
+		changedFolders.insert(folder)
+		scheduleFlush()
+	}
+
+	func accountUnreadCountDidChange(_ account: Account) {
+		changedAccounts.insert(account)
+		scheduleFlush()
+	}
+
+	/// Applies pending feed deltas and publishes the change set now, instead
+	/// of at the end of the run loop tick. Call this before recounting a total
+	/// from scratch, so the deltas aren’t added again on top of the recount.
+	public func flush() {
+		let feedDeltas = pendingFeedDeltas.filter { $0.value != 0 }
+		pendingFeedDeltas.removeAll()
+		applyToContainers(feedDeltas)
+
+		guard !feedDeltas.isEmpty || !changedFolders.isEmpty || !changedAccounts.isEmpty else {
+			return
+		}
+
+		let changeSet = UnreadCountChangeSet(feedDeltas: feedDeltas, folders: changedFolders, accounts: changedAccounts)
+		changedFolders.removeAll()
+		changedAccounts.removeAll()
+		NotificationCenter.default.post(name: .UnreadCountsDidChange, object: self, userInfo: [UnreadCountChangeSet.userInfoKey: changeSet])
+	}
+}
+
+private extension UnreadCountAggregator {
+
+	func scheduleFlush() {
+		guard !isFlushScheduled else {
+			return
+		}
+		isFlushScheduled = true
+		DispatchQueue.main.async {
+			self.isFlushScheduled = false
+			self.flush()
+		}
+	}
+
+	func applyToContainers(_ feedDeltas: [Feed: Int]) {
+		var feedDeltasByAccount = [Account: [Feed: Int]]()
+		for (feed, delta) in feedDeltas {
+			// A feed that’s no longer in its account’s tree doesn’t count toward its totals.
+			guard let account = feed.account, account.flattenedFeeds().contains(feed) else {
+				continue
+			}
+			feedDeltasByAccount[account, default: [Feed: Int]()][feed] = delta
+		}
+
+		for (account, accountFeedDeltas) in feedDeltasByAccount {
+			for folder in account.folders ?? Set<Folder>() {
+				let folderDelta = Self.sumOfDeltas(accountFeedDeltas, for: folder.topLevelFeeds)
+				if folderDelta != 0 {
+					folder.unreadCount += folderDelta
+				}
+			}
+
+			let accountDelta = accountFeedDeltas.values.reduce(0, +)
+			if accountDelta != 0 {
+				account.unreadCount += accountDelta
+			}
+		}
+	}
+
+	/// Walks whichever is smaller — the deltas or the folder’s feeds —
+	/// so a few changes in a big folder, or many changes and a small
+	/// folder, are both cheap.
+	static func sumOfDeltas(_ feedDeltas: [Feed: Int], for feeds: Set<Feed>) -> Int {
+		var sum = 0
+		if feeds.count < feedDeltas.count {
+			for feed in feeds {
+				sum += feedDeltas[feed] ?? 0
+			}
+		} else {
+			for (feed, delta) in feedDeltas where feeds.contains(feed) {
+				sum += delta
+			}
+		}
+		return sum
+	}
+}
@@ -11,6 +11,11 @@ import Foundation
 public extension Notification.Name {
 	static let UnreadCountDidInitialize = Notification.Name("UnreadCountDidInitialize")
 	static let UnreadCountDidChange = Notification.Name(rawValue: "UnreadCountDidChange")
+
+	/// Posted by `UnreadCountAggregator` at most once per run loop tick, with an
+	/// `UnreadCountChangeSet` in `userInfo[UnreadCountChangeSet.userInfoKey]`.
+	/// Feeds post only this — not `UnreadCountDidChange`.
+	static let UnreadCountsDidChange = Notification.Name(rawValue: "UnreadCountsDidChange")
 }
 
 @MainActor public protocol UnreadCountProvider {
@@ -0,0 +1,93 @@
+//
+//  AccountStartupPerformanceTests.swift
+//  AccountTests
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import Testing
+import RSParser
+import ArticlesDatabase
+@testable import Account
+
+/// Headless startup benchmark: opens several synthetic local accounts and
+/// reports the time until all of them have their unread counts — the
+/// critical path for showing the sidebar.
+@MainActor @Suite final class AccountStartupPerformanceTests {
+
+	private static let accountCount = 5
+	private static let feedsPerAccount = 100
+	private static let articlesPerFeed = 20
+
+	private let accountFolders: [String]
+
+	init() async throws {
+		var accountFolders = [String]()
+		for _ in 0..<Self.accountCount {
+			let folder = (NSTemporaryDirectory() as NSString).appendingPathComponent("AccountStartupPerformanceTests-\(UUID().uuidString)")
+			try FileManager.default.createDirectory(atPath: folder, withIntermediateDirectories: true)
+			await Self.seedArticlesDatabase(folder: folder)
+			accountFolders.append(folder)
+		}
+		self.accountFolders = accountFolders
+	}
+
+	deinit {
+		for folder in accountFolders {
+			try? FileManager.default.removeItem(atPath: folder)
+		}
+	}
+
+	@Test(.timeLimit(.minutes(1))) func timeToFirstUnreadCounts() async throws {
+		let startTime = Date()
+		let accounts = accountFolders.map { Account(dataFolder: $0, type: .onMyMac, accountID: UUID().uuidString) }
+
+		// Each account posts UnreadCountDidInitialize from a main-actor task,
+		// so none can arrive before the continuation is set.
+		let accountIDs = Set(accounts.map { ObjectIdentifier($0) })
+		nonisolated(unsafe) var initializedAccountIDs = Set<ObjectIdentifier>()
+		nonisolated(unsafe) var continuation: CheckedContinuation<Void, Never>?
+		let observer = NotificationCenter.default.addObserver(forName: .UnreadCountDidInitialize, object: nil, queue: nil) { note in
+			guard let account = note.object as? Account, accountIDs.contains(ObjectIdentifier(account)) else {
+				return
+			}
+			initializedAccountIDs.insert(ObjectIdentifier(account))
+			if initializedAccountIDs == accountIDs {
+				continuation?.resume()
+				continuation = nil
+			}
+		}
+		defer {
+			NotificationCenter.default.removeObserver(observer)
+		}
+		await withCheckedContinuation { continuation = $0 }
+		let elapsed = Date().timeIntervalSince(startTime)
+
+		#expect(accounts.allSatisfy { $0.areUnreadCountsInitialized })
+
+		var report = "Time to first unread counts for \(Self.accountCount) accounts: \(String(format: "%.3f", elapsed)) seconds"
+		for phase in StartupPhase.allCases where !phase.isDeferred {
+			let duration = StartupProfiler.shared.durations[phase] ?? 0
+			report += "\n\t\(phase.rawValue): \(String(format: "%.3f", duration)) seconds"
+		}
+		Attachment.record(report, named: "time-to-first-unread-counts.txt")
+	}
+}
+
+private extension AccountStartupPerformanceTests {
+
+	static func seedArticlesDatabase(folder: String) async {
+		let databasePath = (folder as NSString).appendingPathComponent("DB.sqlite3")
+		let database = ArticlesDatabase(databaseFilePath: databasePath, accountID: "seed", retentionStyle: .feedBased)
+		for feedIndex in 0..<Self.feedsPerAccount {
+			let feedID = "https://example.com/\(feedIndex)/feed.xml"
+			let items = Set((0..<Self.articlesPerFeed).map { Self.parsedItem(feedID: feedID, uniqueID: String($0)) })
+			_ = await database.updateAsync(parsedItems: items, feedID: feedID, deleteOlder: false)
+		}
+	}
+
+	static func parsedItem(feedID: String, uniqueID: String) -> ParsedItem {
+		ParsedItem(syncServiceID: nil, uniqueID: uniqueID, feedURL: feedID, url: "\(feedID)/\(uniqueID)", externalURL: nil, title: "Article \(uniqueID)", language: nil, contentHTML: "<p>Synthetic article body \(uniqueID).</p>", contentText: nil, markdown: nil, summary: nil, imageURL: nil, bannerImageURL: nil, datePublished: Date(), dateModified: nil, authors: nil, tags: nil, attachments: nil)
+	}
+}
@@ -33,6 +33,72 @@ struct FeedSettingsDatabaseTests {
 		#expect(database.allRows()[feedURL]?.feedID == canonicalFeedID)
 	}
 
+	@Test func settersAreWrittenTogetherInOneCommit() {
+		let database = makeDatabase()
+		let feedURLs = (0..<100).map { "https://example.com/\($0)/feed.xml" }
+		for feedURL in feedURLs {
+			database.ensureFeedExists(feedURL, feedID: feedURL)
+		}
+		database.writePendingChanges()
+		let commitCount = database.commitCount
+
+		let lastCheckDate = Date(timeIntervalSinceReferenceDate: 800_000_000)
+		for feedURL in feedURLs {
+			database.setString("hash", for: feedURL, column: .contentHash)
+			database.setDate(lastCheckDate, for: feedURL, column: .lastCheckDate)
+			database.setInt(200, for: feedURL, column: .lastResponseCode)
+			database.setInt(304, for: feedURL, column: .lastResponseCode)
+		}
+		database.writePendingChanges()
+
+		#expect(database.commitCount == commitCount + 1)
+
+		let row = database.allRows()[feedURLs[0]]
+		#expect(row?.contentHash == "hash")
+		#expect(row?.lastCheckDate == lastCheckDate)
+		#expect(row?.lastResponseCode == 304)
+	}
+
+	@Test func readsSeePendingChanges() {
+		let database = makeDatabase()
+		let feedURL = "https://example.com/feed.xml"
+
+		database.ensureFeedExists(feedURL, feedID: feedURL)
+		database.setString("Edited", for: feedURL, column: .editedName)
+		database.setString(nil, for: feedURL, column: .homePageURL)
+
+		let row = database.allRows()[feedURL]
+		#expect(row?.editedName == "Edited")
+		#expect(row?.homePageURL == nil)
+	}
+
+	@Test func setterAfterEnsureFeedExistsIsWritten() {
+		let database = makeDatabase()
+		let feedURL = "https://example.com/feed.xml"
+		let lastCheckDate = Date(timeIntervalSinceReferenceDate: 800_000_000)
+
+		database.ensureFeedExists(feedURL, feedID: feedURL)
+		database.setDate(lastCheckDate, for: feedURL, column: .lastCheckDate)
+		database.writePendingChanges()
+
+		#expect(database.allRows()[feedURL]?.lastCheckDate == lastCheckDate)
+	}
+
+	@Test func settersBeforeDeleteSettingsAreDropped() {
+		let database = makeDatabase()
+		let feedURL = "https://example.com/feed.xml"
+
+		database.ensureFeedExists(feedURL, feedID: feedURL)
+		database.setString("Edited", for: feedURL, column: .editedName)
+		database.deleteSettings(for: feedURL)
+		database.ensureFeedExists(feedURL, feedID: feedURL)
+		database.writePendingChanges()
+
+		let row = database.allRows()[feedURL]
+		#expect(row != nil)
+		#expect(row?.editedName == nil)
+	}
+
 	private func makeDatabase() -> FeedSettingsDatabase {
 		FeedSettingsDatabase(databasePath: ":memory:")
 	}
@@ -0,0 +1,57 @@
+//
+//  FeedbinEntryMappingTests.swift
+//  AccountTests
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import Testing
+import RSWeb
+import RSParser
+@testable import Account
+
+/// A recorded entries page, served by `TestingURLProtocol`, decoded and
+/// mapped to parsed items the way a Feedbin sync does it.
+@MainActor struct FeedbinEntryMappingTests {
+
+	@Test func entriesPageIsMappedAndGroupedByFeed() async throws {
+		TestingURLProtocol.reset()
+		TestingURLProtocol.setResponse("entries.json", file: "JSON/entries_page.json")
+
+		let caller = FeedbinAPICaller()
+		let entries = try #require(try await caller.retrieveEntries(articleIDs: ["2077", "2078", "3001"]))
+		#expect(entries.count == 3)
+
+		nonisolated(unsafe) var mappedOnMainThread = false
+		let feedIDsAndItems = await ParsedItemMapping.parsedItemsByFeedID(entries, service: "Test") { entry in
+			if Thread.isMainThread {
+				mappedOnMainThread = true
+			}
+			return FeedbinAccountDelegate.parsedItem(entry: entry)
+		}
+		#expect(!mappedOnMainThread)
+
+		#expect(feedIDsAndItems.count == 2)
+		#expect(feedIDsAndItems["1296379"]?.count == 2)
+		#expect(feedIDsAndItems["1096623"]?.count == 1)
+
+		let one = try #require(feedIDsAndItems["1296379"]?.first { $0.syncServiceID == "2077" })
+		#expect(one.title == "One")
+		#expect(one.contentHTML == "<p>One</p>")
+		#expect(one.externalURL == "https://example.com/linked")
+		#expect(one.authors?.first?.avatarURL == "https://daringfireball.net/graphics/logos/dfstar.png")
+		#expect(one.datePublished != nil)
+
+		// An unparseable date loses just the date, not the entry.
+		let three = try #require(feedIDsAndItems["1096623"]?.first)
+		#expect(three.datePublished == nil)
+	}
+
+	@Test func entriesThatMapToNilAreSkipped() async {
+		let feedIDsAndItems = await ParsedItemMapping.parsedItemsByFeedID([1, 2, 3, 4], service: "Test") { number in
+			number.isMultiple(of: 2) ? ParsedItem(syncServiceID: nil, uniqueID: String(number), feedURL: "feed", url: nil, externalURL: nil, title: nil, language: nil, contentHTML: nil, contentText: nil, markdown: nil, summary: nil, imageURL: nil, bannerImageURL: nil, datePublished: nil, dateModified: nil, authors: nil, tags: nil, attachments: nil) : nil
+		}
+		#expect(feedIDsAndItems["feed"]?.map { $0.uniqueID }.sorted() == ["2", "4"])
+	}
+}
@@ -0,0 +1,70 @@
+//
+//  OPMLImportPerformanceTests.swift
+//  AccountTests
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import XCTest
+import RSCore
+import RSParser
+@testable import Account
+
+// Performance tests stay in XCTest — Swift Testing doesn't have a `measure { }` equivalent yet.
+
+/// Imports Subs.opml scaled up to about 5,000 feeds — the size of a shared
+/// team subscription list — into a fresh local account.
+@MainActor final class OPMLImportPerformanceTests: XCTestCase {
+
+	private static let copies = 25
+
+	func testImportScaledUpSubsOPML() throws {
+		let opmlItems = try scaledUpOPMLItems()
+		let accountManager = TestAccountManager()
+		let account = accountManager.createAccount(type: .onMyMac)
+		defer {
+			accountManager.deleteAccount(account)
+		}
+
+		let startTime = Date()
+		let normalizedItems = OPMLNormalizer.normalize(opmlItems)
+		let normalizeTime = Date()
+		BatchUpdate.shared.perform {
+			account.addOPMLItems(normalizedItems, isManualImport: true)
+		}
+		let endTime = Date()
+
+		let feedCount = account.flattenedFeeds().count
+		XCTAssertGreaterThan(feedCount, 4000)
+
+		let report = """
+		Imported \(feedCount) feeds in \(String(format: "%.3f", endTime.timeIntervalSince(startTime))) seconds
+			normalize: \(String(format: "%.3f", normalizeTime.timeIntervalSince(startTime))) seconds
+			add to account: \(String(format: "%.3f", endTime.timeIntervalSince(normalizeTime))) seconds
+		"""
+		XCTContext.runActivity(named: report) { _ in }
+	}
+}
+
+private extension OPMLImportPerformanceTests {
+
+	/// Subs.opml repeated `copies` times, with each copy’s feed URLs made unique.
+	/// Folders keep their names, so each folder’s feeds merge across copies.
+	func scaledUpOPMLItems() throws -> [OPMLItem] {
+		let url = Bundle.module.resourceURL!.appendingPathComponent("OPML/Subs.opml")
+		let opml = try String(contentsOf: url, encoding: .utf8)
+		let bodyStart = try XCTUnwrap(opml.range(of: "<body>"))
+		let bodyEnd = try XCTUnwrap(opml.range(of: "</body>"))
+		let body = opml[bodyStart.upperBound..<bodyEnd.lowerBound]
+
+		var scaledUpBody = ""
+		for copy in 0..<Self.copies {
+			scaledUpBody += body.replacingOccurrences(of: "xmlUrl=\"", with: "xmlUrl=\"https://copy\(copy).example.com/?url=")
+		}
+		let scaledUpOPML = opml[..<bodyStart.upperBound] + scaledUpBody + opml[bodyEnd.lowerBound...]
+
+		let parserData = ParserData(url: url.absoluteString, data: Data(scaledUpOPML.utf8))
+		let document = try OPMLParser.parseOPML(with: parserData)
+		return try XCTUnwrap(document.children)
+	}
+}
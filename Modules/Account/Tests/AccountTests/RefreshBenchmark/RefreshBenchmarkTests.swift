@@ -0,0 +1,274 @@
+//
+//  RefreshBenchmarkTests.swift
+//  AccountTests
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import XCTest
+import RSDatabase
+import RSParser
+import RefreshBenchmark
+@testable import Account
+
+// Performance tests stay in XCTest — Swift Testing doesn't have a `measure { }` equivalent yet.
+
+/// End-to-end refresh benchmark: a local account refreshes synthetic feeds
+/// from `FeedServer`, through download, parse, and database save. The feeds,
+/// server, and scenarios come from the RefreshBenchmark package, whose
+/// `refresh-benchmark` runner measures download and parse on their own —
+/// on Linux too, where this module doesn’t build.
+///
+/// Each scenario reports wall time, process CPU time, allocations, peak
+/// memory growth, SQLite commits, database queue time, and the refresher’s
+/// own stage timings and per-stage CPU time (see `RefreshTelemetry`), as an
+/// activity — and, when `REFRESH_BENCHMARK_REPORT_PATH` is set, as a line
+/// of JSON appended to that file, so runs can be compared from the command
+/// line:
+///
+///     REFRESH_BENCHMARK_REPORT_PATH=/tmp/refresh.jsonl swift test --filter RefreshBenchmarkTests
+@MainActor final class RefreshBenchmarkTests: XCTestCase {
+
+	private var folder: String!
+	private var account: Account!
+
+	override func setUp() async throws {
+		folder = (NSTemporaryDirectory() as NSString).appendingPathComponent("RefreshBenchmarkTests-\(UUID().uuidString)")
+		try FileManager.default.createDirectory(atPath: folder, withIntermediateDirectories: true)
+		account = Account(dataFolder: folder, type: .onMyMac, accountID: UUID().uuidString)
+		try await waitUntil(timeout: 30) { self.account.areUnreadCountsInitialized }
+		DatabaseQueue.setProfilingEnabled(true)
+	}
+
+	override func tearDown() async throws {
+		DatabaseQueue.setProfilingEnabled(false)
+		account = nil
+		try? FileManager.default.removeItem(atPath: folder)
+	}
+
+	func testInitialRefresh() async throws {
+		try await runScenario(.initial)
+	}
+
+	func testChurnRefresh() async throws {
+		try await runScenario(.churn)
+	}
+
+	func testNotModifiedRefresh() async throws {
+		try await runScenario(.notModified)
+	}
+
+	func testUnchangedContentRefresh() async throws {
+		try await runScenario(.unchangedContent)
+	}
+
+	func testMixedRefresh() async throws {
+		try await runScenario(.mixed)
+	}
+
+	func testSlowServerRefresh() async throws {
+		try await runScenario(.slowServer)
+	}
+
+	func testTooManyRequestsRefresh() async throws {
+		try await runScenario(.tooManyRequests)
+	}
+
+	func testLargeFeedsRefresh() async throws {
+		try await runScenario(.largeFeeds)
+	}
+
+	func testShiftJISRefresh() async throws {
+		try await runScenario(.shiftJIS)
+	}
+
+	func testUTF16AtomRefresh() async throws {
+		try await runScenario(.utf16Atom)
+	}
+
+	/// The parse stage alone, without the network or the database.
+	func testParseStage() {
+		let documents = SyntheticFeeds(SyntheticFeedsProfile()).documents(round: 0)
+
+		measure(metrics: [XCTClockMetric(), XCTCPUMetric(), XCTMemoryMetric()]) {
+			for (path, data) in documents {
+				_ = try? FeedParser.parse(ParserData(url: "http://127.0.0.1\(path)", data: data))
+			}
+		}
+	}
+}
+
+// MARK: - Report
+
+struct RefreshBenchmarkReport: Codable {
+
+	let scenario: String
+	let feedCount: Int
+	let itemsPerFeed: Int
+	let wallSeconds: Double
+	let cpuSeconds: Double
+	/// Nil where allocation counting isn’t supported.
+	let allocations: AllocationCount?
+	let peakFootprintGrowthBytes: Int64
+	let peakHeapGrowthBytes: Int64?
+	let sqliteCommits: Int
+	let sqliteStatements: Int
+	let databaseQueueCalls: Int
+	let databaseQueueRunMilliseconds: Double
+	let databaseQueueWaitMilliseconds: Double
+	let server: FeedServer.Counts
+	let stages: [RefreshStage: RefreshStageSummary]
+	let cpuStages: [RefreshStage: RefreshStageSummary]
+	let summary: String
+
+	var description: String {
+		"""
+		Refresh benchmark — \(scenario): \(feedCount) feeds × \(itemsPerFeed) items
+		\twall: \(String(format: "%.3f", wallSeconds)) seconds, CPU: \(String(format: "%.3f", cpuSeconds)) seconds
+		\tallocations: \(allocations.map { "\($0.allocations), \(ByteCountFormatter.string(fromByteCount: Int64($0.allocatedBytes), countStyle: .memory))" } ?? "not counted")
+		\tpeak growth: footprint \(ByteCountFormatter.string(fromByteCount: peakFootprintGrowthBytes, countStyle: .memory)), heap \(peakHeapGrowthBytes.map { ByteCountFormatter.string(fromByteCount: $0, countStyle: .memory) } ?? "unknown")
+		\tSQLite: \(sqliteCommits) commits, \(sqliteStatements) statements
+		\tdatabase queue: \(databaseQueueCalls) calls, run \(String(format: "%.1f", databaseQueueRunMilliseconds)) ms, wait \(String(format: "%.1f", databaseQueueWaitMilliseconds)) ms
+		\tserver: \(server.requests) requests — \(server.ok) 200, \(server.notModified) 304, \(server.tooManyRequests) 429 — \(ByteCountFormatter.string(fromByteCount: Int64(server.bodyBytesSent), countStyle: .file))
+		\t\(summary)
+		""" + stagesDescription
+	}
+
+	private var stagesDescription: String {
+		RefreshStage.allCases.compactMap { stage in
+			guard let summary = stages[stage] else {
+				return nil
+			}
+			var line = "\n\t\(stage.rawValue): p50 \(String(format: "%.1f", summary.p50Milliseconds)) ms, p95 \(String(format: "%.1f", summary.p95Milliseconds)) ms, p99 \(String(format: "%.1f", summary.p99Milliseconds)) ms, total \(String(format: "%.1f", summary.totalMilliseconds)) ms"
+			if let cpuSummary = cpuStages[stage] {
+				line += " — CPU p50 \(String(format: "%.1f", cpuSummary.p50Milliseconds)) ms, total \(String(format: "%.1f", cpuSummary.totalMilliseconds)) ms"
+			}
+			return line
+		}.joined()
+	}
+}
+
+// MARK: - Private
+
+private extension RefreshBenchmarkTests {
+
+	/// Refreshes `warmUpRounds` times unmeasured, then once more, measured.
+	func runScenario(_ scenario: RefreshBenchmarkScenario) async throws {
+		let syntheticFeeds = SyntheticFeeds(scenario.feeds)
+		let server = try FeedServer(profile: scenario.server)
+		let feeds = Set(syntheticFeeds.feedIndices.map { feedIndex in
+			let url = server.url(syntheticFeeds.path(feedIndex), feedIndex: feedIndex).absoluteString
+			return account.createFeed(with: nil, url: url, feedID: url, homePageURL: nil)
+		})
+		account.addFeeds(feeds)
+
+		for round in 0..<scenario.warmUpRounds {
+			try await refresh(feeds, round: round, syntheticFeeds, server)
+		}
+
+		let databaseTotalsBefore = DatabaseTotals.current(folder)
+		server.resetCounts()
+		var sampler = ResourceSampler()
+		let cpuTimeBefore = processCPUSeconds()
+		let clock = ContinuousClock()
+		let startTime = clock.now
+
+		let ((summary, refreshMetrics), allocations) = try await AllocationCounter.measure {
+			try await refresh(feeds, round: scenario.warmUpRounds, syntheticFeeds, server) {
+				sampler.sample()
+			}
+		}
+
+		let elapsed = clock.now - startTime
+		let cpuTime = processCPUSeconds() - cpuTimeBefore
+		sampler.sample()
+		let databaseTotals = DatabaseTotals.current(folder) - databaseTotalsBefore
+
+		let report = RefreshBenchmarkReport(scenario: scenario.name, feedCount: scenario.feeds.feedCount, itemsPerFeed: scenario.feeds.itemsPerFeed, wallSeconds: elapsed.seconds, cpuSeconds: cpuTime, allocations: allocations, peakFootprintGrowthBytes: sampler.peakFootprintGrowth, peakHeapGrowthBytes: sampler.peakHeapGrowth, sqliteCommits: databaseTotals.commits, sqliteStatements: databaseTotals.statements, databaseQueueCalls: databaseTotals.queueCalls, databaseQueueRunMilliseconds: databaseTotals.queueRunMilliseconds, databaseQueueWaitMilliseconds: databaseTotals.queueWaitMilliseconds, server: server.counts, stages: refreshMetrics?.stages ?? [:], cpuStages: refreshMetrics?.cpuStages ?? [:], summary: summary)
+		#if canImport(Darwin)
+		XCTContext.runActivity(named: report.description) { _ in }
+		#else
+		print(report.description)
+		#endif
+		if let reportPath = RefreshBenchmarkReportFile.pathFromEnvironment {
+			try RefreshBenchmarkReportFile.append(report, to: reportPath)
+		}
+	}
+
+	/// One refresh of every feed, until every download is parsed, saved, and indexed.
+	/// Returns the refresher’s stats message and stage timings.
+	@discardableResult
+	func refresh(_ feeds: Set<Feed>, round: Int, _ syntheticFeeds: SyntheticFeeds, _ server: FeedServer, whileWaiting: () -> Void = {}) async throws -> (String, RefreshMetrics?) {
+		server.setDocuments(syntheticFeeds.documents(round: round))
+
+		// Make every feed due, as if the minimum time between checks had passed.
+		for feed in feeds {
+			feed.lastCheckDate = nil
+			feed.cacheControlInfo = nil
+		}
+
+		let refresher = LocalAccountRefresher()
+		await refresher.refreshFeeds(feeds)
+		try await waitUntil(timeout: 120) {
+			whileWaiting()
+			return refresher.isRefreshComplete
+		}
+
+		// Search indexing runs on the database queue after the save — this waits behind it.
+		_ = await account.fetchUnreadArticleIDsAsync()
+		return (refresher.refreshStatsMessage, refresher.lastRefreshMetrics)
+	}
+
+	func waitUntil(timeout: TimeInterval, _ condition: () -> Bool) async throws {
+		let startTime = Date()
+		while !condition() {
+			guard Date().timeIntervalSince(startTime) < timeout else {
+				XCTFail("Timed out after \(timeout) seconds")
+				return
+			}
+			try await Task.sleep(for: .milliseconds(1))
+		}
+	}
+}
+
+/// Totals from the `DatabaseProfile`s for one account’s databases.
+/// Profiles are cumulative, so a round is the difference of two snapshots.
+private struct DatabaseTotals {
+
+	var commits = 0
+	var statements = 0
+	var queueCalls = 0
+	var queueRunMilliseconds = 0.0
+	var queueWaitMilliseconds = 0.0
+
+	static func current(_ accountFolder: String) -> DatabaseTotals {
+		// Profile names are folder name plus file name.
+		let prefix = (accountFolder as NSString).lastPathComponent + "/"
+
+		var totals = DatabaseTotals()
+		for profile in DatabaseQueue.profiles() where profile.databaseName.hasPrefix(prefix) {
+			for statement in profile.statements {
+				totals.statements += statement.calls
+				if statement.fingerprint.lowercased().hasPrefix("commit") {
+					totals.commits += statement.calls
+				}
+			}
+			totals.queueCalls += profile.queue.calls
+			totals.queueRunMilliseconds += profile.queue.totalRunMilliseconds
+			totals.queueWaitMilliseconds += profile.queue.totalWaitMilliseconds
+		}
+		return totals
+	}
+
+	static func - (lhs: DatabaseTotals, rhs: DatabaseTotals) -> DatabaseTotals {
+		DatabaseTotals(commits: lhs.commits - rhs.commits, statements: lhs.statements - rhs.statements, queueCalls: lhs.queueCalls - rhs.queueCalls, queueRunMilliseconds: lhs.queueRunMilliseconds - rhs.queueRunMilliseconds, queueWaitMilliseconds: lhs.queueWaitMilliseconds - rhs.queueWaitMilliseconds)
+	}
+}
+
+private extension Duration {
+
+	var seconds: Double {
+		let (seconds, attoseconds) = components
+		return Double(seconds) + Double(attoseconds) / 1e18
+	}
+}
@@ -0,0 +1,99 @@
+//
+//  RefreshTelemetryTests.swift
+//  AccountTests
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import Testing
+@testable import Account
+
+@MainActor @Suite struct RefreshTelemetryTests {
+
+	@Test func stagesCountOnlyWhatHappened() {
+		var parsed = FeedRefreshMetrics(feedURL: "https://example.com/feed.xml")
+		parsed.outcome = .updated
+		parsed.parseQueueWaitMilliseconds = 2
+		parsed.parseMilliseconds = 10
+		parsed.itemsParsed = 25
+		parsed.databaseQueueWaitMilliseconds = 1
+		parsed.diffMilliseconds = 3
+		parsed.writeMilliseconds = 4
+		parsed.parseCPUMilliseconds = 8
+		parsed.writeCPUMilliseconds = 3
+		parsed.downloadedBytes = 50_000
+
+		var notModified = FeedRefreshMetrics(feedURL: "https://example.org/feed.xml")
+		notModified.outcome = .notModified
+		notModified.statusCode = 304
+
+		let refresh = RefreshMetrics(accountID: "test", startDate: Date(), durationMilliseconds: 100, feedsSkipped: 1, feeds: [parsed, notModified])
+
+		#expect(refresh.feeds.map(\.feedURL) == ["https://example.com/feed.xml", "https://example.org/feed.xml"])
+		#expect(refresh.stages[.parse]?.count == 1)
+		#expect(refresh.stages[.write]?.count == 1)
+		#expect(refresh.stages[.domainLookup] == nil)
+		#expect(refresh.cpuStages[.parse]?.count == 1)
+		#expect(refresh.cpuStages[.write]?.count == 1)
+		#expect(refresh.cpuStages[.diff] == nil)
+		#expect(refresh.cpuStages[.transfer] == nil)
+		#expect(refresh.downloadedBytes == 50_000)
+		#expect(refresh.itemsParsed == 25)
+	}
+
+	@Test func telemetryAggregatesRefreshes() throws {
+		let telemetry = RefreshTelemetry()
+		for parseMilliseconds in [1.0, 2, 4, 8, 100] {
+			var feed = FeedRefreshMetrics(feedURL: "https://example.com/\(parseMilliseconds).xml")
+			feed.parseMilliseconds = parseMilliseconds
+			telemetry.add(RefreshMetrics(accountID: nil, startDate: Date(), durationMilliseconds: parseMilliseconds, feedsSkipped: 0, feeds: [feed]))
+		}
+
+		let parse = try #require(telemetry.report.stages[.parse])
+		#expect(parse.count == 5)
+		#expect(parse.totalMilliseconds == 115)
+		#expect(parse.maximumMilliseconds == 100)
+		// The third sample, 4 ms, is in the 2.048–4.096 ms bucket. The fifth,
+		// 100 ms, is in the bucket that ends at 131.072 ms, capped at the maximum.
+		#expect(parse.p50Milliseconds == 4.096)
+		#expect(parse.p95Milliseconds == 100)
+		#expect(parse.p99Milliseconds == 100)
+		#expect(telemetry.recentRefreshes.count == 5)
+
+		telemetry.reset()
+		#expect(telemetry.report.stages.isEmpty)
+		#expect(telemetry.recentRefreshes.isEmpty)
+	}
+
+	/// Percentiles are the upper bounds of power-of-two microsecond buckets.
+	@Test func percentilesAreBucketUpperBounds() throws {
+		// 94 × 1 ms, 4 × 10 ms, then 50 ms and 200 ms.
+		let parseTimes = Array(repeating: 1.0, count: 94) + Array(repeating: 10.0, count: 4) + [50, 200]
+		let feeds = parseTimes.enumerated().map { index, parseMilliseconds in
+			var feed = FeedRefreshMetrics(feedURL: "https://example.com/\(index).xml")
+			feed.parseMilliseconds = parseMilliseconds
+			return feed
+		}
+		let refresh = RefreshMetrics(accountID: nil, startDate: Date(), durationMilliseconds: 300, feedsSkipped: 0, feeds: feeds)
+
+		let parse = try #require(refresh.stages[.parse])
+		#expect(parse.count == 100)
+		#expect(parse.p50Milliseconds == 1.024) // 50th sample: 1 ms, in 0.512–1.024 ms
+		#expect(parse.p95Milliseconds == 16.384) // 95th: 10 ms, in 8.192–16.384 ms
+		#expect(parse.p99Milliseconds == 65.536) // 99th: 50 ms, in 32.768–65.536 ms
+		#expect(parse.maximumMilliseconds == 200)
+	}
+
+	@Test func jsonKeysStagesByName() throws {
+		let telemetry = RefreshTelemetry()
+		var feed = FeedRefreshMetrics(feedURL: "https://example.com/feed.xml")
+		feed.diffMilliseconds = 5
+		telemetry.add(RefreshMetrics(accountID: nil, startDate: Date(), durationMilliseconds: 5, feedsSkipped: 0, feeds: [feed]))
+
+		let json = try #require(try JSONSerialization.jsonObject(with: telemetry.jsonData()) as? [String: Any])
+		let stages = try #require(json["stages"] as? [String: Any])
+		#expect(stages["diff"] != nil)
+		#expect(json["refreshCount"] as? Int == 1)
+	}
+}
@@ -0,0 +1,211 @@
+//
+//  UnreadCountAggregatorTests.swift
+//  AccountTests
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import Testing
+import RSParser
+@testable import Account
+
+@MainActor @Suite(.serialized) struct UnreadCountAggregatorTests {
+
+	private static let folderCount = 30
+	private static let feedsPerFolder = 100
+
+	private let accountManager = TestAccountManager()
+
+	/// A sync that changes the unread counts of 3,000 feeds posts one change set,
+	/// one UnreadCountDidChange per folder and for the account, and none per feed.
+	@Test func largeSyncPostsOneChangeSet() async throws {
+		let account = try await makeAccount()
+		defer {
+			accountManager.deleteAccount(account)
+		}
+
+		nonisolated(unsafe) var changeSets = [UnreadCountChangeSet]()
+		nonisolated(unsafe) var feedNotificationCount = 0
+		nonisolated(unsafe) var containerNotificationCount = 0
+		let changeSetObserver = NotificationCenter.default.addObserver(forName: .UnreadCountsDidChange, object: nil, queue: nil) { note in
+			if let changeSet = note.userInfo?[UnreadCountChangeSet.userInfoKey] as? UnreadCountChangeSet {
+				changeSets.append(changeSet)
+			}
+		}
+		let providerObserver = NotificationCenter.default.addObserver(forName: .UnreadCountDidChange, object: nil, queue: nil) { note in
+			if note.object is Feed {
+				feedNotificationCount += 1
+			} else if note.object is Folder || note.object is Account {
+				containerNotificationCount += 1
+			}
+		}
+		defer {
+			NotificationCenter.default.removeObserver(changeSetObserver)
+			NotificationCenter.default.removeObserver(providerObserver)
+		}
+
+		let feeds = account.flattenedFeeds()
+		#expect(feeds.count == Self.folderCount * Self.feedsPerFolder)
+
+		// Everything here runs on the main actor: setting the counts, applying
+		// the change set to folders and the account, and the observers.
+		let clock = ContinuousClock()
+		let mainThreadTime = clock.measure {
+			for feed in feeds {
+				feed.unreadCount = syntheticUnreadCount(feed)
+			}
+			UnreadCountAggregator.shared.flush()
+		}
+		Attachment.record("\(mainThreadTime)", named: "large-sync-main-thread-time.txt")
+
+		#expect(feedNotificationCount == 0)
+		#expect(containerNotificationCount == Self.folderCount + 1)
+		#expect(changeSets.count == 1)
+		#expect(changeSets.first?.feedDeltas.count == feeds.count)
+		#expect(changeSets.first?.folders.count == Self.folderCount)
+		#expect(changeSets.first?.accounts == [account])
+		// Generous, so a busy shared CI machine doesn’t fail it — the time is
+		// recorded above for comparing runs.
+		#expect(mainThreadTime < .seconds(5), "Applying a large sync took \(mainThreadTime) on the main thread")
+
+		expectTotalsMatchFeeds(account)
+
+		// The flush scheduled for the end of the tick finds nothing left to post.
+		try await Task.sleep(for: .milliseconds(50))
+		#expect(changeSets.count == 1)
+	}
+
+	@Test func changesInOneTickArePublishedTogether() async throws {
+		let account = try await makeAccount()
+		defer {
+			accountManager.deleteAccount(account)
+		}
+
+		nonisolated(unsafe) var changeSets = [UnreadCountChangeSet]()
+		let observer = NotificationCenter.default.addObserver(forName: .UnreadCountsDidChange, object: nil, queue: nil) { note in
+			if let changeSet = note.userInfo?[UnreadCountChangeSet.userInfoKey] as? UnreadCountChangeSet {
+				changeSets.append(changeSet)
+			}
+		}
+		defer {
+			NotificationCenter.default.removeObserver(observer)
+		}
+
+		let feeds = Array(account.flattenedFeeds().prefix(3))
+		feeds[0].unreadCount = 5
+		feeds[1].unreadCount = 2
+		feeds[1].unreadCount = 0 // Changed and changed back.
+		feeds[2].unreadCount = 7
+		feeds[2].unreadCount = 4
+		#expect(changeSets.isEmpty)
+
+		try await Task.sleep(for: .milliseconds(50))
+
+		#expect(changeSets.count == 1)
+		#expect(changeSets.first?.feedDeltas == [feeds[0]: 5, feeds[2]: 4])
+		#expect(account.unreadCount == 9)
+		expectTotalsMatchFeeds(account)
+
+		feeds[0].unreadCount = 1
+		UnreadCountAggregator.shared.flush()
+
+		#expect(changeSets.count == 2)
+		#expect(changeSets.last?.feedDeltas == [feeds[0]: -4])
+		#expect(account.unreadCount == 5)
+		expectTotalsMatchFeeds(account)
+	}
+
+	/// Feed changes that cancel out leave the folder and account totals alone,
+	/// so they post no UnreadCountDidChange — the change set still has the feeds.
+	@Test func changesThatCancelOutStillPublishFeeds() async throws {
+		let account = try await makeAccount()
+		defer {
+			accountManager.deleteAccount(account)
+		}
+
+		let folder = try #require(account.folders?.first)
+		let feeds = Array(folder.topLevelFeeds.prefix(2))
+		feeds[0].unreadCount = 1
+		feeds[1].unreadCount = 0
+		UnreadCountAggregator.shared.flush()
+
+		nonisolated(unsafe) var changeSets = [UnreadCountChangeSet]()
+		nonisolated(unsafe) var containerNotificationCount = 0
+		let changeSetObserver = NotificationCenter.default.addObserver(forName: .UnreadCountsDidChange, object: nil, queue: nil) { note in
+			if let changeSet = note.userInfo?[UnreadCountChangeSet.userInfoKey] as? UnreadCountChangeSet {
+				changeSets.append(changeSet)
+			}
+		}
+		let providerObserver = NotificationCenter.default.addObserver(forName: .UnreadCountDidChange, object: nil, queue: nil) { note in
+			if note.object is Folder || note.object is Account {
+				containerNotificationCount += 1
+			}
+		}
+		defer {
+			NotificationCenter.default.removeObserver(changeSetObserver)
+			NotificationCenter.default.removeObserver(providerObserver)
+		}
+
+		feeds[0].unreadCount = 0
+		feeds[1].unreadCount = 1
+		UnreadCountAggregator.shared.flush()
+
+		#expect(containerNotificationCount == 0)
+		#expect(changeSets.count == 1)
+		#expect(changeSets.first?.feedDeltas == [feeds[0]: -1, feeds[1]: 1])
+		expectTotalsMatchFeeds(account)
+	}
+}
+
+private extension UnreadCountAggregatorTests {
+
+	func makeAccount() async throws -> Account {
+		let account = accountManager.createAccount(type: .onMyMac)
+		account.loadOPMLItems(try opmlItems(), isManualImport: false)
+
+		// Wait for the startup fetch, so it can’t overwrite the synthetic counts.
+		let startTime = Date()
+		while !account.areUnreadCountsInitialized && Date().timeIntervalSince(startTime) < 10 {
+			try await Task.sleep(for: .milliseconds(1))
+		}
+		UnreadCountAggregator.shared.flush()
+		return account
+	}
+
+	func syntheticUnreadCount(_ feed: Feed) -> Int {
+		abs(feed.feedID.hashValue % 50) + 1
+	}
+
+	func expectTotalsMatchFeeds(_ account: Account) {
+		for folder in account.folders ?? Set<Folder>() {
+			#expect(folder.unreadCount == folder.topLevelFeeds.reduce(0) { $0 + $1.unreadCount })
+		}
+		#expect(account.unreadCount == account.flattenedFeeds().reduce(0) { $0 + $1.unreadCount })
+	}
+
+	func opmlItems() throws -> [OPMLItem] {
+		var outlines = ""
+		for folderIndex in 0..<Self.folderCount {
+			outlines += "<outline text=\"Folder \(folderIndex)\" title=\"Folder \(folderIndex)\">\n"
+			for feedIndex in 0..<Self.feedsPerFolder {
+				let feedURL = "https://example.com/\(folderIndex)/\(feedIndex)/feed.xml"
+				outlines += "<outline text=\"Feed\" title=\"Feed\" type=\"rss\" version=\"RSS\" htmlUrl=\"https://example.com/\" xmlUrl=\"\(feedURL)\"/>\n"
+			}
+			outlines += "</outline>\n"
+		}
+		let opml = """
+		<?xml version="1.0" encoding="UTF-8"?>
+		<opml version="1.1">
+		<body>
+		\(outlines)
+		</body>
+		</opml>
+		"""
+		let data = try #require(opml.data(using: .utf8))
+		let parserData = ParserData(url: "https://example.com/subscriptions.opml", data: data)
+		let document = try OPMLParser.parseOPML(with: parserData)
+
+		return try #require(document.children)
+	}
+}
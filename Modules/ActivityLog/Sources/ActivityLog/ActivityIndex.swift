@@ -0,0 +1,114 @@
+//
+//  ActivityIndex.swift
+//  ActivityLog
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+
+/// Activities in one lifecycle state (pending or running), indexed by id
+/// and by `(owner, kind)`, so lookups and removals don’t scan. A big
+/// refresh has thousands of activities in flight.
+@MainActor final class ActivityIndex {
+
+	private struct Key: Hashable {
+		let owner: ActivityOwner
+		let kind: ActivityKind
+	}
+
+	private struct Entry {
+		let sequence: Int
+		let activity: Activity
+	}
+
+	private var entriesByID = [Int: Entry]()
+	private var idsByKey = [Key: [Int]]()
+	private var nextSequence = 0
+	private var cachedActivities: [Activity]?
+
+	var isEmpty: Bool {
+		entriesByID.isEmpty
+	}
+
+	var count: Int {
+		entriesByID.count
+	}
+
+	/// In the order they were inserted. Cached until the next change.
+	var activities: [Activity] {
+		if let cachedActivities {
+			return cachedActivities
+		}
+		let activities = entriesByID.values.sorted { $0.sequence < $1.sequence }.map { $0.activity }
+		cachedActivities = activities
+		return activities
+	}
+
+	func insert(_ activity: Activity) {
+		entriesByID[activity.id] = Entry(sequence: nextSequence, activity: activity)
+		nextSequence += 1
+		idsByKey[Key(owner: activity.owner, kind: activity.kind), default: [Int]()].append(activity.id)
+		cachedActivities = nil
+	}
+
+	func remove(_ activity: Activity) {
+		guard entriesByID.removeValue(forKey: activity.id) != nil else {
+			return
+		}
+		let key = Key(owner: activity.owner, kind: activity.kind)
+		idsByKey[key]?.removeAll { $0 == activity.id }
+		if idsByKey[key]?.isEmpty ?? false {
+			idsByKey[key] = nil
+		}
+		cachedActivities = nil
+	}
+
+	func activity(id: Int) -> Activity? {
+		entriesByID[id]?.activity
+	}
+
+	/// The earliest-inserted activity for `(owner, kind)`.
+	func activity(owner: ActivityOwner, kind: ActivityKind) -> Activity? {
+		guard let ids = idsByKey[Key(owner: owner, kind: kind)], let id = ids.first else {
+			return nil
+		}
+		assert(ids.count <= 1, "Multiple activities for the same owner/kind; use the id-based API for concurrent same-kind work.")
+		return entriesByID[id]?.activity
+	}
+}
+
+/// The most recent completed activities, oldest first. When full, each
+/// append overwrites the oldest, instead of shifting the whole array.
+struct CompletedActivityBuffer {
+
+	let capacity: Int
+	private var storage = [Activity]()
+	private var oldestIndex = 0
+
+	init(capacity: Int) {
+		precondition(capacity > 0)
+		self.capacity = capacity
+		storage.reserveCapacity(capacity)
+	}
+
+	var count: Int {
+		storage.count
+	}
+
+	var activities: [Activity] {
+		if oldestIndex == 0 {
+			return storage
+		}
+		return Array(storage[oldestIndex...] + storage[..<oldestIndex])
+	}
+
+	mutating func append(_ activity: Activity) {
+		if storage.count < capacity {
+			storage.append(activity)
+			return
+		}
+		storage[oldestIndex] = activity
+		oldestIndex = (oldestIndex + 1) % capacity
+	}
+}
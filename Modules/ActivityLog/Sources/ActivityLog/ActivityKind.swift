@@ -48,6 +48,7 @@ public enum ActivityKind: Sendable, Hashable {
 	// Maintenance and lifecycle
 
 	case vacuumDatabase
+	case slowDatabaseQuery
 	case validateCredentials
 	case exportOPML
 
@@ -120,6 +121,8 @@ public enum ActivityKind: Sendable, Hashable {
 			return NSLocalizedString("Subscribing to zone changes", bundle: .module, comment: "Activity kind")
 		case .vacuumDatabase:
 			return NSLocalizedString("Vacuuming database", bundle: .module, comment: "Activity kind")
+		case .slowDatabaseQuery:
+			return NSLocalizedString("Slow database query", bundle: .module, comment: "Activity kind")
 		case .validateCredentials:
 			return NSLocalizedString("Validating credentials", bundle: .module, comment: "Activity kind")
 		case .exportOPML:
@@ -14,24 +14,53 @@ public extension Notification.Name {
 
 /// In-memory log of app activities (refreshes, downloads, status syncs).
 /// Each activity moves through pending → running → completed/failed.
-/// An `.activityDidChange` notification is posted onchange.
 /// Lifecycle transitions can be called either with `(owner, kind)`
 /// or with the id returned from `createActivity`.
+///
+/// Changes are coalesced: one `.activityDidChange` notification is posted
+/// per main run loop pass, no matter how many activities changed. Its
+/// userInfo has the changed activities — see `changedActivitiesKey`.
 @MainActor public final class ActivityLog {
 
 	public static let shared = ActivityLog()
 
+	/// userInfo key for `.activityDidChange`: the `[Activity]` that were created
+	/// or changed state since the last notification, in order of first change.
+	public static let changedActivitiesKey = "changedActivities"
+
 	/// Activities created but not yet started.
-	public private(set) var pendingActivities = [Activity]()
+	public var pendingActivities: [Activity] {
+		pending.activities
+	}
 
 	/// Activities currently in progress.
-	public private(set) var runningActivities = [Activity]()
+	public var runningActivities: [Activity] {
+		running.activities
+	}
 
-	/// Recently completed or failed activities.
-	public private(set) var completedActivities = [Activity]()
+	/// Recently completed or failed activities, oldest first.
+	public var completedActivities: [Activity] {
+		if let cachedCompletedActivities {
+			return cachedCompletedActivities
+		}
+		let activities = completed.activities
+		cachedCompletedActivities = activities
+		return activities
+	}
 
 	/// Maximum number of completed activities to retain.
-	public let completedActivitiesLimit = 500
+	public var completedActivitiesLimit: Int {
+		completed.capacity
+	}
+
+	private let pending = ActivityIndex()
+	private let running = ActivityIndex()
+	private var completed = CompletedActivityBuffer(capacity: 500)
+	private var cachedCompletedActivities: [Activity]?
+
+	private var changedActivities = [Activity]()
+	private var changedActivityIDs = Set<Int>()
+	private var isChangeNotificationScheduled = false
 
 	private var nextID = 0
 	private var nextTaskNumber = 1
@@ -55,9 +84,9 @@ public extension Notification.Name {
 		nextID += 1
 
 		let activity = Activity(id: id, owner: owner, kind: kind, detail: detail)
-		pendingActivities.append(activity)
+		pending.insert(activity)
 
-		postDidChangeNotification()
+		activityDidChange(activity)
 		return id
 	}
 
@@ -125,7 +154,7 @@ public extension Notification.Name {
 
 		activity.didStart()
 		movePendingToRunning(activity)
-		postDidChangeNotification()
+		activityDidChange(activity)
 	}
 
 	/// Moves the activity from pending to running if it's still pending,
@@ -142,7 +171,7 @@ public extension Notification.Name {
 
 		activity.didStartWithoutTimestamp()
 		movePendingToRunning(activity)
-		postDidChangeNotification()
+		activityDidChange(activity)
 	}
 
 	/// Completes the running activity matching `(owner, kind)`, promoting it from
@@ -158,7 +187,7 @@ public extension Notification.Name {
 		activity.durationIsSignificant = durationIsSignificant
 		activity.didComplete(message, returnedFromCache: returnedFromCache)
 		moveToCompleted(activity)
-		postDidChangeNotification()
+		activityDidChange(activity)
 	}
 
 	/// Fails the running activity matching `(owner, kind)`, promoting it from
@@ -174,7 +203,7 @@ public extension Notification.Name {
 		activity.durationIsSignificant = false
 		activity.didFail(error)
 		moveToCompleted(activity)
-		postDidChangeNotification()
+		activityDidChange(activity)
 	}
 
 	// MARK: - Lifecycle by ID
@@ -188,7 +217,7 @@ public extension Notification.Name {
 
 		activity.didStart()
 		movePendingToRunning(activity)
-		postDidChangeNotification()
+		activityDidChange(activity)
 	}
 
 	/// Completes the activity with `id`, promoting it from pending first if it was
@@ -203,7 +232,7 @@ public extension Notification.Name {
 		activity.durationIsSignificant = durationIsSignificant
 		activity.didComplete(message, returnedFromCache: returnedFromCache)
 		moveToCompleted(activity)
-		postDidChangeNotification()
+		activityDidChange(activity)
 	}
 
 	/// Fails the activity with `id`, promoting it from pending first if it was
@@ -218,7 +247,7 @@ public extension Notification.Name {
 		activity.durationIsSignificant = false
 		activity.didFail(error)
 		moveToCompleted(activity)
-		postDidChangeNotification()
+		activityDidChange(activity)
 	}
 
 	// MARK: - Queries
@@ -231,6 +260,18 @@ public extension Notification.Name {
 		runningActivities.filter { $0.owner == owner }
 	}
 
+	/// Post the pending `.activityDidChange` notification now rather than at
+	/// the end of this run loop pass. Does nothing if nothing changed.
+	public func postChangeNotificationIfNeeded() {
+		guard !changedActivities.isEmpty else {
+			return
+		}
+		let activities = changedActivities
+		changedActivities.removeAll()
+		changedActivityIDs.removeAll()
+		NotificationCenter.default.post(name: .activityDidChange, object: self, userInfo: [Self.changedActivitiesKey: activities])
+	}
+
 	public func completedActivities(for owner: ActivityOwner) -> [Activity] {
 		completedActivities.filter { $0.owner == owner }
 	}
@@ -271,41 +312,44 @@ private extension ActivityLog {
 	}
 
 	func findPendingActivity(owner: ActivityOwner, kind: ActivityKind) -> Activity? {
-		assert(pendingActivities.filter { $0.owner == owner && $0.kind == kind }.count <= 1, "Multiple pending activities for the same owner/kind; use the id-based API for concurrent same-kind work.")
-		return pendingActivities.first { $0.owner == owner && $0.kind == kind }
+		pending.activity(owner: owner, kind: kind)
 	}
 
 	func findPendingActivity(id: Int) -> Activity? {
-		pendingActivities.first { $0.id == id }
+		pending.activity(id: id)
 	}
 
 	func findRunningActivity(owner: ActivityOwner, kind: ActivityKind) -> Activity? {
-		assert(runningActivities.filter { $0.owner == owner && $0.kind == kind }.count <= 1, "Multiple running activities for the same owner/kind; use the id-based API for concurrent same-kind work.")
-		return runningActivities.first { $0.owner == owner && $0.kind == kind }
+		running.activity(owner: owner, kind: kind)
 	}
 
 	func findRunningActivity(id: Int) -> Activity? {
-		runningActivities.first { $0.id == id }
+		running.activity(id: id)
 	}
 
 	func movePendingToRunning(_ activity: Activity) {
-		pendingActivities.removeAll { $0 === activity }
-		runningActivities.append(activity)
+		pending.remove(activity)
+		running.insert(activity)
 	}
 
 	func moveToCompleted(_ activity: Activity) {
-		runningActivities.removeAll { $0 === activity }
-		completedActivities.append(activity)
-		trimCompletedActivities()
+		running.remove(activity)
+		completed.append(activity)
+		cachedCompletedActivities = nil
 	}
 
-	func trimCompletedActivities() {
-		if completedActivities.count > completedActivitiesLimit {
-			completedActivities.removeFirst(completedActivities.count - completedActivitiesLimit)
+	/// Records the change and schedules one notification for this run loop pass.
+	func activityDidChange(_ activity: Activity) {
+		if changedActivityIDs.insert(activity.id).inserted {
+			changedActivities.append(activity)
+		}
+		guard !isChangeNotificationScheduled else {
+			return
+		}
+		isChangeNotificationScheduled = true
+		DispatchQueue.main.async {
+			self.isChangeNotificationScheduled = false
+			self.postChangeNotificationIfNeeded()
 		}
-	}
-
-	func postDidChangeNotification() {
-		NotificationCenter.default.post(name: .activityDidChange, object: self)
 	}
 }
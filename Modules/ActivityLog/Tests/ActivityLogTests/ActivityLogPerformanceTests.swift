@@ -0,0 +1,41 @@
+//
+//  ActivityLogPerformanceTests.swift
+//  ActivityLog
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import XCTest
+@testable import ActivityLog
+
+// Performance tests stay in XCTest — Swift Testing doesn't have a `measure { }` equivalent yet.
+
+@MainActor final class ActivityLogPerformanceTests: XCTestCase {
+
+	/// A 5,000-feed refresh: every feed gets an activity up front, then each
+	/// is started and completed — half by id, half by (owner, kind).
+	func testSimulatedRefreshOf5000Feeds() {
+		let owner = ActivityOwner.account(accountID: "account1", displayName: "Account One")
+		let feedURLs = (0..<5000).map { "https://example.com/\($0)/feed.xml" }
+
+		measure {
+			let activityLog = ActivityLog()
+			var ids = [Int]()
+			ids.reserveCapacity(feedURLs.count)
+			for feedURL in feedURLs {
+				ids.append(activityLog.createActivity(owner: owner, kind: .refreshFeedContent(feedURL: feedURL)))
+			}
+			for (index, feedURL) in feedURLs.enumerated() {
+				if index.isMultiple(of: 2) {
+					activityLog.didStart(id: ids[index])
+					activityLog.didComplete(id: ids[index])
+				} else {
+					let kind = ActivityKind.refreshFeedContent(feedURL: feedURL)
+					activityLog.didStart(owner, kind: kind)
+					activityLog.didComplete(owner, kind: kind)
+				}
+			}
+			activityLog.postChangeNotificationIfNeeded()
+		}
+	}
+}
@@ -356,6 +356,49 @@ import Foundation
 		#expect(activityLog.runningActivities[0].startDate == startDate) // unchanged
 	}
 
+	@Test func completedActivitiesKeepsTheMostRecent() {
+		let activityLog = ActivityLog()
+		let total = activityLog.completedActivitiesLimit + 10
+
+		for i in 0..<total {
+			activityLog.logCompletedActivity(owner: .feedFinder, kind: .findFeed(urlString: "https://example.com/\(i)"))
+		}
+
+		let completed = activityLog.completedActivities
+		#expect(completed.count == activityLog.completedActivitiesLimit)
+		#expect(completed.first?.id == 10)
+		#expect(completed.last?.id == total - 1)
+		#expect(zip(completed, completed.dropFirst()).allSatisfy { $0.id < $1.id })
+	}
+
+	@Test func changeNotificationsAreCoalesced() async throws {
+		let activityLog = ActivityLog()
+		nonisolated(unsafe) var notifications = [Notification]()
+		let observer = NotificationCenter.default.addObserver(forName: .activityDidChange, object: activityLog, queue: nil) { note in
+			notifications.append(note)
+		}
+		defer {
+			NotificationCenter.default.removeObserver(observer)
+		}
+
+		let owner = ActivityOwner.account(accountID: "account1", displayName: "Account One")
+		for i in 0..<100 {
+			let id = activityLog.createActivity(owner: owner, kind: .refreshFeedContent(feedURL: "https://example.com/\(i)"))
+			activityLog.didStart(id: id)
+			activityLog.didComplete(id: id)
+		}
+		#expect(notifications.isEmpty)
+
+		activityLog.postChangeNotificationIfNeeded()
+		#expect(notifications.count == 1)
+		let changedActivities = notifications.first?.userInfo?[ActivityLog.changedActivitiesKey] as? [Activity]
+		#expect(changedActivities?.count == 100)
+
+		// The scheduled notification finds nothing left to post.
+		try await Task.sleep(for: .milliseconds(50))
+		#expect(notifications.count == 1)
+	}
+
 	@Test func nextTaskNumberStringIncrements() {
 		let activityLog = ActivityLog()
 
@@ -0,0 +1,66 @@
+//
+//  Article+DateOrder.swift
+//  Articles
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+
+// Timeline order: by logicalDatePublished in the given direction,
+// with ties broken by articleID (always ascending) so the order is stable.
+
+public extension Article {
+
+	func precedesByDate(_ article: Article, sortDirection: ComparisonResult) -> Bool {
+		let date1 = logicalDatePublished
+		let date2 = article.logicalDatePublished
+		if date1 == date2 {
+			return articleID < article.articleID
+		}
+		return sortDirection == .orderedDescending ? date1 > date2 : date1 < date2
+	}
+}
+
+public extension Sequence where Element == Article {
+
+	func sortedByLogicalDate(_ sortDirection: ComparisonResult) -> [Article] {
+		sorted { $0.precedesByDate($1, sortDirection: sortDirection) }
+	}
+}
+
+public extension Array where Element == Article {
+
+	/// Merges arrays that are each already in timeline order — one per account —
+	/// into a single array in timeline order, without sorting again.
+	///
+	/// There’s one array per account, so k is small, and picking the next
+	/// article by scanning the k heads is cheaper than keeping a heap.
+	static func mergedByLogicalDate(_ sortedArrays: [[Article]], sortDirection: ComparisonResult) -> [Article] {
+		let nonEmptyArrays = sortedArrays.filter { !$0.isEmpty }
+		if nonEmptyArrays.count < 2 {
+			return nonEmptyArrays.first ?? []
+		}
+
+		var mergedArticles = [Article]()
+		mergedArticles.reserveCapacity(nonEmptyArrays.reduce(0) { $0 + $1.count })
+		var heads = [Int](repeating: 0, count: nonEmptyArrays.count)
+
+		while true {
+			var nextIndex: Int?
+			for i in nonEmptyArrays.indices where heads[i] < nonEmptyArrays[i].count {
+				if let n = nextIndex, !nonEmptyArrays[i][heads[i]].precedesByDate(nonEmptyArrays[n][heads[n]], sortDirection: sortDirection) {
+					continue
+				}
+				nextIndex = i
+			}
+			guard let i = nextIndex else {
+				break
+			}
+			mergedArticles.append(nonEmptyArrays[i][heads[i]])
+			heads[i] += 1
+		}
+
+		return mergedArticles
+	}
+}
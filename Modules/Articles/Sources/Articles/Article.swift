@@ -28,8 +28,9 @@ public final class Article: Hashable, Sendable {
 	public let dateModified: Date?
 	public let authors: Set<Author>?
 	public let status: ArticleStatus
+	public let preview: String? // Plain-text start of the body, made at ingest. Nil for articles stored before previews were.
 
-	public init(accountID: String, articleID: String?, feedID: String, uniqueID: String, title: String?, contentHTML: String?, contentText: String?, markdown: String?, url: String?, externalURL: String?, summary: String?, imageURL: String?, datePublished: Date?, dateModified: Date?, authors: Set<Author>?, status: ArticleStatus) {
+	public init(accountID: String, articleID: String?, feedID: String, uniqueID: String, title: String?, contentHTML: String?, contentText: String?, markdown: String?, url: String?, externalURL: String?, summary: String?, imageURL: String?, datePublished: Date?, dateModified: Date?, authors: Set<Author>?, status: ArticleStatus, preview: String? = nil) {
 		self.accountID = accountID
 		self.feedID = feedID
 		self.uniqueID = uniqueID
@@ -45,6 +46,7 @@ public final class Article: Hashable, Sendable {
 		self.dateModified = dateModified
 		self.authors = authors
 		self.status = status
+		self.preview = preview
 
 		if let articleID = articleID {
 			self.articleID = articleID
@@ -54,7 +56,12 @@ public final class Article: Hashable, Sendable {
 	}
 
 	public static func calculatedArticleID(feedID: String, uniqueID: String) -> String {
-		return "\(feedID) \(uniqueID)".md5String
+		String.md5String(feedID, spaceSeparated: uniqueID)
+	}
+
+	/// The date shown in, and sorted by, the timeline.
+	public var logicalDatePublished: Date {
+		datePublished ?? dateModified ?? status.dateArrived
 	}
 
 	// MARK: - Hashable
@@ -65,6 +72,7 @@ public final class Article: Hashable, Sendable {
 
 	// MARK: - Equatable
 
+	// `preview` is derived from the body, so it’s left out.
 	static public func ==(lhs: Article, rhs: Article) -> Bool {
 		return lhs.articleID == rhs.articleID && lhs.accountID == rhs.accountID && lhs.feedID == rhs.feedID && lhs.uniqueID == rhs.uniqueID && lhs.title == rhs.title && lhs.contentHTML == rhs.contentHTML && lhs.contentText == rhs.contentText && lhs.rawLink == rhs.rawLink && lhs.rawExternalLink == rhs.rawExternalLink && lhs.summary == rhs.summary && lhs.rawImageLink == rhs.rawImageLink && lhs.datePublished == rhs.datePublished && lhs.dateModified == rhs.dateModified && lhs.authors == rhs.authors
 	}
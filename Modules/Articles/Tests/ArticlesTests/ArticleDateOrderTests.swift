@@ -0,0 +1,54 @@
+//
+//  ArticleDateOrderTests.swift
+//  ArticlesTests
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import Testing
+
+@testable import Articles
+
+@Suite struct ArticleDateOrderTests {
+
+	@Test(arguments: [ComparisonResult.orderedDescending, .orderedAscending])
+	func mergeMatchesSortingEverything(sortDirection: ComparisonResult) {
+		// Three accounts of different sizes, with shared dates to exercise the articleID tie-break.
+		let accounts = [
+			(0..<50).map { makeArticle(accountID: "iCloud", index: $0, daysAgo: $0 % 17) },
+			(0..<20).map { makeArticle(accountID: "Feedbin", index: $0, daysAgo: $0 % 5) },
+			(0..<35).map { makeArticle(accountID: "Local", index: $0, daysAgo: ($0 * 7) % 23) }
+		]
+
+		let merged = Array.mergedByLogicalDate(accounts.map { $0.sortedByLogicalDate(sortDirection) }, sortDirection: sortDirection)
+		let sorted = accounts.flatMap { $0 }.sortedByLogicalDate(sortDirection)
+
+		#expect(merged.map(\.articleID) == sorted.map(\.articleID))
+	}
+
+	@Test func mergeHandlesEmptyArrays() {
+		let articles = (0..<3).map { makeArticle(accountID: "Local", index: $0, daysAgo: $0) }
+
+		#expect(Array.mergedByLogicalDate([], sortDirection: .orderedDescending).isEmpty)
+		#expect(Array.mergedByLogicalDate([[], articles, []], sortDirection: .orderedDescending) == articles)
+	}
+
+	@Test func logicalDateFallsBackToDateArrived() {
+		let dateArrived = Date(timeIntervalSince1970: 1_000)
+		let status = ArticleStatus(articleID: "1", read: false, dateArrived: dateArrived)
+		let article = Article(accountID: "Local", articleID: "1", feedID: "feed", uniqueID: "1", title: nil, contentHTML: nil, contentText: nil, markdown: nil, url: nil, externalURL: nil, summary: nil, imageURL: nil, datePublished: nil, dateModified: nil, authors: nil, status: status)
+
+		#expect(article.logicalDatePublished == dateArrived)
+	}
+}
+
+private extension ArticleDateOrderTests {
+
+	func makeArticle(accountID: String, index: Int, daysAgo: Int) -> Article {
+		let articleID = "\(accountID)-\(index)"
+		let datePublished = Date(timeIntervalSince1970: 1_800_000_000 - TimeInterval(daysAgo * 86_400))
+		let status = ArticleStatus(articleID: articleID, read: false, dateArrived: datePublished)
+		return Article(accountID: accountID, articleID: articleID, feedID: "feed", uniqueID: articleID, title: nil, contentHTML: nil, contentText: nil, markdown: nil, url: nil, externalURL: nil, summary: nil, imageURL: nil, datePublished: datePublished, dateModified: nil, authors: nil, status: status)
+	}
+}
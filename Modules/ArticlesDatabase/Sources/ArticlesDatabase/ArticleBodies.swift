@@ -0,0 +1,96 @@
+//
+//  ArticleBodies.swift
+//  ArticlesDatabase
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import CryptoKit
+import RSDatabase
+import RSDatabaseObjC
+
+/// Shared storage for `contentHTML`, keyed by a hash of the content.
+///
+/// The same story often arrives through several feeds — the site’s own
+/// feed, a topic feed, an aggregator. Its body is stored once, in
+/// `articleBodies`; each article row has the `bodyHash` and a null
+/// `contentHTML`. Article fetches left-join `articleBodies`, so the body
+/// comes back as `sharedContentHTML`.
+///
+/// `referenceCount` is kept by triggers on `articles`, and a body is
+/// deleted along with its last article. An `insert or replace` doesn’t
+/// fire delete triggers, so a count can be left too high — the
+/// `deleteUnreferencedBodiesJob` cleanup catches those bodies.
+///
+/// Each account has its own database, so bodies are shared across feeds
+/// within an account, not across accounts.
+enum ArticleBodies {
+
+	static let tableName = "articleBodies"
+
+	/// Shorter bodies stay in the article row: sharing them saves little,
+	/// and costs a hash on save and a join on fetch.
+	static let minimumLength = 1024
+
+	/// The column is not `contentHTML`, so that `select *` from the join
+	/// has just one `contentHTML`.
+	static let createStatement = "CREATE TABLE if not EXISTS articleBodies (bodyHash TEXT NOT NULL PRIMARY KEY, sharedContentHTML TEXT, referenceCount INTEGER NOT NULL DEFAULT 0);"
+
+	/// Run once `articles.bodyHash` exists — older databases get it by migration.
+	static let triggerStatements = """
+	CREATE TRIGGER if not EXISTS articles_after_insert_trigger_retain_body after insert on articles when NEW.bodyHash is not null begin update articleBodies set referenceCount = referenceCount + 1 where bodyHash = NEW.bodyHash; end;
+	CREATE TRIGGER if not EXISTS articles_after_update_trigger_retain_body after update of bodyHash on articles when OLD.bodyHash is not NEW.bodyHash begin update articleBodies set referenceCount = referenceCount + 1 where bodyHash = NEW.bodyHash; update articleBodies set referenceCount = referenceCount - 1 where bodyHash = OLD.bodyHash; delete from articleBodies where bodyHash = OLD.bodyHash and referenceCount < 1; end;
+	CREATE TRIGGER if not EXISTS articles_after_delete_trigger_release_body after delete on articles when OLD.bodyHash is not null begin update articleBodies set referenceCount = referenceCount - 1 where bodyHash = OLD.bodyHash; delete from articleBodies where bodyHash = OLD.bodyHash and referenceCount < 1; end;
+	"""
+
+	/// Stores `contentHTML` if it’s long enough to share, and returns its hash.
+	/// Returns nil when it isn’t — then it belongs in the article row.
+	///
+	/// Call before inserting or updating the article row, so that the
+	/// trigger finds the body to count.
+	static func save(_ contentHTML: String?, compressesBodies: Bool, _ database: FMDatabase) -> String? {
+		guard let contentHTML, contentHTML.utf8.count >= minimumLength else {
+			return nil
+		}
+		let bodyHash = hash(contentHTML)
+
+		// Compress only the first copy.
+		if !exists(bodyHash, database) {
+			let value: Any = compressesBodies ? ArticleBodyCompression.databaseValue(contentHTML) : contentHTML
+			database.executeUpdate("insert into articleBodies (bodyHash, sharedContentHTML) values (?, ?);", withArgumentsIn: [bodyHash, value])
+		}
+		return bodyHash
+	}
+
+	/// SHA-256 rather than the MD5 used for article IDs: bodies come from feeds,
+	/// and a feed able to forge a collision could replace another article’s body.
+	static func hash(_ contentHTML: String) -> String {
+		let digest = SHA256.hash(data: Data(contentHTML.utf8))
+		return digest.reduce(into: "") { hex, byte in
+			hex += hexDigits[Int(byte >> 4)]
+			hex += hexDigits[Int(byte & 0x0F)]
+		}
+	}
+
+	/// Deletes bodies no article uses — the ones a replaced row left behind.
+	static func deleteUnreferencedBodiesJob() -> DatabaseMaintenanceJob {
+		let whereClause = "not exists (select 1 from articles a where a.bodyHash = articleBodies.bodyHash)"
+		return DatabaseMaintenanceJob(name: "deleteUnreferencedArticleBodies", tableName: tableName, whereClause: whereClause)
+	}
+}
+
+private extension ArticleBodies {
+
+	static let hexDigits = "0123456789abcdef".map { String($0) }
+
+	static func exists(_ bodyHash: String, _ database: FMDatabase) -> Bool {
+		guard let resultSet = database.executeQuery("select 1 from articleBodies where bodyHash = ? limit 1;", withArgumentsIn: [bodyHash]) else {
+			return false
+		}
+		defer {
+			resultSet.close()
+		}
+		return resultSet.next()
+	}
+}
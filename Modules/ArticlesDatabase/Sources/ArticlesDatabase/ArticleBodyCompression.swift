@@ -0,0 +1,78 @@
+//
+//  ArticleBodyCompression.swift
+//  ArticlesDatabase
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import os
+import RSCore
+import RSDatabase
+import RSDatabaseObjC
+
+/// Optional compressed storage for the body columns — `contentHTML`,
+/// `contentText`, `markdown`, and `summary`. For full-content feeds these
+/// are most of the database, and feed HTML compresses well.
+///
+/// A compressed body is stored as a zlib (raw DEFLATE) BLOB in the same
+/// TEXT column; SQLite keeps a BLOB as a BLOB regardless of the column’s
+/// affinity. Reading checks the stored type, so a database can hold both
+/// — turning compression on or off never requires rewriting rows.
+///
+/// Bodies are decompressed as rows are read, on the database queue. The
+/// search index is always fed uncompressed text.
+enum ArticleBodyCompression {
+
+	static let columns: Set<String> = [DatabaseKey.contentHTML, DatabaseKey.contentText, DatabaseKey.markdown, DatabaseKey.summary]
+
+	/// Shorter bodies are stored as text: compressing them saves little,
+	/// and costs a decompress on every read.
+	static let minimumLength = 1024
+
+	private static let logger = Logger(subsystem: Logger.nnwSubsystem, category: "ArticleBodyCompression")
+
+	/// The value to store for `body`: compressed `Data`, or `body` itself
+	/// when it’s short or doesn’t compress.
+	static func databaseValue(_ body: String) -> Any {
+		let utf8 = Data(body.utf8)
+		guard utf8.count >= minimumLength else {
+			return body
+		}
+		guard let compressed = try? (utf8 as NSData).compressed(using: .zlib) as Data, compressed.count < utf8.count else {
+			return body
+		}
+		return compressed
+	}
+
+	/// Replaces body values in a row dictionary with their stored form.
+	static func compressBodies(_ dictionary: inout DatabaseDictionary) {
+		for column in columns {
+			if let body = dictionary[column] as? String {
+				dictionary[column] = databaseValue(body)
+			}
+		}
+	}
+
+	/// Reads a body column, decompressing it if it was stored compressed.
+	static func body(_ row: FMResultSet, _ column: String) -> String? {
+		guard let value = row.object(forColumnName: column) else {
+			return nil
+		}
+		if let string = value as? String {
+			return string
+		}
+		if let data = value as? Data {
+			return decompressed(data)
+		}
+		return nil // NSNull
+	}
+
+	static func decompressed(_ data: Data) -> String? {
+		guard let decompressed = try? (data as NSData).decompressed(using: .zlib) as Data else {
+			logger.error("ArticleBodyCompression: could not decompress a \(data.count, privacy: .public)-byte body")
+			return nil
+		}
+		return String(decoding: decompressed, as: UTF8.self)
+	}
+}
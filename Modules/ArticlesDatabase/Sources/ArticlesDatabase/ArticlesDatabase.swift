@@ -23,19 +23,45 @@ public struct ArticleChanges: Sendable {
 	public let updated: Set<Article>?
 	public let deleted: Set<Article>?
 
+	/// Where the time went, for a feed-based update that got as far as
+	/// comparing articles. Nil otherwise.
+	public let timing: ArticleUpdateTiming?
+
 	public init() {
 		self.new = Set<Article>()
 		self.updated = Set<Article>()
 		self.deleted = Set<Article>()
+		self.timing = nil
 	}
 
-	public init(new: Set<Article>?, updated: Set<Article>?, deleted: Set<Article>?) {
+	public init(new: Set<Article>?, updated: Set<Article>?, deleted: Set<Article>?, timing: ArticleUpdateTiming? = nil) {
 		self.new = new
 		self.updated = updated
 		self.deleted = deleted
+		self.timing = timing
 	}
 }
 
+/// Time spent saving one feed’s parsed items, up to when the changes are
+/// reported. Deleting articles gone from the feed and search indexing
+/// happen later in the same transaction, so they aren’t counted here.
+public struct ArticleUpdateTiming: Sendable {
+
+	/// Waiting for the database queue.
+	public let queueWaitMilliseconds: Double
+
+	/// Ensuring statuses, making articles from the parsed items, and
+	/// fetching the feed’s stored articles to compare against.
+	public let diffMilliseconds: Double
+
+	/// Saving new and changed articles.
+	public let writeMilliseconds: Double
+
+	/// CPU time of the database thread for the diff and the write.
+	public let diffCPUMilliseconds: Double
+	public let writeCPUMilliseconds: Double
+}
+
 /// Aggregate counts for a single account's articles database.
 public struct ArticleCounts: Sendable {
 	public let totalCount: Int
@@ -44,6 +70,40 @@ public struct ArticleCounts: Sendable {
 	public let statusesCount: Int
 }
 
+/// Which articles `fetchArticlesPage` returns, besides being in the given feeds.
+public struct ArticlesPageFilter: Sendable {
+	public var unreadOnly: Bool
+	public var starredOnly: Bool
+	public var todayOnly: Bool
+
+	public init(unreadOnly: Bool = false, starredOnly: Bool = false, todayOnly: Bool = false) {
+		self.unreadOnly = unreadOnly
+		self.starredOnly = starredOnly
+		self.todayOnly = todayOnly
+	}
+}
+
+/// Where a page ended: the last row’s logical date — as stored, so it compares
+/// exactly — and articleID. Pass it back to get the following page.
+public struct ArticlesPageCursor: Hashable, Sendable {
+	let logicalDate: Double
+	let articleID: String
+}
+
+/// Articles in timeline order: by logical date (datePublished, else dateModified,
+/// else dateArrived), ties broken by articleID.
+public struct ArticlesPage: Sendable {
+	public let articles: [Article]
+
+	/// Nil when this is the last page.
+	public let nextCursor: ArticlesPageCursor?
+
+	public init(articles: [Article], nextCursor: ArticlesPageCursor?) {
+		self.articles = articles
+		self.nextCursor = nextCursor
+	}
+}
+
 @MainActor public final class ArticlesDatabase {
 	public enum RetentionStyle: Sendable {
 		case feedBased // Local and iCloud: article retention is defined by contents of feed
@@ -54,44 +114,79 @@ public struct ArticleCounts: Sendable {
 
 	private let articlesTable: ArticlesTable
 	private let queue: DatabaseQueue
-	private let operationQueue = MainThreadOperationQueue()
+	private let operationExecutor = OperationExecutor()
 	private let retentionStyle: RetentionStyle
 	private let accountID: String
 
 	nonisolated private static let logger = Logger(subsystem: Logger.nnwSubsystem, category: "ArticlesDatabase")
 
-	public init(databaseFilePath: String, accountID: String, retentionStyle: RetentionStyle) {
+	/// With `compressesBodies`, article bodies are written compressed. Either
+	/// way, compressed and uncompressed bodies are both readable.
+	public init(databaseFilePath: String, accountID: String, retentionStyle: RetentionStyle, compressesBodies: Bool = false) {
 		Self.logger.debug("Articles Database init \(accountID, privacy: .public)")
 
 		self.databasePath = databaseFilePath
 		let queue = DatabaseQueue(databasePath: databaseFilePath)
 		self.queue = queue
-		self.articlesTable = ArticlesTable(name: DatabaseTableName.articles, accountID: accountID, queue: queue, retentionStyle: retentionStyle)
+		self.articlesTable = ArticlesTable(name: DatabaseTableName.articles, accountID: accountID, queue: queue, retentionStyle: retentionStyle, compressesBodies: compressesBodies)
 		self.retentionStyle = retentionStyle
 		self.accountID = accountID
 
 		queue.runCreateStatements(ArticlesDatabase.tableCreationStatements)
+
+		// Add columns missing from older databases. This can’t be deferred:
+		// it must be ahead of any insert on the serial queue.
 		queue.runInDatabase { database in
-			Self.logger.debug("ArticlesDatabase: creating tables \(accountID, privacy: .public)")
-			if !self.articlesTable.containsColumn("searchRowID", in: database) {
+			let columnNames = self.articlesTable.columnNames(in: database)
+			if !columnNames.contains("searchrowid") {
 				database.executeStatements("ALTER TABLE articles add column searchRowID INTEGER;")
 			}
-			if !self.articlesTable.containsColumn("markdown", in: database) {
+			if !columnNames.contains("markdown") {
 				Self.logger.debug("ArticlesDatabase: adding markdown column \(accountID, privacy: .public)")
 				database.executeStatements("ALTER TABLE articles add column markdown TEXT;")
 			}
-			if !self.articlesTable.containsColumn("authors", in: database) {
+			if !columnNames.contains("authors") {
 				Self.logger.debug("ArticlesDatabase: adding authors column \(accountID, privacy: .public)")
 				database.executeStatements("ALTER TABLE articles add column authors TEXT;")
 			}
+			if !columnNames.contains("preview") {
+				Self.logger.debug("ArticlesDatabase: adding preview column \(accountID, privacy: .public)")
+				database.executeStatements("ALTER TABLE articles add column preview TEXT;")
+			}
+			if !columnNames.contains("bodyhash") {
+				Self.logger.debug("ArticlesDatabase: adding bodyHash column \(accountID, privacy: .public)")
+				database.executeStatements("ALTER TABLE articles add column bodyHash TEXT;")
+			}
+			database.executeStatements(ArticleBodies.triggerStatements)
+
+			// Articles with the same body may share a search row, so the
+			// search row goes only with the last of them.
+			database.executeStatements("DROP TRIGGER if EXISTS articles_after_delete_trigger_delete_search_text;")
+		}
+	}
+
+	// MARK: - Deferred Startup Work
+
+	/// Housekeeping that isn’t needed to show articles: dropping legacy
+	/// tables and indexes, schema migrations, the authors backfill, and
+	/// indexing unindexed articles for search. Call once, after the UI is up.
+	public func runDeferredStartupWork() {
+		Self.logger.debug("ArticlesDatabase: \(#function, privacy: .public) \(self.accountID, privacy: .public)")
+
+		queue.runInDatabase { database in
 			database.executeStatements("CREATE INDEX if not EXISTS articles_searchRowID on articles(searchRowID);")
+			database.executeStatements("CREATE INDEX if not EXISTS articles_bodyHash on articles(bodyHash);")
 			database.executeStatements("DROP TABLE if EXISTS tags;DROP INDEX if EXISTS tags_tagName_index;DROP INDEX if EXISTS articles_feedID_index;DROP INDEX if EXISTS statuses_read_index;DROP TABLE if EXISTS attachments;DROP TABLE if EXISTS attachmentsLookup;")
 		}
 
-		DispatchQueue.main.async {
-			self.articlesTable.indexUnindexedArticles()
+		// Rebuilding statuses holds the queue for as long as the copy takes,
+		// so let waiting fetches and saves go first.
+		queue.runInDatabase(priority: .maintenance) { [accountID] database in
+			StatusesSchemaMigration.migrateIfNeeded(database, accountID: accountID)
 		}
 
+		articlesTable.indexUnindexedArticles()
+
 		// Backfill the authors JSON column cooperatively, yielding between batches
 		// so that other database work (fetches, etc.) can interleave.
 		Task.detached { [accountID, queue] in
@@ -173,6 +268,15 @@ public struct ArticleCounts: Sendable {
 		return articlesTable.fetchArticlesMatchingWithArticleIDs(searchString, articleIDs)
 	}
 
+	/// Fetches one page of articles in timeline order, starting after `cursor`
+	/// (or at the top). Keyset pagination: each page costs the same no matter
+	/// how deep into the timeline it is, and only `limit` articles are built.
+	public func fetchArticlesPage(feedIDs: Set<String>, filter: ArticlesPageFilter, sortDirection: ComparisonResult, after cursor: ArticlesPageCursor?, limit: Int) -> ArticlesPage {
+		Self.logger.debug("ArticlesDatabase: \(#function, privacy: .public) \(self.accountID, privacy: .public)")
+		let since = filter.todayOnly ? todayCutoffDate() : nil
+		return articlesTable.fetchArticlesPage(feedIDs, filter, since, sortDirection, cursor, limit)
+	}
+
 	/// Returns a dictionary of feedID → latest article date for all feeds with articles.
 	public func fetchLastUpdateDates() async -> [String: Date] {
 		Self.logger.debug("ArticlesDatabase: \(#function, privacy: .public) \(self.accountID, privacy: .public)")
@@ -185,17 +289,23 @@ public struct ArticleCounts: Sendable {
 
 	// MARK: - Fetching Articles Async
 
-	public func fetchArticlesAsync(feedID: String) async -> Set<Article> {
+	// Timeline and search fetches take an optional cancellation token.
+	// Canceling it drops a fetch still waiting in the database queue and
+	// interrupts one that’s running, and the fetch then returns an empty set —
+	// so a caller that passes a token checks it before using the result.
+	// Without a token, a fetch always runs to completion.
+
+	public func fetchArticlesAsync(feedID: String, cancellationToken: DatabaseCancellationToken? = nil) async -> Set<Article> {
 		await withCheckedContinuation { continuation in
-			_fetchArticlesAsync(feedID: feedID) { articles in
+			_fetchArticlesAsync(feedID: feedID, cancellationToken: cancellationToken) { articles in
 				continuation.resume(returning: articles)
 			}
 		}
 	}
 
-	public func fetchArticlesAsync(feedIDs: Set<String>) async -> Set<Article> {
+	public func fetchArticlesAsync(feedIDs: Set<String>, cancellationToken: DatabaseCancellationToken? = nil) async -> Set<Article> {
 		await withCheckedContinuation { continuation in
-			_fetchArticlesAsync(feedIDs: feedIDs) { articles in
+			_fetchArticlesAsync(feedIDs: feedIDs, cancellationToken: cancellationToken) { articles in
 				continuation.resume(returning: articles)
 			}
 		}
@@ -209,41 +319,51 @@ public struct ArticleCounts: Sendable {
 		}
 	}
 
-	public func fetchUnreadArticlesAsync(feedIDs: Set<String>, limit: Int? = nil) async -> Set<Article> {
+	public func fetchUnreadArticlesAsync(feedIDs: Set<String>, limit: Int? = nil, cancellationToken: DatabaseCancellationToken? = nil) async -> Set<Article> {
 		await withCheckedContinuation { continuation in
-			_fetchUnreadArticlesAsync(feedIDs: feedIDs, limit: limit) { articles in
+			_fetchUnreadArticlesAsync(feedIDs: feedIDs, limit: limit, cancellationToken: cancellationToken) { articles in
 				continuation.resume(returning: articles)
 			}
 		}
 	}
 
-	public func fetchTodayArticlesAsync(feedIDs: Set<String>, limit: Int? = nil) async -> Set<Article> {
+	public func fetchTodayArticlesAsync(feedIDs: Set<String>, limit: Int? = nil, cancellationToken: DatabaseCancellationToken? = nil) async -> Set<Article> {
 		await withCheckedContinuation { continuation in
-			_fetchTodayArticlesAsync(feedIDs: feedIDs, limit: limit) { articles in
+			_fetchTodayArticlesAsync(feedIDs: feedIDs, limit: limit, cancellationToken: cancellationToken) { articles in
 				continuation.resume(returning: articles)
 			}
 		}
 	}
 
-	public func fetchedStarredArticlesAsync(feedIDs: Set<String>, limit: Int? = nil) async -> Set<Article> {
+	public func fetchedStarredArticlesAsync(feedIDs: Set<String>, limit: Int? = nil, cancellationToken: DatabaseCancellationToken? = nil) async -> Set<Article> {
 		await withCheckedContinuation { continuation in
-			_fetchedStarredArticlesAsync(feedIDs: feedIDs, limit: limit) { articles in
+			_fetchedStarredArticlesAsync(feedIDs: feedIDs, limit: limit, cancellationToken: cancellationToken) { articles in
 				continuation.resume(returning: articles)
 			}
 		}
 	}
 
-	public func fetchArticlesMatchingAsync(searchString: String, feedIDs: Set<String>) async -> Set<Article> {
+	public func fetchArticlesPageAsync(feedIDs: Set<String>, filter: ArticlesPageFilter, sortDirection: ComparisonResult, after cursor: ArticlesPageCursor?, limit: Int) async -> ArticlesPage {
+		Self.logger.debug("ArticlesDatabase: \(#function, privacy: .public) \(self.accountID, privacy: .public)")
+		let since = filter.todayOnly ? todayCutoffDate() : nil
+		return await withCheckedContinuation { continuation in
+			articlesTable.fetchArticlesPageAsync(feedIDs, filter, since, sortDirection, cursor, limit) { page in
+				continuation.resume(returning: page)
+			}
+		}
+	}
+
+	public func fetchArticlesMatchingAsync(searchString: String, feedIDs: Set<String>, cancellationToken: DatabaseCancellationToken? = nil) async -> Set<Article> {
 		await withCheckedContinuation { continuation in
-			_fetchArticlesMatchingAsync(searchString: searchString, feedIDs: feedIDs) { articles in
+			_fetchArticlesMatchingAsync(searchString: searchString, feedIDs: feedIDs, cancellationToken: cancellationToken) { articles in
 				continuation.resume(returning: articles)
 			}
 		}
 	}
 
-	public func fetchArticlesMatchingWithArticleIDsAsync(searchString: String, articleIDs: Set<String>) async -> Set<Article> {
+	public func fetchArticlesMatchingWithArticleIDsAsync(searchString: String, articleIDs: Set<String>, cancellationToken: DatabaseCancellationToken? = nil) async -> Set<Article> {
 		await withCheckedContinuation { continuation in
-			_fetchArticlesMatchingWithArticleIDsAsync(searchString: searchString, articleIDs: articleIDs) { articles in
+			_fetchArticlesMatchingWithArticleIDsAsync(searchString: searchString, articleIDs: articleIDs, cancellationToken: cancellationToken) { articles in
 				continuation.resume(returning: articles)
 			}
 		}
@@ -253,11 +373,17 @@ public struct ArticleCounts: Sendable {
 
 	/// Fetch all non-zero unread counts.
 	public func fetchAllUnreadCountsAsync() async -> UnreadCountDictionary? {
-		await withCheckedContinuation { continuation in
-			_fetchAllUnreadCounts { unreadCountDictionary in
-				continuation.resume(returning: unreadCountDictionary)
-			}
+		Self.logger.debug("ArticlesDatabase: \(#function, privacy: .public) \(self.accountID, privacy: .public)")
+		let operation = FetchAllUnreadCountsOperation(databaseQueue: queue)
+
+		// Only the latest fetch matters. An earlier one that gets canceled returns an empty dictionary.
+		if let operationName = operation.name {
+			await operationExecutor.cancel(named: operationName)
 		}
+		await operationExecutor.add(operation)
+		await operation.waitUntilFinished()
+
+		return operation.unreadCountDictionary ?? UnreadCountDictionary()
 	}
 
 	/// Fetch unread count for a single feed.
@@ -412,18 +538,30 @@ public struct ArticleCounts: Sendable {
 
 	// MARK: - Cleanup
 
-	/// Calls the various clean-up functions. To be used only at startup.
+	/// Runs the various clean-up jobs. To be used only at startup.
 	///
 	/// This prevents the database from growing forever. If we didn’t do this:
 	/// 1) The database would grow to an inordinate size, and
 	/// 2) the app would become very slow.
+	///
+	/// The jobs run in the background in small slices, so other database
+	/// work isn’t held up behind them. An unfinished job resumes next launch.
 	public func cleanupDatabaseAtStartup(subscribedToFeedIDs: Set<String>) {
 		Self.logger.debug("ArticlesDatabase: \(#function, privacy: .public) \(self.accountID, privacy: .public)")
-		if retentionStyle == .syncSystem {
-			articlesTable.deleteOldArticles()
+		let jobs = articlesTable.cleanupJobs(subscribedToFeedIDs: subscribedToFeedIDs)
+		Task.detached(priority: .utility) { [queue] in
+			let scheduler = DatabaseMaintenanceScheduler(queue: queue)
+			await scheduler.run(jobs)
 		}
-		articlesTable.deleteArticlesNotInSubscribedToFeedIDs(subscribedToFeedIDs)
-		articlesTable.deleteOldStatuses()
+	}
+
+	/// Runs the same clean-up jobs, returning when they’re done — or have
+	/// stopped early, to resume next time.
+	@discardableResult
+	public func cleanupDatabase(subscribedToFeedIDs: Set<String>) async -> [DatabaseMaintenanceReport] {
+		let jobs = articlesTable.cleanupJobs(subscribedToFeedIDs: subscribedToFeedIDs)
+		let scheduler = DatabaseMaintenanceScheduler(queue: queue)
+		return await scheduler.run(jobs)
 	}
 }
 
@@ -432,9 +570,11 @@ public struct ArticleCounts: Sendable {
 private extension ArticlesDatabase {
 
 	static let tableCreationStatements = """
-	CREATE TABLE if not EXISTS articles (articleID TEXT NOT NULL PRIMARY KEY, feedID TEXT NOT NULL, uniqueID TEXT NOT NULL, title TEXT, contentHTML TEXT, contentText TEXT, markdown TEXT, url TEXT, externalURL TEXT, summary TEXT, imageURL TEXT, bannerImageURL TEXT, datePublished DATE, dateModified DATE, searchRowID INTEGER, authors TEXT);
+	CREATE TABLE if not EXISTS articles (articleID TEXT NOT NULL PRIMARY KEY, feedID TEXT NOT NULL, uniqueID TEXT NOT NULL, title TEXT, contentHTML TEXT, contentText TEXT, markdown TEXT, url TEXT, externalURL TEXT, summary TEXT, imageURL TEXT, bannerImageURL TEXT, datePublished DATE, dateModified DATE, searchRowID INTEGER, authors TEXT, preview TEXT, bodyHash TEXT);
 
-	CREATE TABLE if not EXISTS statuses (articleID TEXT NOT NULL PRIMARY KEY, read BOOL NOT NULL DEFAULT 0, starred BOOL NOT NULL DEFAULT 0, dateArrived DATE NOT NULL DEFAULT 0);
+	\(ArticleBodies.createStatement)
+
+	\(StatusesSchemaMigration.createStatement)
 
 	CREATE INDEX if not EXISTS articles_feedID_datePublished_articleID on articles (feedID, datePublished, articleID);
 
@@ -442,7 +582,7 @@ private extension ArticlesDatabase {
 
 	CREATE VIRTUAL TABLE if not EXISTS search using fts4(title, body);
 
-	CREATE TRIGGER if not EXISTS articles_after_delete_trigger_delete_search_text after delete on articles begin delete from search where rowid = OLD.searchRowID; end;
+	CREATE TRIGGER if not EXISTS articles_after_delete_trigger_delete_unshared_search_text after delete on articles begin delete from search where rowid = OLD.searchRowID and not exists (select 1 from articles where searchRowID = OLD.searchRowID); end;
 	"""
 
 	func todayCutoffDate() -> Date {
@@ -454,8 +594,8 @@ private extension ArticlesDatabase {
 
 	func cancelOperations() {
 		Self.logger.debug("ArticlesDatabase: \(#function, privacy: .public) \(self.accountID, privacy: .public)")
-		Task { @MainActor in
-			operationQueue.cancelAll()
+		Task {
+			await operationExecutor.cancelAll()
 		}
 	}
 }
@@ -470,21 +610,6 @@ typealias ArticleIDsCompletionBlock = @Sendable (Set<String>) -> Void
 
 private extension ArticlesDatabase {
 
-	func _fetchAllUnreadCounts(_ completion: @escaping UnreadCountDictionaryCompletionBlock) {
-		Self.logger.debug("ArticlesDatabase: \(#function, privacy: .public) \(self.accountID, privacy: .public)")
-		Task { @MainActor in
-			let operation = FetchAllUnreadCountsOperation(databaseQueue: queue)
-			if let operationName = operation.name {
-				operationQueue.cancel(named: operationName)
-			}
-			operation.completionBlock = { operation in
-				let fetchOperation = operation as! FetchAllUnreadCountsOperation
-				completion(fetchOperation.unreadCountDictionary ?? UnreadCountDictionary())
-			}
-			operationQueue.add(operation)
-		}
-	}
-
 	func _fetchUnreadCounts(feedIDs: Set<String>, _ completion: @escaping UnreadCountDictionaryCompletionBlock) {
 		Self.logger.debug("ArticlesDatabase: \(#function, privacy: .public) \(self.accountID, privacy: .public)")
 		articlesTable.fetchUnreadCounts(feedIDs, completion)
@@ -515,14 +640,14 @@ private extension ArticlesDatabase {
 		articlesTable.createStatusesIfNeeded(articleIDs, completion)
 	}
 
-	func _fetchArticlesAsync(feedID: String, _ completion: @escaping ArticleSetResultBlock) {
+	func _fetchArticlesAsync(feedID: String, cancellationToken: DatabaseCancellationToken?, _ completion: @escaping ArticleSetResultBlock) {
 		Self.logger.debug("ArticlesDatabase: \(#function, privacy: .public) \(self.accountID, privacy: .public)")
-		articlesTable.fetchArticlesAsync(feedID, completion)
+		articlesTable.fetchArticlesAsync(feedID, cancellationToken, completion)
 	}
 
-	func _fetchArticlesAsync(feedIDs: Set<String>, _ completion: @escaping ArticleSetResultBlock) {
+	func _fetchArticlesAsync(feedIDs: Set<String>, cancellationToken: DatabaseCancellationToken?, _ completion: @escaping ArticleSetResultBlock) {
 		Self.logger.debug("ArticlesDatabase: \(#function, privacy: .public) \(self.accountID, privacy: .public)")
-		articlesTable.fetchArticlesAsync(feedIDs, completion)
+		articlesTable.fetchArticlesAsync(feedIDs, cancellationToken, completion)
 	}
 
 	func _fetchArticlesAsync(articleIDs: Set<String>, _ completion: @escaping  ArticleSetResultBlock) {
@@ -530,29 +655,29 @@ private extension ArticlesDatabase {
 		articlesTable.fetchArticlesAsync(articleIDs: articleIDs, completion)
 	}
 
-	func _fetchUnreadArticlesAsync(feedIDs: Set<String>, limit: Int? = nil, _ completion: @escaping ArticleSetResultBlock) {
+	func _fetchUnreadArticlesAsync(feedIDs: Set<String>, limit: Int? = nil, cancellationToken: DatabaseCancellationToken?, _ completion: @escaping ArticleSetResultBlock) {
 		Self.logger.debug("ArticlesDatabase: \(#function, privacy: .public) \(self.accountID, privacy: .public)")
-		articlesTable.fetchUnreadArticlesAsync(feedIDs, limit, completion)
+		articlesTable.fetchUnreadArticlesAsync(feedIDs, limit, cancellationToken, completion)
 	}
 
-	func _fetchTodayArticlesAsync(feedIDs: Set<String>, limit: Int? = nil, _ completion: @escaping ArticleSetResultBlock) {
+	func _fetchTodayArticlesAsync(feedIDs: Set<String>, limit: Int? = nil, cancellationToken: DatabaseCancellationToken?, _ completion: @escaping ArticleSetResultBlock) {
 		Self.logger.debug("ArticlesDatabase: \(#function, privacy: .public) \(self.accountID, privacy: .public)")
-		articlesTable.fetchArticlesSinceAsync(feedIDs, todayCutoffDate(), limit, completion)
+		articlesTable.fetchArticlesSinceAsync(feedIDs, todayCutoffDate(), limit, cancellationToken, completion)
 	}
 
-	func _fetchedStarredArticlesAsync(feedIDs: Set<String>, limit: Int? = nil, _ completion: @escaping ArticleSetResultBlock) {
+	func _fetchedStarredArticlesAsync(feedIDs: Set<String>, limit: Int? = nil, cancellationToken: DatabaseCancellationToken?, _ completion: @escaping ArticleSetResultBlock) {
 		Self.logger.debug("ArticlesDatabase: \(#function, privacy: .public) \(self.accountID, privacy: .public)")
-		articlesTable.fetchStarredArticlesAsync(feedIDs, limit, completion)
+		articlesTable.fetchStarredArticlesAsync(feedIDs, limit, cancellationToken, completion)
 	}
 
-	func _fetchArticlesMatchingAsync(searchString: String, feedIDs: Set<String>, _ completion: @escaping ArticleSetResultBlock) {
+	func _fetchArticlesMatchingAsync(searchString: String, feedIDs: Set<String>, cancellationToken: DatabaseCancellationToken?, _ completion: @escaping ArticleSetResultBlock) {
 		Self.logger.debug("ArticlesDatabase: \(#function, privacy: .public) \(self.accountID, privacy: .public)")
-		articlesTable.fetchArticlesMatchingAsync(searchString, feedIDs, completion)
+		articlesTable.fetchArticlesMatchingAsync(searchString, feedIDs, cancellationToken, completion)
 	}
 
-	func _fetchArticlesMatchingWithArticleIDsAsync(searchString: String, articleIDs: Set<String>, _ completion: @escaping ArticleSetResultBlock) {
+	func _fetchArticlesMatchingWithArticleIDsAsync(searchString: String, articleIDs: Set<String>, cancellationToken: DatabaseCancellationToken?, _ completion: @escaping ArticleSetResultBlock) {
 		Self.logger.debug("ArticlesDatabase: \(#function, privacy: .public) \(self.accountID, privacy: .public)")
-		articlesTable.fetchArticlesMatchingWithArticleIDsAsync(searchString, articleIDs, completion)
+		articlesTable.fetchArticlesMatchingWithArticleIDsAsync(searchString, articleIDs, cancellationToken, completion)
 	}
 
 	func _update(parsedItems: Set<ParsedItem>, feedID: String, deleteOlder: Bool, completion: @escaping UpdateArticlesCompletionBlock) {
@@ -22,7 +22,13 @@ final class ArticlesTable: DatabaseTable, Sendable {
 	private let statusesTable: StatusesTable
 	private let searchTable: SearchTable
 	private let retentionStyle: ArticlesDatabase.RetentionStyle
+	private let compressesBodies: Bool
 	private let articlesCache = OSAllocatedUnfairLock(initialState: [String: Article]())
+	/// Shared bodies by bodyHash, so that articles with the same body share one string.
+	/// Emptied when it reaches `maximumSharedBodiesCount` — see `sharedContentHTML`.
+	private let sharedBodiesCache = OSAllocatedUnfairLock(initialState: [String: String]())
+	private static let maximumSharedBodiesCount = 200
+	private let insertArticleSQL: String
 
 	private static let logger = Logger(subsystem: Logger.nnwSubsystem, category: "ArticlesTable")
 	private static let signposter = OSSignposter(subsystem: Logger.nnwSubsystem, category: .pointsOfInterest)
@@ -33,12 +39,16 @@ final class ArticlesTable: DatabaseTable, Sendable {
 	private typealias ArticlesFetchMethod = @Sendable (FMDatabase) -> Set<Article>
 	private typealias ArticlesCountFetchMethod = @Sendable (FMDatabase) -> Int
 
-	init(name: String, accountID: String, queue: DatabaseQueue, retentionStyle: ArticlesDatabase.RetentionStyle) {
+	init(name: String, accountID: String, queue: DatabaseQueue, retentionStyle: ArticlesDatabase.RetentionStyle, compressesBodies: Bool) {
 		self.name = name
 		self.accountID = accountID
 		self.queue = queue
 		self.statusesTable = StatusesTable(queue: queue)
 		self.retentionStyle = retentionStyle
+		self.compressesBodies = compressesBodies
+
+		let columns = Article.databaseColumns
+		self.insertArticleSQL = "insert or replace into \(name) (\(columns.joined(separator: ", "))) values \(NSString.rs_SQLValueList(withPlaceholders: UInt(columns.count))!);"
 
 		self.searchTable = SearchTable(queue: queue)
 		self.searchTable.articlesTable = self
@@ -52,16 +62,16 @@ final class ArticlesTable: DatabaseTable, Sendable {
 		fetchArticles { self.fetchArticlesForFeedID(feedID, $0) }
 	}
 
-	func fetchArticlesAsync(_ feedID: String, _ completion: @escaping ArticleSetResultBlock) {
-		fetchArticlesAsync({ self.fetchArticlesForFeedID(feedID, $0) }, completion)
+	func fetchArticlesAsync(_ feedID: String, _ cancellationToken: DatabaseCancellationToken?, _ completion: @escaping ArticleSetResultBlock) {
+		fetchArticlesAsync({ self.fetchArticlesForFeedID(feedID, $0) }, cancellationToken, completion)
 	}
 
 	func fetchArticles(_ feedIDs: Set<String>) -> Set<Article> {
 		fetchArticles { self.fetchArticles(feedIDs, $0) }
 	}
 
-	func fetchArticlesAsync(_ feedIDs: Set<String>, _ completion: @escaping ArticleSetResultBlock) {
-		fetchArticlesAsync({ self.fetchArticles(feedIDs, $0) }, completion)
+	func fetchArticlesAsync(_ feedIDs: Set<String>, _ cancellationToken: DatabaseCancellationToken?, _ completion: @escaping ArticleSetResultBlock) {
+		fetchArticlesAsync({ self.fetchArticles(feedIDs, $0) }, cancellationToken, completion)
 	}
 
 	// MARK: - Fetching Articles by articleID
@@ -80,8 +90,8 @@ final class ArticlesTable: DatabaseTable, Sendable {
 		fetchArticles { self.fetchUnreadArticles(feedIDs, limit, $0) }
 	}
 
-	func fetchUnreadArticlesAsync(_ feedIDs: Set<String>, _ limit: Int?, _ completion: @escaping ArticleSetResultBlock) {
-		fetchArticlesAsync({ self.fetchUnreadArticles(feedIDs, limit, $0) }, completion)
+	func fetchUnreadArticlesAsync(_ feedIDs: Set<String>, _ limit: Int?, _ cancellationToken: DatabaseCancellationToken?, _ completion: @escaping ArticleSetResultBlock) {
+		fetchArticlesAsync({ self.fetchUnreadArticles(feedIDs, limit, $0) }, cancellationToken, completion)
 	}
 
 	// MARK: - Fetching Today Articles
@@ -90,8 +100,8 @@ final class ArticlesTable: DatabaseTable, Sendable {
 		fetchArticles { self.fetchArticlesSince(feedIDs, cutoffDate, limit, $0) }
 	}
 
-	func fetchArticlesSinceAsync(_ feedIDs: Set<String>, _ cutoffDate: Date, _ limit: Int?, _ completion: @escaping ArticleSetResultBlock) {
-		fetchArticlesAsync({ self.fetchArticlesSince(feedIDs, cutoffDate, limit, $0) }, completion)
+	func fetchArticlesSinceAsync(_ feedIDs: Set<String>, _ cutoffDate: Date, _ limit: Int?, _ cancellationToken: DatabaseCancellationToken?, _ completion: @escaping ArticleSetResultBlock) {
+		fetchArticlesAsync({ self.fetchArticlesSince(feedIDs, cutoffDate, limit, $0) }, cancellationToken, completion)
 	}
 
 	// MARK: - Fetching Starred Articles
@@ -100,14 +110,34 @@ final class ArticlesTable: DatabaseTable, Sendable {
 		fetchArticles { self.fetchStarredArticles(feedIDs, limit, $0) }
 	}
 
-	func fetchStarredArticlesAsync(_ feedIDs: Set<String>, _ limit: Int?, _ completion: @escaping ArticleSetResultBlock) {
-		fetchArticlesAsync({ self.fetchStarredArticles(feedIDs, limit, $0) }, completion)
+	func fetchStarredArticlesAsync(_ feedIDs: Set<String>, _ limit: Int?, _ cancellationToken: DatabaseCancellationToken?, _ completion: @escaping ArticleSetResultBlock) {
+		fetchArticlesAsync({ self.fetchStarredArticles(feedIDs, limit, $0) }, cancellationToken, completion)
 	}
 
 	func fetchStarredArticlesCount(_ feedIDs: Set<String>) -> Int {
 		fetchArticlesCount { self.fetchStarredArticlesCount(feedIDs, $0) }
 	}
 
+	// MARK: - Fetching Pages
+
+	func fetchArticlesPage(_ feedIDs: Set<String>, _ filter: ArticlesPageFilter, _ since: Date?, _ sortDirection: ComparisonResult, _ cursor: ArticlesPageCursor?, _ limit: Int) -> ArticlesPage {
+		nonisolated(unsafe) var page = ArticlesPage(articles: [], nextCursor: nil)
+
+		queue.runInDatabaseSync { database in
+			page = self.fetchArticlesPage(feedIDs, filter, since, sortDirection, cursor, limit, database)
+		}
+		return page
+	}
+
+	func fetchArticlesPageAsync(_ feedIDs: Set<String>, _ filter: ArticlesPageFilter, _ since: Date?, _ sortDirection: ComparisonResult, _ cursor: ArticlesPageCursor?, _ limit: Int, _ completion: @escaping @Sendable (ArticlesPage) -> Void) {
+		queue.runInDatabase { database in
+			let page = self.fetchArticlesPage(feedIDs, filter, since, sortDirection, cursor, limit, database)
+			DispatchQueue.main.async {
+				completion(page)
+			}
+		}
+	}
+
 	// MARK: - Fetching Counts Async
 
 	func fetchArticleCountsAsync(_ feedIDs: Set<String>, _ completion: @escaping @Sendable (ArticleCounts) -> Void) {
@@ -154,28 +184,29 @@ final class ArticlesTable: DatabaseTable, Sendable {
 		return articles
 	}
 
-	func fetchArticlesMatchingAsync(_ searchString: String, _ feedIDs: Set<String>, _ completion: @escaping ArticleSetResultBlock) {
-		fetchArticlesAsync({ self.fetchArticlesMatching(searchString, feedIDs, $0) }, completion)
+	func fetchArticlesMatchingAsync(_ searchString: String, _ feedIDs: Set<String>, _ cancellationToken: DatabaseCancellationToken?, _ completion: @escaping ArticleSetResultBlock) {
+		fetchArticlesAsync({ self.fetchArticlesMatching(searchString, feedIDs, $0) }, cancellationToken, completion)
 	}
 
-	func fetchArticlesMatchingWithArticleIDsAsync(_ searchString: String, _ articleIDs: Set<String>, _ completion: @escaping ArticleSetResultBlock) {
-		fetchArticlesAsync({ self.fetchArticlesMatchingWithArticleIDs(searchString, articleIDs, $0) }, completion)
+	func fetchArticlesMatchingWithArticleIDsAsync(_ searchString: String, _ articleIDs: Set<String>, _ cancellationToken: DatabaseCancellationToken?, _ completion: @escaping ArticleSetResultBlock) {
+		fetchArticlesAsync({ self.fetchArticlesMatchingWithArticleIDs(searchString, articleIDs, $0) }, cancellationToken, completion)
 	}
 
 	// MARK: - Fetching Articles for Indexer
 
-	func fetchArticleSearchInfos(_ articleIDs: Set<String>, in database: FMDatabase) -> Set<ArticleSearchInfo>? {
+	/// `bodyTexts` holds plain text already made at ingest, by articleID.
+	func fetchArticleSearchInfos(_ articleIDs: Set<String>, bodyTexts: [String: String] = [:], in database: FMDatabase) -> Set<ArticleSearchInfo>? {
 		let parameters = articleIDs.map { $0 as AnyObject }
 		let placeholders = NSString.rs_SQLValueList(withPlaceholders: UInt(articleIDs.count))!
-		let query = "select articleID, title, contentHTML, contentText, summary, searchRowID, authors from articles where articleID in \(placeholders);"
+		let query = "select articleID, title, contentHTML, sharedContentHTML, contentText, summary, searchRowID, authors from articles left join articleBodies using (bodyHash) where articleID in \(placeholders);"
 
 		if let resultSet = database.executeQuery(query, withArgumentsIn: parameters) {
 			return resultSet.mapToSet { (row) -> ArticleSearchInfo? in
 				let articleID = row.swiftString(forColumn: DatabaseKey.articleID)!
 				let title = row.swiftString(forColumn: DatabaseKey.title)
-				let contentHTML = row.swiftString(forColumn: DatabaseKey.contentHTML)
-				let contentText = row.swiftString(forColumn: DatabaseKey.contentText)
-				let summary = row.swiftString(forColumn: DatabaseKey.summary)
+				let contentHTML = ArticleBodyCompression.body(row, DatabaseKey.contentHTML) ?? ArticleBodyCompression.body(row, DatabaseKey.sharedContentHTML)
+				let contentText = ArticleBodyCompression.body(row, DatabaseKey.contentText)
+				let summary = ArticleBodyCompression.body(row, DatabaseKey.summary)
 				let authorsNames = Self.authorsNames(from: row)
 
 				let searchRowIDObject = row.object(forColumnName: DatabaseKey.searchRowID)
@@ -184,7 +215,7 @@ final class ArticlesTable: DatabaseTable, Sendable {
 					searchRowID = Int(row.longLongInt(forColumn: DatabaseKey.searchRowID))
 				}
 
-				return ArticleSearchInfo(articleID: articleID, title: title, contentHTML: contentHTML, contentText: contentText, summary: summary, authorsNames: authorsNames, searchRowID: searchRowID)
+				return ArticleSearchInfo(articleID: articleID, title: title, contentHTML: contentHTML, contentText: contentText, summary: summary, authorsNames: authorsNames, searchRowID: searchRowID, bodyText: bodyTexts[articleID])
 			}
 		}
 		return nil
@@ -209,7 +240,7 @@ final class ArticlesTable: DatabaseTable, Sendable {
 	func update(_ parsedItems: Set<ParsedItem>, _ feedID: String, _ deleteOlder: Bool, _ completion: @escaping UpdateArticlesCompletionBlock) {
 		precondition(retentionStyle == .feedBased)
 		if parsedItems.isEmpty {
-			callUpdateArticlesCompletionBlock(nil, nil, nil, completion)
+			callUpdateArticlesCompletionBlock(nil, nil, nil, nil, completion)
 			return
 		}
 
@@ -223,13 +254,22 @@ final class ArticlesTable: DatabaseTable, Sendable {
 		// 8. Delete Articles in database no longer present in the feed.
 		// 9. Update search index.
 
-		self.queue.runInTransaction { database in
+		let enqueueTime = DispatchTime.now().uptimeNanoseconds
 
-			let articleIDs = parsedItems.articleIDs()
+		// Saving a refresh can wait behind fetches the user is waiting for.
+		self.queue.runInTransaction(priority: .utility) { database in
+
+			let startTime = DispatchTime.now().uptimeNanoseconds
+			let startCPUTime = clock_gettime_nsec_np(CLOCK_THREAD_CPUTIME_ID)
+			let diffSignpostState = Self.signposter.beginInterval("Diff articles")
+
+			// Calculate each articleID just once — for a large feed, hashing dominates this step.
+			let parsedItemsByArticleID = parsedItems.dictionaryByArticleID()
+			let articleIDs = Set(parsedItemsByArticleID.keys)
 
 			// Split by age: articles older than ~6 months default to read.
 			let cutoffDate = Date(timeIntervalSinceNow: -ArticleStatus.staleIntervalInSeconds)
-			let oldArticleIDs = Set(parsedItems.filter { ($0.datePublished ?? .distantFuture) < cutoffDate }.map { $0.articleID })
+			let oldArticleIDs = Set(parsedItemsByArticleID.compactMap { ($0.value.datePublished ?? .distantFuture) < cutoffDate ? $0.key : nil })
 			let recentArticleIDs = articleIDs.subtracting(oldArticleIDs)
 
 			let (recentStatusesDictionary, _) = self.statusesTable.ensureStatusesForArticleIDs(recentArticleIDs, false, database) // 1a
@@ -237,17 +277,29 @@ final class ArticlesTable: DatabaseTable, Sendable {
 			let statusesDictionary = recentStatusesDictionary.merging(oldStatusesDictionary) { current, _ in current }
 			assert(statusesDictionary.count == articleIDs.count)
 
-			let incomingArticles = Article.articlesWithParsedItems(parsedItems, feedID, self.accountID, statusesDictionary) // 2
+			let incomingArticles = Article.articlesWithParsedItems(parsedItemsByArticleID, feedID, self.accountID, statusesDictionary) // 2
 			if incomingArticles.isEmpty {
-				self.callUpdateArticlesCompletionBlock(nil, nil, nil, completion)
+				Self.signposter.endInterval("Diff articles", diffSignpostState)
+				self.callUpdateArticlesCompletionBlock(nil, nil, nil, nil, completion)
 				return
 			}
 
 			let fetchedArticles = self.fetchArticlesForFeedID(feedID, database) // 4
 			let fetchedArticlesDictionary = fetchedArticles.dictionary()
 
-			let newArticles = self.findAndSaveNewArticles(incomingArticles, fetchedArticlesDictionary, database) // 5
-			let updatedArticles = self.findAndSaveUpdatedArticles(incomingArticles, fetchedArticlesDictionary, database) // 6
+			Self.signposter.endInterval("Diff articles", diffSignpostState, "\(incomingArticles.count) incoming, \(fetchedArticles.count) stored")
+			let writeStartTime = DispatchTime.now().uptimeNanoseconds
+			let writeStartCPUTime = clock_gettime_nsec_np(CLOCK_THREAD_CPUTIME_ID)
+			let writeSignpostState = Self.signposter.beginInterval("Write articles")
+
+			var bodyTexts = [String: String]()
+			let newArticles = self.findAndSaveNewArticles(incomingArticles, fetchedArticlesDictionary, &bodyTexts, database) // 5
+			let updatedArticles = self.findAndSaveUpdatedArticles(incomingArticles, fetchedArticlesDictionary, &bodyTexts, database) // 6
+
+			Self.signposter.endInterval("Write articles", writeSignpostState, "\(newArticles?.count ?? 0) new, \(updatedArticles?.count ?? 0) updated")
+			let endTime = DispatchTime.now().uptimeNanoseconds
+			let endCPUTime = clock_gettime_nsec_np(CLOCK_THREAD_CPUTIME_ID)
+			let timing = ArticleUpdateTiming(queueWaitMilliseconds: Double(startTime - enqueueTime) / 1_000_000, diffMilliseconds: Double(writeStartTime - startTime) / 1_000_000, writeMilliseconds: Double(endTime - writeStartTime) / 1_000_000, diffCPUMilliseconds: Double(writeStartCPUTime - startCPUTime) / 1_000_000, writeCPUMilliseconds: Double(endCPUTime - writeStartCPUTime) / 1_000_000)
 
 			// Articles to delete are 1) not starred and 2) older than 30 days and 3) no longer in feed.
 			let articlesToDelete: Set<Article>
@@ -260,7 +312,7 @@ final class ArticlesTable: DatabaseTable, Sendable {
 				articlesToDelete = Set<Article>()
 			}
 
-			self.callUpdateArticlesCompletionBlock(newArticles, updatedArticles, articlesToDelete, completion) // 7
+			self.callUpdateArticlesCompletionBlock(newArticles, updatedArticles, articlesToDelete, timing, completion) // 7
 
 			self.addArticlesToCache(newArticles)
 			self.addArticlesToCache(updatedArticles)
@@ -274,10 +326,10 @@ final class ArticlesTable: DatabaseTable, Sendable {
 
 			// 9. Update search index.
 			if let newArticles = newArticles {
-				self.searchTable.indexNewArticles(newArticles, database)
+				self.searchTable.indexNewArticles(newArticles, bodyTexts, database)
 			}
 			if let updatedArticles = updatedArticles {
-				self.searchTable.indexUpdatedArticles(updatedArticles, database)
+				self.searchTable.indexUpdatedArticles(updatedArticles, bodyTexts, database)
 			}
 		}
 	}
@@ -285,7 +337,7 @@ final class ArticlesTable: DatabaseTable, Sendable {
 	func update(_ feedIDsAndItems: [String: Set<ParsedItem>], _ read: Bool, _ completion: @escaping UpdateArticlesCompletionBlock) {
 		precondition(retentionStyle == .syncSystem)
 		if feedIDsAndItems.isEmpty {
-			callUpdateArticlesCompletionBlock(nil, nil, nil, completion)
+			callUpdateArticlesCompletionBlock(nil, nil, nil, nil, completion)
 			return
 		}
 
@@ -301,22 +353,25 @@ final class ArticlesTable: DatabaseTable, Sendable {
 		self.queue.runInTransaction { database in
 
 			var articleIDs = Set<String>()
-			for (_, parsedItems) in feedIDsAndItems {
-				articleIDs.formUnion(parsedItems.articleIDs())
+			var feedIDsAndItemsByArticleID = [String: [String: ParsedItem]]()
+			for (feedID, parsedItems) in feedIDsAndItems {
+				let parsedItemsByArticleID = parsedItems.dictionaryByArticleID()
+				articleIDs.formUnion(parsedItemsByArticleID.keys)
+				feedIDsAndItemsByArticleID[feedID] = parsedItemsByArticleID
 			}
 
 			let (statusesDictionary, _) = self.statusesTable.ensureStatusesForArticleIDs(articleIDs, read, database) // 1
 			assert(statusesDictionary.count == articleIDs.count)
 
-			let allIncomingArticles = Article.articlesWithFeedIDsAndItems(feedIDsAndItems, self.accountID, statusesDictionary) // 2
+			let allIncomingArticles = Article.articlesWithFeedIDsAndItems(feedIDsAndItemsByArticleID, self.accountID, statusesDictionary) // 2
 			if allIncomingArticles.isEmpty {
-				self.callUpdateArticlesCompletionBlock(nil, nil, nil, completion)
+				self.callUpdateArticlesCompletionBlock(nil, nil, nil, nil, completion)
 				return
 			}
 
 			let incomingArticles = self.filterIncomingArticles(allIncomingArticles) // 3
 			if incomingArticles.isEmpty {
-				self.callUpdateArticlesCompletionBlock(nil, nil, nil, completion)
+				self.callUpdateArticlesCompletionBlock(nil, nil, nil, nil, completion)
 				return
 			}
 
@@ -324,20 +379,21 @@ final class ArticlesTable: DatabaseTable, Sendable {
 			let fetchedArticles = self.fetchArticles(articleIDs: incomingArticleIDs, database) // 4
 			let fetchedArticlesDictionary = fetchedArticles.dictionary()
 
-			let newArticles = self.findAndSaveNewArticles(incomingArticles, fetchedArticlesDictionary, database) //
-			let updatedArticles = self.findAndSaveUpdatedArticles(incomingArticles, fetchedArticlesDictionary, database) // 6
+			var bodyTexts = [String: String]()
+			let newArticles = self.findAndSaveNewArticles(incomingArticles, fetchedArticlesDictionary, &bodyTexts, database) // 5
+			let updatedArticles = self.findAndSaveUpdatedArticles(incomingArticles, fetchedArticlesDictionary, &bodyTexts, database) // 6
 
-			self.callUpdateArticlesCompletionBlock(newArticles, updatedArticles, nil, completion) // 7
+			self.callUpdateArticlesCompletionBlock(newArticles, updatedArticles, nil, nil, completion) // 7
 
 			self.addArticlesToCache(newArticles)
 			self.addArticlesToCache(updatedArticles)
 
 			// 8. Update search index.
 			if let newArticles = newArticles {
-				self.searchTable.indexNewArticles(newArticles, database)
+				self.searchTable.indexNewArticles(newArticles, bodyTexts, database)
 			}
 			if let updatedArticles = updatedArticles {
-				self.searchTable.indexUpdatedArticles(updatedArticles, database)
+				self.searchTable.indexUpdatedArticles(updatedArticles, bodyTexts, database)
 			}
 		}
 	}
@@ -528,7 +584,7 @@ final class ArticlesTable: DatabaseTable, Sendable {
 	// MARK: - Indexing
 
 	func indexUnindexedArticles() {
-		queue.runInDatabase { database in
+		queue.runInDatabase(priority: .maintenance) { database in
 			let sql = "select articleID from articles where searchRowID is null limit 500;"
 			guard let resultSet = database.executeQuery(sql, withArgumentsIn: nil) else {
 				return
@@ -554,66 +610,26 @@ final class ArticlesTable: DatabaseTable, Sendable {
 	func emptyCaches() {
 		queue.runInDatabase { _ in
 			self.articlesCache.withLock { $0 = [String: Article]() }
+			self.sharedBodiesCache.withLock { $0 = [String: String]() }
 		}
 	}
 
 	// MARK: - Cleanup
 
-	/// Delete articles that we won’t show in the UI any longer
-	/// — their arrival date is before our 90-day recency window;
-	/// they are read; they are not starred.
-	///
-	/// Because deleting articles might block the database for too long,
-	/// we do this in a careful way: delete articles older than a year,
-	/// check to see how much time has passed, then decide whether or not to continue.
-	/// Repeat for successively more-recent dates.
-	///
-	/// Returns `true` if it deleted old articles all the way up to the 90 day cutoff date.
-	func deleteOldArticles() {
-		precondition(retentionStyle == .syncSystem)
-
-		queue.runInTransaction { database in
-			func deleteOldArticles(cutoffDate: Date) {
-				let sql = "delete from articles where articleID in (select articleID from articles natural join statuses where dateArrived<? and read=1 and starred=0);"
-				let parameters = [cutoffDate] as [Any]
-				database.executeUpdate(sql, withArgumentsIn: parameters)
-			}
-
-			let startTime = Date()
-			func tooMuchTimeHasPassed() -> Bool {
-				let timeElapsed = Date().timeIntervalSince(startTime)
-				return timeElapsed > 2.0
-			}
-
-			let dayIntervals = [365, 300, 225, 150]
-			for dayInterval in dayIntervals {
-				deleteOldArticles(cutoffDate: startTime.bySubtracting(days: dayInterval))
-				if tooMuchTimeHasPassed() {
-					return
-				}
-			}
-			deleteOldArticles(cutoffDate: self.articleCutoffDate)
+	/// The jobs, in order, that keep the database from growing forever.
+	/// Run by a `DatabaseMaintenanceScheduler` at startup, which deletes in
+	/// small time-budgeted transactions so that other database work can interleave.
+	func cleanupJobs(subscribedToFeedIDs feedIDs: Set<String>) -> [DatabaseMaintenanceJob] {
+		var jobs = [DatabaseMaintenanceJob]()
+		if retentionStyle == .syncSystem {
+			jobs.append(deleteOldArticlesJob())
 		}
-	}
-
-	/// Delete old statuses.
-	func deleteOldStatuses() {
-		queue.runInTransaction { database in
-			let sql: String
-			let cutoffDate: Date
-
-			switch self.retentionStyle {
-			case .syncSystem:
-				sql = "delete from statuses where dateArrived<? and read=1 and starred=0 and articleID not in (select articleID from articles);"
-				cutoffDate = Date().bySubtracting(days: 180)
-			case .feedBased:
-				sql = "delete from statuses where dateArrived<? and starred=0 and articleID not in (select articleID from articles);"
-				cutoffDate = Date().bySubtracting(days: 30)
-			}
-
-			let parameters = [cutoffDate] as [Any]
-			database.executeUpdate(sql, withArgumentsIn: parameters)
+		if !feedIDs.isEmpty {
+			jobs += deleteArticlesNotInSubscribedToFeedIDsJobs(feedIDs)
 		}
+		jobs.append(deleteOldStatusesJob())
+		jobs.append(ArticleBodies.deleteUnreferencedBodiesJob())
+		return jobs
 	}
 
 	// MARK: - Repairing
@@ -621,35 +637,57 @@ final class ArticlesTable: DatabaseTable, Sendable {
 	func repairStatuses(_ database: FMDatabase) {
 		statusesTable.repairStatuses(database)
 	}
-
-	/// Delete articles from feeds that are no longer in the current set of subscribed-to feeds.
-	/// This deletes from the articles and articleStatuses tables,
-	/// and, via a trigger, it also deletes from the search index.
-	func deleteArticlesNotInSubscribedToFeedIDs(_ feedIDs: Set<String>) {
-		if feedIDs.isEmpty {
-			return
-		}
-		queue.runInDatabase { database in
-			let placeholders = NSString.rs_SQLValueList(withPlaceholders: UInt(feedIDs.count))!
-			let sql = "select articleID from articles where feedID not in \(placeholders);"
-			let parameters = Array(feedIDs) as [Any]
-			guard let resultSet = database.executeQuery(sql, withArgumentsIn: parameters) else {
-				return
-			}
-			let articleIDs = resultSet.mapToSet { $0.swiftString(forColumn: DatabaseKey.articleID) }
-			if articleIDs.isEmpty {
-				return
-			}
-			self.removeArticles(articleIDs, database)
-			self.statusesTable.removeStatuses(articleIDs, database)
-		}
-	}
 }
 
 // MARK: - Private
 
 nonisolated private extension ArticlesTable {
 
+	// MARK: - Cleanup Jobs
+
+	/// Delete articles that we won’t show in the UI any longer
+	/// — their arrival date is before our 90-day recency window;
+	/// they are read; they are not starred.
+	func deleteOldArticlesJob() -> DatabaseMaintenanceJob {
+		precondition(retentionStyle == .syncSystem)
+		let whereClause = "exists (select 1 from statuses s where s.articleID = articles.articleID and s.dateArrived<? and s.read=1 and s.starred=0)"
+		return DatabaseMaintenanceJob(name: "deleteOldArticles", tableName: name, whereClause: whereClause, parameters: [articleCutoffDate])
+	}
+
+	/// Delete articles from feeds that are no longer in the current set of subscribed-to feeds.
+	/// (`statuses` is WITHOUT ROWID — see `StatusesSchemaMigration` — so its
+	/// jobs go in articleID order.) Statuses go first, while their articles still exist to say which feed they belong to.
+	/// Deleting articles also deletes from the search index, via a trigger.
+	func deleteArticlesNotInSubscribedToFeedIDsJobs(_ feedIDs: Set<String>) -> [DatabaseMaintenanceJob] {
+		let placeholders = NSString.rs_SQLValueList(withPlaceholders: UInt(feedIDs.count))!
+		let parameters = Array(feedIDs) as [any Sendable]
+
+		let statusesWhereClause = "exists (select 1 from articles a where a.articleID = statuses.articleID and a.feedID not in \(placeholders))"
+		let deleteStatusesJob = DatabaseMaintenanceJob(name: "deleteStatusesNotInSubscribedToFeedIDs", tableName: statusesTable.name, whereClause: statusesWhereClause, parameters: parameters, keyColumn: DatabaseKey.articleID)
+
+		let articlesWhereClause = "feedID not in \(placeholders)"
+		let deleteArticlesJob = DatabaseMaintenanceJob(name: "deleteArticlesNotInSubscribedToFeedIDs", tableName: name, whereClause: articlesWhereClause, parameters: parameters)
+
+		return [deleteStatusesJob, deleteArticlesJob]
+	}
+
+	/// Delete old statuses that no longer have an article.
+	func deleteOldStatusesJob() -> DatabaseMaintenanceJob {
+		let whereClause: String
+		let cutoffDate: Date
+
+		switch retentionStyle {
+		case .syncSystem:
+			whereClause = "dateArrived<? and read=1 and starred=0 and not exists (select 1 from articles a where a.articleID = statuses.articleID)"
+			cutoffDate = Date().bySubtracting(days: 180)
+		case .feedBased:
+			whereClause = "dateArrived<? and starred=0 and not exists (select 1 from articles a where a.articleID = statuses.articleID)"
+			cutoffDate = Date().bySubtracting(days: 30)
+		}
+
+		return DatabaseMaintenanceJob(name: "deleteOldStatuses", tableName: statusesTable.name, whereClause: whereClause, parameters: [cutoffDate], keyColumn: DatabaseKey.articleID)
+	}
+
 	// MARK: - Fetching
 
 	private func fetchArticles(_ fetchMethod: @escaping ArticlesFetchMethod) -> Set<Article> {
@@ -679,41 +717,98 @@ nonisolated private extension ArticlesTable {
 		}
 	}
 
+	/// Without a token, the fetch always runs to completion. With one, calls
+	/// `completion` with an empty set when canceled — including when the query
+	/// was interrupted partway and its results are incomplete.
+	///
+	/// Fetches with a token are the timeline’s — the user is waiting on them —
+	/// so they run at `.interactive`, ahead of waiting writes. One that
+	/// overtakes a status write still shares its `ArticleStatus` objects, and
+	/// the write posts its changes when it’s done, so the timeline catches up.
+	private func fetchArticlesAsync(_ fetchMethod: @escaping ArticlesFetchMethod, _ cancellationToken: DatabaseCancellationToken?, _ completion: @escaping ArticleSetResultBlock) {
+		guard let cancellationToken else {
+			fetchArticlesAsync(fetchMethod, completion)
+			return
+		}
+		queue.runInDatabase(priority: .interactive, cancellationToken: cancellationToken, { database in
+			let fetchedArticles = fetchMethod(database)
+			let articles = cancellationToken.isCanceled ? Set<Article>() : fetchedArticles
+			DispatchQueue.main.async {
+				completion(articles)
+			}
+		}, ifCanceled: {
+			Self.logger.debug("ArticlesTable: fetch canceled before running")
+			DispatchQueue.main.async {
+				completion(Set<Article>())
+			}
+		})
+	}
+
 	func articlesWithResultSet(_ resultSet: FMResultSet, _ database: FMDatabase) -> Set<Article> {
 		var articles = Set<Article>()
 
 		while resultSet.next() {
-
-			guard let articleID = resultSet.swiftString(forColumn: DatabaseKey.articleID) else {
-				assertionFailure("Expected articleID.")
-				continue
+			if let article = articleWithRow(resultSet) {
+				articles.insert(article)
 			}
+		}
 
-			if let cachedArticle = articlesCache.withLock({ $0[articleID] }) {
-				articles.insert(cachedArticle)
-				continue
-			}
+		resultSet.close()
+		return articles
+	}
 
-			// The resultSet is a result of a JOIN query with the statuses table,
-			// so we can get the statuses at the same time and avoid additional database lookups.
-			guard let status = statusesTable.statusWithRow(resultSet, articleID: articleID) else {
-				assertionFailure("Expected status.")
-				continue
-			}
+	func articleWithRow(_ resultSet: FMResultSet) -> Article? {
+		guard let articleID = resultSet.swiftString(forColumn: DatabaseKey.articleID) else {
+			assertionFailure("Expected articleID.")
+			return nil
+		}
 
-			guard let article = Article(accountID: accountID, row: resultSet, status: status) else {
-				continue
-			}
-			articlesCache.withLock { $0[articleID] = article }
-			articles.insert(article)
+		if let cachedArticle = articlesCache.withLock({ $0[articleID] }) {
+			return cachedArticle
 		}
 
-		resultSet.close()
-		return articles
+		// The resultSet is a result of a JOIN query with the statuses table,
+		// so we can get the statuses at the same time and avoid additional database lookups.
+		guard let status = statusesTable.statusWithRow(resultSet, articleID: articleID) else {
+			assertionFailure("Expected status.")
+			return nil
+		}
+
+		guard let article = Article(accountID: accountID, row: resultSet, status: status, sharedContentHTML: sharedContentHTML(resultSet)) else {
+			return nil
+		}
+		articlesCache.withLock { $0[articleID] = article }
+		return article
+	}
+
+	/// The row’s body from `articleBodies`, if it has one. Each shared body
+	/// is decompressed once and then comes from `sharedBodiesCache`.
+	///
+	/// The cache only has to last through a fetch or two — the articles
+	/// sharing a body are usually fetched together — so when it’s full it’s
+	/// emptied rather than kept in LRU order. Articles already made keep
+	/// their bodies either way.
+	func sharedContentHTML(_ resultSet: FMResultSet) -> String? {
+		guard let bodyHash = resultSet.swiftString(forColumn: DatabaseKey.bodyHash) else {
+			return nil
+		}
+		if let body = sharedBodiesCache.withLock({ $0[bodyHash] }) {
+			return body
+		}
+		guard let body = ArticleBodyCompression.body(resultSet, DatabaseKey.sharedContentHTML) else {
+			return nil
+		}
+		sharedBodiesCache.withLock { sharedBodies in
+			if sharedBodies.count >= Self.maximumSharedBodiesCount {
+				sharedBodies.removeAll()
+			}
+			sharedBodies[bodyHash] = body
+		}
+		return body
 	}
 
 	func fetchArticlesWithWhereClause(_ database: FMDatabase, whereClause: String, parameters: [AnyObject]) -> Set<Article> {
-		let sql = "select * from articles natural join statuses where \(whereClause);"
+		let sql = "select * from articles natural join statuses left join articleBodies using (bodyHash) where \(whereClause);"
 		return articlesWithSQL(sql, parameters, database)
 	}
 
@@ -805,6 +900,71 @@ nonisolated private extension ArticlesTable {
 		return fetchArticlesWithWhereClause(database, whereClause: whereClause, parameters: parameters)
 	}
 
+	func fetchArticlesPage(_ feedIDs: Set<String>, _ filter: ArticlesPageFilter, _ since: Date?, _ sortDirection: ComparisonResult, _ cursor: ArticlesPageCursor?, _ limit: Int, _ database: FMDatabase) -> ArticlesPage {
+		// select *, coalesce(datePublished, dateModified, dateArrived) as logicalDate from articles natural join statuses
+		//   where feedID in (…) and read=0 and (logicalDate < ? or (logicalDate = ? and articleID > ?))
+		//   order by logicalDate desc, articleID limit 100;
+		//
+		// The logical date spans both tables, so no index can give this order. The
+		// feedID index narrows the rows, and with a limit SQLite keeps only the top
+		// rows while sorting. The win is on our side: only one page of Articles is built.
+		if feedIDs.isEmpty || limit < 1 {
+			return ArticlesPage(articles: [], nextCursor: nil)
+		}
+
+		let signpostState = Self.signposter.beginInterval("Fetch articles page")
+		let startTime = Date()
+
+		let logicalDate = "coalesce(datePublished, dateModified, dateArrived)"
+		var parameters = feedIDs.map { $0 as AnyObject }
+		let placeholders = NSString.rs_SQLValueList(withPlaceholders: UInt(feedIDs.count))!
+		var whereClause = "feedID in \(placeholders)"
+		if filter.unreadOnly {
+			whereClause.append(" and read=0")
+		}
+		if filter.starredOnly {
+			whereClause.append(" and starred=1")
+		}
+		if let since {
+			whereClause.append(" and (datePublished > ? or (datePublished is null and dateArrived > ?))")
+			parameters += [since as AnyObject, since as AnyObject]
+		}
+		if let cursor {
+			let comparison = sortDirection == .orderedDescending ? "<" : ">"
+			whereClause.append(" and (\(logicalDate) \(comparison) ? or (\(logicalDate) = ? and articleID > ?))")
+			parameters += [cursor.logicalDate as AnyObject, cursor.logicalDate as AnyObject, cursor.articleID as AnyObject]
+		}
+		let order = sortDirection == .orderedDescending ? "desc" : "asc"
+		let sql = "select *, \(logicalDate) as logicalDate from articles natural join statuses left join articleBodies using (bodyHash) where \(whereClause) order by logicalDate \(order), articleID limit \(limit);"
+
+		guard let resultSet = database.executeQuery(sql, withArgumentsIn: parameters) else {
+			Self.signposter.endInterval("Fetch articles page", signpostState, "no result set")
+			return ArticlesPage(articles: [], nextCursor: nil)
+		}
+
+		var articles = [Article]()
+		articles.reserveCapacity(limit)
+		var rowCount = 0
+		var lastRowCursor: ArticlesPageCursor?
+		while resultSet.next() {
+			rowCount += 1
+			if let article = articleWithRow(resultSet) {
+				articles.append(article)
+			}
+			if let articleID = resultSet.swiftString(forColumn: DatabaseKey.articleID) {
+				lastRowCursor = ArticlesPageCursor(logicalDate: resultSet.double(forColumn: "logicalDate"), articleID: articleID)
+			}
+		}
+		resultSet.close()
+
+		let elapsed = Date().timeIntervalSince(startTime)
+		Self.signposter.endInterval("Fetch articles page", signpostState, "\(articles.count) articles")
+		Self.logger.info("ArticlesTable: fetched page of \(articles.count, privacy: .public) articles in \(elapsed, privacy: .public) seconds in account \(self.accountID, privacy: .public)")
+
+		// A short page is the last one.
+		return ArticlesPage(articles: articles, nextCursor: rowCount < limit ? nil : lastRowCursor)
+	}
+
 	func fetchArticlesForFeedID(_ feedID: String, _ database: FMDatabase) -> Set<Article> {
 		return fetchArticlesWithWhereClause(database, whereClause: "articles.feedID = ?", parameters: [feedID as AnyObject])
 	}
@@ -932,8 +1092,8 @@ nonisolated private extension ArticlesTable {
 
 	// MARK: - Saving Parsed Items
 
-	func callUpdateArticlesCompletionBlock(_ newArticles: Set<Article>?, _ updatedArticles: Set<Article>?, _ deletedArticles: Set<Article>?, _ completion: @escaping UpdateArticlesCompletionBlock) {
-		let articleChanges = ArticleChanges(new: newArticles, updated: updatedArticles, deleted: deletedArticles)
+	func callUpdateArticlesCompletionBlock(_ newArticles: Set<Article>?, _ updatedArticles: Set<Article>?, _ deletedArticles: Set<Article>?, _ timing: ArticleUpdateTiming?, _ completion: @escaping UpdateArticlesCompletionBlock) {
+		let articleChanges = ArticleChanges(new: newArticles, updated: updatedArticles, deleted: deletedArticles, timing: timing)
 		DispatchQueue.main.async {
 			completion(articleChanges)
 		}
@@ -946,16 +1106,23 @@ nonisolated private extension ArticlesTable {
 		return newArticles.isEmpty ? nil : newArticles
 	}
 
-	func findAndSaveNewArticles(_ incomingArticles: Set<Article>, _ fetchedArticlesDictionary: [String: Article], _ database: FMDatabase) -> Set<Article>? { // 5
-		guard let newArticles = findNewArticles(incomingArticles, fetchedArticlesDictionary) else {
+	/// `bodyTexts` gets the plain text of each new article’s body, for the search index.
+	func findAndSaveNewArticles(_ incomingArticles: Set<Article>, _ fetchedArticlesDictionary: [String: Article], _ bodyTexts: inout [String: String], _ database: FMDatabase) -> Set<Article>? { // 5
+		guard let foundArticles = findNewArticles(incomingArticles, fetchedArticlesDictionary) else {
 			return nil
 		}
+		let newArticles = Article.summarized(foundArticles, &bodyTexts)
 		self.saveNewArticles(newArticles, database)
 		return newArticles
 	}
 
 	func saveNewArticles(_ articles: Set<Article>, _ database: FMDatabase) {
-		insertRows(articles.databaseDictionaries(), insertType: .orReplace, in: database)
+		// Bind values directly rather than going through a dictionary per article.
+		// The SQL doesn’t vary, so FMDatabase prepares it once and reuses it.
+		for article in articles {
+			let bodyHash = ArticleBodies.save(article.contentHTML, compressesBodies: compressesBodies, database)
+			database.executeUpdate(insertArticleSQL, withArgumentsIn: article.databaseValues(compressesBodies: compressesBodies, bodyHash: bodyHash))
+		}
 	}
 
 	// MARK: - Updating Existing Articles
@@ -973,11 +1140,13 @@ nonisolated private extension ArticlesTable {
 		return updatedArticles.isEmpty ? nil : updatedArticles
 	}
 
-	func findAndSaveUpdatedArticles(_ incomingArticles: Set<Article>, _ fetchedArticlesDictionary: [String: Article], _ database: FMDatabase) -> Set<Article>? { // 6
-		guard let updatedArticles = findUpdatedArticles(incomingArticles, fetchedArticlesDictionary) else {
+	/// `bodyTexts` gets the plain text of each updated article’s body, for the search index.
+	func findAndSaveUpdatedArticles(_ incomingArticles: Set<Article>, _ fetchedArticlesDictionary: [String: Article], _ bodyTexts: inout [String: String], _ database: FMDatabase) -> Set<Article>? { // 6
+		guard let foundArticles = findUpdatedArticles(incomingArticles, fetchedArticlesDictionary) else {
 			return nil
 		}
-		saveUpdatedArticles(Set(updatedArticles), fetchedArticlesDictionary, database)
+		let updatedArticles = Article.summarized(foundArticles, &bodyTexts)
+		saveUpdatedArticles(updatedArticles, fetchedArticlesDictionary, database)
 		return updatedArticles
 	}
 
@@ -996,10 +1165,22 @@ nonisolated private extension ArticlesTable {
 			saveNewArticles(Set([updatedArticle]), database)
 			return
 		}
-		guard let changesDictionary = updatedArticle.changesFrom(fetchedArticle), changesDictionary.count > 0 else {
+		guard var changesDictionary = updatedArticle.changesFrom(fetchedArticle), changesDictionary.count > 0 else {
 			// Not unexpected. There may be no changes.
 			return
 		}
+		if let contentHTML = changesDictionary[DatabaseKey.contentHTML] as? String {
+			// The triggers on articles count the new body and release the old one.
+			if let bodyHash = ArticleBodies.save(contentHTML, compressesBodies: compressesBodies, database) {
+				changesDictionary[DatabaseKey.contentHTML] = NSNull()
+				changesDictionary[DatabaseKey.bodyHash] = bodyHash
+			} else {
+				changesDictionary[DatabaseKey.bodyHash] = NSNull()
+			}
+		}
+		if compressesBodies {
+			ArticleBodyCompression.compressBodies(&changesDictionary)
+		}
 
 		updateRowsWithDictionary(changesDictionary, whereKey: DatabaseKey.articleID, matches: updatedArticle.articleID, database: database)
 	}
@@ -1042,7 +1223,11 @@ nonisolated private extension ArticlesTable {
 }
 
 private extension Set where Element == ParsedItem {
-	func articleIDs() -> Set<String> {
-		return Set<String>(map { $0.articleID })
+	func dictionaryByArticleID() -> [String: ParsedItem] {
+		var d = [String: ParsedItem](minimumCapacity: count)
+		for parsedItem in self {
+			d[parsedItem.articleID] = parsedItem
+		}
+		return d
 	}
 }
@@ -63,7 +63,7 @@ private extension AuthorsSchemaMigration {
 
 	func fetchNextBatch(limit: Int) async -> Set<String> {
 		await withCheckedContinuation { continuation in
-			queue.runInDatabase { database in
+			queue.runInDatabase(priority: .maintenance) { database in
 				guard database.tableExists("authorsLookup") else {
 					continuation.resume(returning: Set<String>())
 					return
@@ -89,7 +89,7 @@ private extension AuthorsSchemaMigration {
 
 	func dropLegacyTables() async {
 		await withCheckedContinuation { continuation in
-			queue.runInDatabase { database in
+			queue.runInDatabase(priority: .maintenance) { database in
 				database.executeStatements("drop index if exists authorsLookup_articleID; drop table if exists authorsLookup; drop table if exists authors;")
 				continuation.resume()
 			}
@@ -98,7 +98,7 @@ private extension AuthorsSchemaMigration {
 
 	func backfillBatch(_ articleIDs: Set<String>) async {
 		await withCheckedContinuation { continuation in
-			queue.runInDatabase { database in
+			queue.runInDatabase(priority: .maintenance) { database in
 				let authorsByArticleID = fetchAuthorsByArticleID(articleIDs, database: database)
 				if authorsByArticleID.isEmpty {
 					continuation.resume()
@@ -34,6 +34,11 @@ struct DatabaseKey {
 	static let dateModified = "dateModified"
 	static let authors = "authors"
 	static let searchRowID = "searchRowID"
+	static let preview = "preview"
+	static let bodyHash = "bodyHash"
+
+	// ArticleBodies
+	static let sharedContentHTML = "sharedContentHTML"
 
 	// ArticleStatus
 	static let read = "read"
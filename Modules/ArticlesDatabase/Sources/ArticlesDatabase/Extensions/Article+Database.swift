@@ -14,7 +14,9 @@ import RSParser
 
 extension Article {
 
-	convenience init?(accountID: String, row: FMResultSet, status: ArticleStatus) {
+	/// `sharedContentHTML` is the body from `articleBodies`, for a row whose
+	/// own `contentHTML` is null because the body is shared.
+	convenience init?(accountID: String, row: FMResultSet, status: ArticleStatus, sharedContentHTML: String? = nil) {
 		guard let articleID = row.swiftString(forColumn: DatabaseKey.articleID) else {
 			assertionFailure("Expected articleID.")
 			return nil
@@ -29,18 +31,19 @@ extension Article {
 		}
 
 		let title = row.swiftString(forColumn: DatabaseKey.title)
-		let contentHTML = row.swiftString(forColumn: DatabaseKey.contentHTML)
-		let contentText = row.swiftString(forColumn: DatabaseKey.contentText)
-		let markdown = row.swiftString(forColumn: DatabaseKey.markdown)
+		let contentHTML = ArticleBodyCompression.body(row, DatabaseKey.contentHTML) ?? sharedContentHTML
+		let contentText = ArticleBodyCompression.body(row, DatabaseKey.contentText)
+		let markdown = ArticleBodyCompression.body(row, DatabaseKey.markdown)
 		let url = row.swiftString(forColumn: DatabaseKey.url)
 		let externalURL = row.swiftString(forColumn: DatabaseKey.externalURL)
-		let summary = row.swiftString(forColumn: DatabaseKey.summary)
+		let summary = ArticleBodyCompression.body(row, DatabaseKey.summary)
 		let imageURL = row.swiftString(forColumn: DatabaseKey.imageURL)
 		let datePublished = row.date(forColumn: DatabaseKey.datePublished)
 		let dateModified = row.date(forColumn: DatabaseKey.dateModified)
 		let authors = Self.authorsFromRow(row)
+		let preview = row.swiftString(forColumn: DatabaseKey.preview)
 
-		self.init(accountID: accountID, articleID: articleID, feedID: feedID, uniqueID: uniqueID, title: title, contentHTML: contentHTML, contentText: contentText, markdown: markdown, url: url, externalURL: externalURL, summary: summary, imageURL: imageURL, datePublished: datePublished, dateModified: dateModified, authors: authors, status: status)
+		self.init(accountID: accountID, articleID: articleID, feedID: feedID, uniqueID: uniqueID, title: title, contentHTML: contentHTML, contentText: contentText, markdown: markdown, url: url, externalURL: externalURL, summary: summary, imageURL: imageURL, datePublished: datePublished, dateModified: dateModified, authors: authors, status: status, preview: preview)
 	}
 
 	private static func authorsFromRow(_ row: FMResultSet) -> Set<Author>? {
@@ -50,7 +53,10 @@ extension Article {
 		return Author.authorsWithJSON(data)
 	}
 
-	convenience init(parsedItem: ParsedItem, maximumDateAllowed: Date, accountID: String, feedID: String, status: ArticleStatus) {
+	/// `articleID` is `parsedItem.articleID`, passed in so that it’s calculated
+	/// (an MD5 hash, for most feeds) just once per item. There’s no preview
+	/// yet — see `summarized`.
+	convenience init(parsedItem: ParsedItem, articleID: String, maximumDateAllowed: Date, accountID: String, feedID: String, status: ArticleStatus) {
 		let authors = Author.authorsWithParsedAuthors(parsedItem.authors)
 
 		// Deal with future datePublished and dateModified dates.
@@ -67,7 +73,11 @@ extension Article {
 			dateModified = nil
 		}
 
-		self.init(accountID: accountID, articleID: parsedItem.syncServiceID, feedID: feedID, uniqueID: parsedItem.uniqueID, title: parsedItem.title, contentHTML: parsedItem.contentHTML, contentText: parsedItem.contentText, markdown: parsedItem.markdown, url: parsedItem.url, externalURL: parsedItem.externalURL, summary: parsedItem.summary, imageURL: parsedItem.imageURL, datePublished: datePublished, dateModified: dateModified, authors: authors, status: status)
+		// parsedItem.articleID is calculated from feedURL, while Article calculates it from feedID.
+		// These are the same in practice — but if not, let Article do its own calculation.
+		let articleID = parsedItem.syncServiceID != nil || parsedItem.feedURL == feedID ? articleID : nil
+
+		self.init(accountID: accountID, articleID: articleID, feedID: feedID, uniqueID: parsedItem.uniqueID, title: parsedItem.title, contentHTML: parsedItem.contentHTML, contentText: parsedItem.contentText, markdown: parsedItem.markdown, url: parsedItem.url, externalURL: parsedItem.externalURL, summary: parsedItem.summary, imageURL: parsedItem.imageURL, datePublished: datePublished, dateModified: dateModified, authors: authors, status: status)
 	}
 
 	private func addPossibleStringChangeWithKeyPath(_ comparisonKeyPath: KeyPath<Article, String?>, _ otherArticle: Article, _ key: String, _ dictionary: inout DatabaseDictionary) {
@@ -93,6 +103,7 @@ extension Article {
 		addPossibleStringChangeWithKeyPath(\Article.rawExternalLink, existingArticle, DatabaseKey.externalURL, &d)
 		addPossibleStringChangeWithKeyPath(\Article.summary, existingArticle, DatabaseKey.summary, &d)
 		addPossibleStringChangeWithKeyPath(\Article.rawImageLink, existingArticle, DatabaseKey.imageURL, &d)
+		addPossibleStringChangeWithKeyPath(\Article.preview, existingArticle, DatabaseKey.preview, &d)
 
 		if authors != existingArticle.authors {
 			if let authors, !authors.isEmpty, let json = authors.json() {
@@ -127,68 +138,91 @@ extension Article {
 		return Date().addingTimeInterval(60 * 60 * 24) // Allow dates up to about 24 hours ahead of now
 	}
 
-	static func articlesWithFeedIDsAndItems(_ feedIDsAndItems: [String: Set<ParsedItem>], _ accountID: String, _ statusesDictionary: [String: ArticleStatus]) -> Set<Article> {
+	static func articlesWithFeedIDsAndItems(_ feedIDsAndItems: [String: [String: ParsedItem]], _ accountID: String, _ statusesDictionary: [String: ArticleStatus]) -> Set<Article> {
 		let maximumDateAllowed = _maximumDateAllowed()
 		var feedArticles = Set<Article>()
-		for (feedID, parsedItems) in feedIDsAndItems {
-			for parsedItem in parsedItems {
-				let status = statusesDictionary[parsedItem.articleID]!
-				let article = Article(parsedItem: parsedItem, maximumDateAllowed: maximumDateAllowed, accountID: accountID, feedID: feedID, status: status)
+		for (feedID, parsedItemsByArticleID) in feedIDsAndItems {
+			for (articleID, parsedItem) in parsedItemsByArticleID {
+				let status = statusesDictionary[articleID]!
+				let article = Article(parsedItem: parsedItem, articleID: articleID, maximumDateAllowed: maximumDateAllowed, accountID: accountID, feedID: feedID, status: status)
 				feedArticles.insert(article)
 			}
 		}
 		return feedArticles
 	}
 
-	static func articlesWithParsedItems(_ parsedItems: Set<ParsedItem>, _ feedID: String, _ accountID: String, _ statusesDictionary: [String: ArticleStatus]) -> Set<Article> {
+	static func articlesWithParsedItems(_ parsedItemsByArticleID: [String: ParsedItem], _ feedID: String, _ accountID: String, _ statusesDictionary: [String: ArticleStatus]) -> Set<Article> {
 		let maximumDateAllowed = _maximumDateAllowed()
-		return Set(parsedItems.map { Article(parsedItem: $0, maximumDateAllowed: maximumDateAllowed, accountID: accountID, feedID: feedID, status: statusesDictionary[$0.articleID]!) })
+		var articles = Set<Article>(minimumCapacity: parsedItemsByArticleID.count)
+		for (articleID, parsedItem) in parsedItemsByArticleID {
+			articles.insert(Article(parsedItem: parsedItem, articleID: articleID, maximumDateAllowed: maximumDateAllowed, accountID: accountID, feedID: feedID, status: statusesDictionary[articleID]!))
+		}
+		return articles
 	}
-}
-
-extension Article {
-
-	func databaseDictionary() -> DatabaseDictionary {
-		var d = DatabaseDictionary()
 
-		d[DatabaseKey.articleID] = articleID
-		d[DatabaseKey.feedID] = feedID
-		d[DatabaseKey.uniqueID] = uniqueID
+	/// Copies of `articles` with their previews, and their bodies’ plain text
+	/// in `bodyTexts` for the search index — one `HTMLContentSummary` pass each.
+	///
+	/// Called only for the articles that are new or changed, after the diff:
+	/// most of a feed is unchanged on any given refresh, and summarizing
+	/// those bodies would be thrown away. The preview isn’t part of equality,
+	/// so leaving it out until now doesn’t change what the diff finds.
+	static func summarized(_ articles: Set<Article>, _ bodyTexts: inout [String: String]) -> Set<Article> {
+		var summarizedArticles = Set<Article>(minimumCapacity: articles.count)
+		for article in articles {
+			summarizedArticles.insert(article.summarized(&bodyTexts))
+		}
+		return summarizedArticles
+	}
 
-		if let title = title {
-			d[DatabaseKey.title] = title
-		}
-		if let contentHTML = contentHTML {
-			d[DatabaseKey.contentHTML] = contentHTML
-		}
-		if let contentText = contentText {
-			d[DatabaseKey.contentText] = contentText
-		}
-		if let markdown = markdown {
-			d[DatabaseKey.markdown] = markdown
-		}
-		if let rawLink = rawLink {
-			d[DatabaseKey.url] = rawLink
+	private func summarized(_ bodyTexts: inout [String: String]) -> Article {
+		guard let body = Self.preferredBody(contentHTML: contentHTML, contentText: contentText, summary: summary) else {
+			return self
 		}
-		if let rawExternalLink = rawExternalLink {
-			d[DatabaseKey.externalURL] = rawExternalLink
-		}
-		if let summary = summary {
-			d[DatabaseKey.summary] = summary
-		}
-		if let rawImageLink = rawImageLink {
-			d[DatabaseKey.imageURL] = rawImageLink
+		let contentSummary = HTMLContentSummary(html: body, baseURL: rawLink.flatMap { URL(string: $0) })
+		bodyTexts[articleID] = contentSummary.text
+		return Article(accountID: accountID, articleID: articleID, feedID: feedID, uniqueID: uniqueID, title: title, contentHTML: contentHTML, contentText: contentText, markdown: markdown, url: rawLink, externalURL: rawExternalLink, summary: summary, imageURL: rawImageLink, datePublished: datePublished, dateModified: dateModified, authors: authors, status: status, preview: contentSummary.preview)
+	}
+
+	/// The body used for the preview and the search index: the first non-empty
+	/// of `contentHTML`, `contentText`, and `summary`.
+	static func preferredBody(contentHTML: String?, contentText: String?, summary: String?) -> String? {
+		if let contentHTML, !contentHTML.isEmpty {
+			return contentHTML
 		}
-		if let datePublished = datePublished {
-			d[DatabaseKey.datePublished] = datePublished
+		if let contentText, !contentText.isEmpty {
+			return contentText
 		}
-		if let dateModified = dateModified {
-			d[DatabaseKey.dateModified] = dateModified
+		if let summary, !summary.isEmpty {
+			return summary
 		}
-		if let authors, !authors.isEmpty, let json = authors.json() {
-			d[DatabaseKey.authors] = json
+		return nil
+	}
+}
+
+extension Article {
+
+	/// Columns for `databaseValues()`, in order.
+	static let databaseColumns = [DatabaseKey.articleID, DatabaseKey.feedID, DatabaseKey.uniqueID, DatabaseKey.title, DatabaseKey.contentHTML, DatabaseKey.contentText, DatabaseKey.markdown, DatabaseKey.url, DatabaseKey.externalURL, DatabaseKey.summary, DatabaseKey.imageURL, DatabaseKey.datePublished, DatabaseKey.dateModified, DatabaseKey.authors, DatabaseKey.preview, DatabaseKey.bodyHash]
+
+	/// Values for a new row, in `databaseColumns` order, with `NSNull` for
+	/// missing values — so the insert SQL is the same for every article, and
+	/// the prepared statement is cached and reused.
+	///
+	/// With a `bodyHash`, `contentHTML` is in `articleBodies`, and the row’s is null.
+	func databaseValues(compressesBodies: Bool = false, bodyHash: String? = nil) -> [Any] {
+		var authorsJSON: String?
+		if let authors, !authors.isEmpty {
+			authorsJSON = authors.json()
+		}
+		func body(_ body: String?) -> Any? {
+			guard compressesBodies, let body else {
+				return body
+			}
+			return ArticleBodyCompression.databaseValue(body)
 		}
-		return d
+		let values: [Any?] = [articleID, feedID, uniqueID, title, bodyHash == nil ? body(contentHTML) : nil, body(contentText), body(markdown), rawLink, rawExternalLink, body(summary), rawImageLink, datePublished, dateModified, authorsJSON, preview, bodyHash]
+		return values.map { $0 ?? NSNull() }
 	}
 }
 
@@ -202,7 +236,4 @@ extension Set where Element == Article {
 		return d
 	}
 
-	func databaseDictionaries() -> [DatabaseDictionary] {
-		return self.map { $0.databaseDictionary() }
-	}
 }
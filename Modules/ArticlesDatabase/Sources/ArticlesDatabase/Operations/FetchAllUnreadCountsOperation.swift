@@ -11,7 +11,7 @@ import RSCore
 import RSDatabase
 import RSDatabaseObjC
 
-@MainActor public final class FetchAllUnreadCountsOperation: MainThreadOperation, @unchecked Sendable {
+public final class FetchAllUnreadCountsOperation: AsyncOperation, @unchecked Sendable {
 	nonisolated(unsafe) var unreadCountDictionary: UnreadCountDictionary?
 	private let queue: DatabaseQueue
 
@@ -20,21 +20,20 @@ import RSDatabaseObjC
 		super.init(name: "FetchAllUnreadCountsOperation")
 	}
 
-	public override func run() {
-		queue.runInDatabase { database in
-			if self.isCanceled {
-				self.didComplete()
-				return
+	public override func run() async {
+		unreadCountDictionary = await withCheckedContinuation { continuation in
+			queue.runInDatabase { database in
+				if self.isCanceled {
+					continuation.resume(returning: nil)
+					return
+				}
+				continuation.resume(returning: self.fetchUnreadCounts(database))
 			}
-
-			self.unreadCountDictionary = self.fetchUnreadCounts(database)
-
-			self.didComplete()
 		}
 	}
 }
 
-nonisolated private extension FetchAllUnreadCountsOperation {
+private extension FetchAllUnreadCountsOperation {
 
 	func fetchUnreadCounts(_ database: FMDatabase) -> UnreadCountDictionary? {
 		let sql = "select distinct feedID, count(*) from articles natural join statuses where read=0 group by feedID;"
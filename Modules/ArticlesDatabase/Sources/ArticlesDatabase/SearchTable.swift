@@ -24,7 +24,9 @@ final class ArticleSearchInfo: Hashable, Sendable {
 	let searchRowID: Int?
 	let bodyForIndex: String
 
-	init(articleID: String, title: String?, contentHTML: String?, contentText: String?, summary: String?, authorsNames: String?, searchRowID: Int?) {
+	/// `bodyText` is the plain text of the body, when it was already made at
+	/// ingest; otherwise it’s made here.
+	init(articleID: String, title: String?, contentHTML: String?, contentText: String?, summary: String?, authorsNames: String?, searchRowID: Int?, bodyText: String? = nil) {
 		self.articleID = articleID
 		self.title = title
 		self.titleForIndex = (title ?? "").normalizedForSearchIndex
@@ -34,19 +36,8 @@ final class ArticleSearchInfo: Hashable, Sendable {
 		self.summary = summary
 		self.searchRowID = searchRowID
 
-		let preferredText: String = {
-			if let body = contentHTML, !body.isEmpty {
-				return body
-			}
-			if let body = contentText, !body.isEmpty {
-				return body
-			}
-			return summary ?? ""
-		}()
-
 		self.bodyForIndex = {
-			let s = preferredText.decodingHTMLEntities()
-			let sanitizedBody = s.strippingHTML()
+			let sanitizedBody = bodyText ?? Self.plainText(contentHTML: contentHTML, contentText: contentText, summary: summary)
 
 			if let authorsNames {
 				return sanitizedBody.appending(" \(authorsNames)")
@@ -56,14 +47,21 @@ final class ArticleSearchInfo: Hashable, Sendable {
 		}().normalizedForSearchIndex
 	}
 
-	convenience init(article: Article) {
+	convenience init(article: Article, bodyText: String? = nil) {
 		let authorsNames: String?
 		if let authors = article.authors {
 			authorsNames = authors.compactMap({ $0.name }).joined(separator: " ")
 		} else {
 			authorsNames = nil
 		}
-		self.init(articleID: article.articleID, title: article.title, contentHTML: article.contentHTML, contentText: article.contentText, summary: article.summary, authorsNames: authorsNames, searchRowID: nil)
+		self.init(articleID: article.articleID, title: article.title, contentHTML: article.contentHTML, contentText: article.contentText, summary: article.summary, authorsNames: authorsNames, searchRowID: nil, bodyText: bodyText)
+	}
+
+	private static func plainText(contentHTML: String?, contentText: String?, summary: String?) -> String {
+		guard let body = Article.preferredBody(contentHTML: contentHTML, contentText: contentText, summary: summary) else {
+			return ""
+		}
+		return HTMLContentSummary(html: body, previewLength: 0).text
 	}
 
 	// MARK: Hashable
@@ -98,11 +96,12 @@ final class SearchTable: DatabaseTable, @unchecked Sendable {
 	}
 
 	/// Add to, or update, the search index for articles with specified IDs.
-	func ensureIndexedArticles(_ articleIDs: Set<String>, _ database: FMDatabase) {
+	/// `bodyTexts` holds plain text already made at ingest, by articleID.
+	func ensureIndexedArticles(_ articleIDs: Set<String>, _ database: FMDatabase, bodyTexts: [String: String] = [:]) {
 		guard let articlesTable = articlesTable else {
 			return
 		}
-		guard let articleSearchInfos = articlesTable.fetchArticleSearchInfos(articleIDs, in: database) else {
+		guard let articleSearchInfos = articlesTable.fetchArticleSearchInfos(articleIDs, bodyTexts: bodyTexts, in: database) else {
 			return
 		}
 
@@ -114,14 +113,14 @@ final class SearchTable: DatabaseTable, @unchecked Sendable {
 	}
 
 	/// Index new articles.
-	func indexNewArticles(_ articles: Set<Article>, _ database: FMDatabase) {
-		let articleSearchInfos = Set(articles.map { ArticleSearchInfo(article: $0) })
+	func indexNewArticles(_ articles: Set<Article>, _ bodyTexts: [String: String], _ database: FMDatabase) {
+		let articleSearchInfos = Set(articles.map { ArticleSearchInfo(article: $0, bodyText: bodyTexts[$0.articleID]) })
 		performInitialIndexForArticles(articleSearchInfos, database)
 	}
 
 	/// Index updated articles.
-	func indexUpdatedArticles(_ articles: Set<Article>, _ database: FMDatabase) {
-		ensureIndexedArticles(articles.articleIDs(), database)
+	func indexUpdatedArticles(_ articles: Set<Article>, _ bodyTexts: [String: String], _ database: FMDatabase) {
+		ensureIndexedArticles(articles.articleIDs(), database, bodyTexts: bodyTexts)
 	}
 }
 
@@ -136,10 +135,34 @@ private extension SearchTable {
 	}
 
 	func performInitialIndex(_ article: ArticleSearchInfo, _ database: FMDatabase) {
-		let rowid = insert(article, database)
+		let rowid = sharableSearchRowID(article, database) ?? insert(article, database)
 		articlesTable?.updateRowsWithValue(rowid, valueKey: DatabaseKey.searchRowID, whereKey: DatabaseKey.articleID, matches: [article.articleID], database: database)
 	}
 
+	/// The search row of another article with the same shared body, if that
+	/// row’s text is exactly what this article would index — the same story
+	/// from another feed. Articles with the same body share a search row.
+	func sharableSearchRowID(_ article: ArticleSearchInfo, _ database: FMDatabase) -> Int? {
+		let sql = "select s.rowid from articles a join articles b on b.bodyHash = a.bodyHash join \(name) s on s.rowid = b.searchRowID where a.articleID = ? and b.articleID != a.articleID and s.title = ? and s.body = ? limit 1;"
+		guard let resultSet = database.executeQuery(sql, withArgumentsIn: [article.articleID, article.titleForIndex, article.bodyForIndex]) else {
+			return nil
+		}
+		defer {
+			resultSet.close()
+		}
+		return resultSet.next() ? Int(resultSet.longLongInt(forColumnIndex: 0)) : nil
+	}
+
+	func isSearchRowShared(_ searchRowID: Int, _ articleID: String, _ database: FMDatabase) -> Bool {
+		guard let resultSet = database.executeQuery("select 1 from articles where searchRowID = ? and articleID != ? limit 1;", withArgumentsIn: [searchRowID, articleID]) else {
+			return false
+		}
+		defer {
+			resultSet.close()
+		}
+		return resultSet.next()
+	}
+
 	func insert(_ article: ArticleSearchInfo, _ database: FMDatabase) -> Int {
 		let rowDictionary: DatabaseDictionary = [DatabaseKey.body: article.bodyForIndex, DatabaseKey.title: article.titleForIndex]
 		insertRow(rowDictionary, insertType: .normal, in: database)
@@ -199,6 +222,12 @@ private extension SearchTable {
 			return
 		}
 
+		// The other articles using this row still match it. This one moves on.
+		if isSearchRowShared(searchRowID, article.articleID, database) {
+			performInitialIndex(article, database)
+			return
+		}
+
 		var updateDictionary = DatabaseDictionary()
 		if title != searchInfo.title {
 			updateDictionary[DatabaseKey.title] = title
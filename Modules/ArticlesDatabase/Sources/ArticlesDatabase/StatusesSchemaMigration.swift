@@ -0,0 +1,85 @@
+//
+//  StatusesSchemaMigration.swift
+//  ArticlesDatabase
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import RSCore
+import os
+import RSDatabase
+import RSDatabaseObjC
+
+/// One-time migration: rebuild `statuses` as a WITHOUT ROWID table.
+///
+/// A rowid table with a TEXT primary key stores every articleID twice — in
+/// the table and in its automatic primary-key index — and each lookup by
+/// articleID (the `natural join statuses` in every fetch) goes through the
+/// index and then the table. A WITHOUT ROWID table is the primary-key
+/// b-tree itself. Status rows are small, which is the case SQLite
+/// recommends WITHOUT ROWID for. (`articles` rows hold whole bodies, so
+/// that table stays as it is.) With no rowid, the statuses cleanup jobs
+/// page through the table by articleID instead.
+///
+/// Idempotent: does nothing once the table is WITHOUT ROWID. Runs in one
+/// transaction, so an interrupted migration leaves the old table intact.
+///
+/// Cost: it copies every status row and rebuilds the starred index, and the
+/// database queue is blocked until it’s done — roughly a third of a second
+/// per 100,000 statuses, and about two seconds for 500,000, on a desktop
+/// machine. It can’t be split into batches: until the copy is complete, reads
+/// need the old table. So it runs once, at `.maintenance` priority (see
+/// `ArticlesDatabase.runDeferredStartupWork`), after the fetches and saves
+/// already waiting — and anything enqueued while it runs waits for it.
+struct StatusesSchemaMigration {
+
+	private static let logger = Logger(subsystem: Logger.nnwSubsystem, category: "StatusesSchemaMigration")
+
+	static let createStatement = "CREATE TABLE if not EXISTS statuses (articleID TEXT NOT NULL PRIMARY KEY, read BOOL NOT NULL DEFAULT 0, starred BOOL NOT NULL DEFAULT 0, dateArrived DATE NOT NULL DEFAULT 0) WITHOUT ROWID;"
+
+	static func migrateIfNeeded(_ database: FMDatabase, accountID: String) {
+		guard needsMigration(database) else {
+			return
+		}
+
+		logger.info("StatusesSchemaMigration: starting in account \(accountID, privacy: .public)")
+		let startTime = Date()
+
+		database.beginTransaction()
+		let didMigrate = database.executeStatements("""
+		ALTER TABLE statuses RENAME TO statuses_rowid;
+		DROP INDEX if EXISTS statuses_starred_index;
+		\(createStatement)
+		INSERT INTO statuses (articleID, read, starred, dateArrived) SELECT articleID, read, starred, dateArrived FROM statuses_rowid;
+		DROP TABLE statuses_rowid;
+		CREATE INDEX if not EXISTS statuses_starred_index on statuses (starred);
+		""")
+		if didMigrate {
+			database.commit()
+		} else {
+			database.rollback()
+			logger.error("StatusesSchemaMigration: failed in account \(accountID, privacy: .public) — \(database.lastErrorMessage(), privacy: .public)")
+			return
+		}
+
+		let elapsed = Date().timeIntervalSince(startTime)
+		logger.info("StatusesSchemaMigration: finished in account \(accountID, privacy: .public) — \(elapsed, privacy: .public) seconds")
+	}
+}
+
+private extension StatusesSchemaMigration {
+
+	static func needsMigration(_ database: FMDatabase) -> Bool {
+		guard let resultSet = database.executeQuery("select sql from sqlite_master where type = 'table' and name = 'statuses';", withArgumentsIn: []) else {
+			return false
+		}
+		defer {
+			resultSet.close()
+		}
+		guard resultSet.next(), let sql = resultSet.string(forColumn: "sql") else {
+			return false
+		}
+		return !sql.uppercased().contains("WITHOUT ROWID")
+	}
+}
@@ -223,12 +223,6 @@ final class StatusesTable: DatabaseTable, Sendable {
 
 		return d
 	}
-
-	// MARK: - Cleanup
-
-	func removeStatuses(_ articleIDs: Set<String>, _ database: FMDatabase) {
-		deleteRowsWhere(key: DatabaseKey.articleID, equalsAnyValue: Array(articleIDs), in: database)
-	}
 }
 
 // MARK: - Private
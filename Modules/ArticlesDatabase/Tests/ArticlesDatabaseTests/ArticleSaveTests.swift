@@ -0,0 +1,130 @@
+//
+//  ArticleSaveTests.swift
+//  ArticlesDatabase
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import Testing
+import Articles
+import RSParser
+import RSDatabaseObjC
+import ArticlesDatabase
+
+/// New articles are saved by binding values directly to a shared insert
+/// statement. These tests read them back through a second database
+/// instance — bypassing the articles cache — to check what was stored.
+@MainActor @Suite final class ArticleSaveTests {
+
+	private let feedID = "https://example.com/feed.xml"
+	private let folder = (NSTemporaryDirectory() as NSString).appendingPathComponent("ArticleSaveTests-\(UUID().uuidString)")
+	private var databasePath: String {
+		(folder as NSString).appendingPathComponent("DB.sqlite3")
+	}
+
+	init() throws {
+		try FileManager.default.createDirectory(atPath: folder, withIntermediateDirectories: true)
+	}
+
+	deinit {
+		try? FileManager.default.removeItem(atPath: folder)
+	}
+
+	@Test func savedArticlesRoundTrip() async {
+		let datePublished = Date(timeIntervalSinceReferenceDate: 800_000_000)
+		let full = ParsedItem(syncServiceID: nil, uniqueID: "full", feedURL: feedID, url: "https://example.com/full", externalURL: "https://example.org/", title: "Full", language: nil, contentHTML: "<p>Full</p>", contentText: nil, markdown: nil, summary: "Summary", imageURL: "https://example.com/image.png", bannerImageURL: nil, datePublished: datePublished, dateModified: nil, authors: Set([ParsedAuthor(name: "Author", url: nil, avatarURL: nil, emailAddress: nil)]), tags: nil, attachments: nil)
+		let sparse = ParsedItem(syncServiceID: nil, uniqueID: "sparse", feedURL: feedID, url: nil, externalURL: nil, title: nil, language: nil, contentHTML: nil, contentText: nil, markdown: nil, summary: nil, imageURL: nil, bannerImageURL: nil, datePublished: nil, dateModified: nil, authors: nil, tags: nil, attachments: nil)
+
+		let writer = ArticlesDatabase(databaseFilePath: databasePath, accountID: "test", retentionStyle: .feedBased)
+		let changes = await writer.updateAsync(parsedItems: [full, sparse], feedID: feedID, deleteOlder: false)
+		#expect(changes.new?.count == 2)
+
+		let reader = ArticlesDatabase(databaseFilePath: databasePath, accountID: "test", retentionStyle: .feedBased)
+		let articles = await reader.fetchArticlesAsync(feedID: feedID)
+		#expect(articles.count == 2)
+
+		let fullArticle = articles.first { $0.uniqueID == "full" }
+		#expect(fullArticle?.articleID == Article.calculatedArticleID(feedID: feedID, uniqueID: "full"))
+		#expect(fullArticle?.title == "Full")
+		#expect(fullArticle?.contentHTML == "<p>Full</p>")
+		#expect(fullArticle?.rawExternalLink == "https://example.org/")
+		#expect(fullArticle?.summary == "Summary")
+		#expect(fullArticle?.datePublished == datePublished)
+		#expect(fullArticle?.authors?.first?.name == "Author")
+		#expect(fullArticle?.preview == "Full")
+
+		let sparseArticle = articles.first { $0.uniqueID == "sparse" }
+		#expect(sparseArticle != nil)
+		#expect(sparseArticle?.title == nil)
+		#expect(sparseArticle?.contentHTML == nil)
+		#expect(sparseArticle?.datePublished == nil)
+		#expect(sparseArticle?.authors == nil)
+		#expect(sparseArticle?.preview == nil)
+	}
+
+	@Test func updatingUnchangedItemsReportsNoChanges() async {
+		let items = Set((0..<50).map { ParsedItem(syncServiceID: nil, uniqueID: String($0), feedURL: feedID, url: nil, externalURL: nil, title: "Article \($0)", language: nil, contentHTML: nil, contentText: nil, markdown: nil, summary: nil, imageURL: nil, bannerImageURL: nil, datePublished: nil, dateModified: nil, authors: nil, tags: nil, attachments: nil) })
+
+		let database = ArticlesDatabase(databaseFilePath: databasePath, accountID: "test", retentionStyle: .feedBased)
+		let firstChanges = await database.updateAsync(parsedItems: items, feedID: feedID, deleteOlder: false)
+		#expect(firstChanges.new?.count == 50)
+
+		let secondChanges = await database.updateAsync(parsedItems: items, feedID: feedID, deleteOlder: false)
+		#expect(secondChanges.new == nil)
+		#expect(secondChanges.updated == nil)
+	}
+
+	@Test func compressedBodiesRoundTrip() async throws {
+		let longHTML = String(repeating: "<p>A paragraph of <b>feed</b> HTML, repeated.</p>\n", count: 100) + "<p>zymurgy</p>"
+		let item = ParsedItem(syncServiceID: nil, uniqueID: "long", feedURL: feedID, url: nil, externalURL: nil, title: "Long", language: nil, contentHTML: longHTML, contentText: nil, markdown: nil, summary: "Short summary", imageURL: nil, bannerImageURL: nil, datePublished: nil, dateModified: nil, authors: nil, tags: nil, attachments: nil)
+
+		let writer = ArticlesDatabase(databaseFilePath: databasePath, accountID: "test", retentionStyle: .feedBased, compressesBodies: true)
+		let changes = await writer.updateAsync(parsedItems: [item], feedID: feedID, deleteOlder: false)
+		#expect(changes.new?.count == 1)
+
+		// The search index is fed uncompressed text.
+		let matches = await writer.fetchArticlesMatchingAsync(searchString: "zymurgy", feedIDs: [feedID])
+		#expect(matches.count == 1)
+
+		// A database that doesn’t compress still reads compressed bodies.
+		let reader = ArticlesDatabase(databaseFilePath: databasePath, accountID: "test", retentionStyle: .feedBased)
+		let article = try #require(await reader.fetchArticlesAsync(feedID: feedID).first)
+		#expect(article.contentHTML == longHTML)
+		#expect(article.summary == "Short summary")
+
+		let checkDatabase = try #require(FMDatabase(path: databasePath))
+		#expect(checkDatabase.open())
+		// contentHTML is long enough to be stored in articleBodies.
+		let resultSet = try #require(checkDatabase.executeQuery("select typeof(sharedContentHTML), typeof(summary) from articles join articleBodies using (bodyHash);", withArgumentsIn: []))
+		#expect(resultSet.next())
+		#expect(resultSet.string(forColumnIndex: 0) == "blob")
+		#expect(resultSet.string(forColumnIndex: 1) == "text") // Too short to compress
+		resultSet.close()
+		checkDatabase.close()
+	}
+
+	@Test func statusesMigrateToWithoutRowIDTable() async throws {
+		// A database from before the migration, with a rowid statuses table.
+		let legacyDatabase = try #require(FMDatabase(path: databasePath))
+		#expect(legacyDatabase.open())
+		legacyDatabase.executeStatements("CREATE TABLE statuses (articleID TEXT NOT NULL PRIMARY KEY, read BOOL NOT NULL DEFAULT 0, starred BOOL NOT NULL DEFAULT 0, dateArrived DATE NOT NULL DEFAULT 0); CREATE INDEX statuses_starred_index on statuses (starred); INSERT INTO statuses VALUES ('starred', 0, 1, 0); INSERT INTO statuses VALUES ('unread', 0, 0, 0);")
+		legacyDatabase.close()
+
+		// The migration runs at maintenance priority, and maintenance work
+		// runs in order — so it’s done once the vacuum is.
+		let database = ArticlesDatabase(databaseFilePath: databasePath, accountID: "test", retentionStyle: .feedBased)
+		database.runDeferredStartupWork()
+		await database.vacuum()
+		#expect(await database.fetchStarredArticleIDsAsync() == ["starred"])
+		#expect(await database.fetchUnreadArticleIDsAsync() == ["starred", "unread"])
+
+		let checkDatabase = try #require(FMDatabase(path: databasePath))
+		#expect(checkDatabase.open())
+		let resultSet = try #require(checkDatabase.executeQuery("select sql from sqlite_master where type = 'table' and name = 'statuses';", withArgumentsIn: []))
+		#expect(resultSet.next())
+		#expect(resultSet.string(forColumn: "sql")?.contains("WITHOUT ROWID") == true)
+		resultSet.close()
+		checkDatabase.close()
+	}
+}
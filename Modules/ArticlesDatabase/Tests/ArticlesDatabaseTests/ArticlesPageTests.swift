@@ -0,0 +1,94 @@
+//
+//  ArticlesPageTests.swift
+//  ArticlesDatabase
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import Testing
+import Articles
+import RSParser
+import ArticlesDatabase
+
+@MainActor @Suite final class ArticlesPageTests {
+
+	private let feedID = "https://example.com/feed.xml"
+	private let folder = (NSTemporaryDirectory() as NSString).appendingPathComponent("ArticlesPageTests-\(UUID().uuidString)")
+	private var databasePath: String {
+		(folder as NSString).appendingPathComponent("DB.sqlite3")
+	}
+
+	init() throws {
+		try FileManager.default.createDirectory(atPath: folder, withIntermediateDirectories: true)
+	}
+
+	deinit {
+		try? FileManager.default.removeItem(atPath: folder)
+	}
+
+	@Test(arguments: [ComparisonResult.orderedDescending, .orderedAscending])
+	func pagesMatchSortingEverything(sortDirection: ComparisonResult) async {
+		let database = await makeDatabase(itemCount: 100)
+
+		let allArticles = await database.fetchArticlesAsync(feedID: feedID)
+		let expectedArticleIDs = allArticles.sortedByLogicalDate(sortDirection).map(\.articleID)
+
+		let pagedArticleIDs = await fetchAllPages(database, filter: ArticlesPageFilter(), sortDirection: sortDirection, limit: 7)
+		#expect(pagedArticleIDs == expectedArticleIDs)
+	}
+
+	@Test func unreadFilterPagesOnlyUnreadArticles() async {
+		let database = await makeDatabase(itemCount: 60)
+
+		let allArticles = await database.fetchArticlesAsync(feedID: feedID)
+		let readArticleIDs = Set(allArticles.map(\.articleID).sorted().prefix(25))
+		_ = await database.markAsync(articleIDs: readArticleIDs, statusKey: .read, flag: true)
+
+		let unreadArticles = await database.fetchUnreadArticlesAsync(feedIDs: [feedID])
+		let expectedArticleIDs = unreadArticles.sortedByLogicalDate(.orderedDescending).map(\.articleID)
+
+		let pagedArticleIDs = await fetchAllPages(database, filter: ArticlesPageFilter(unreadOnly: true), sortDirection: .orderedDescending, limit: 10)
+		#expect(pagedArticleIDs == expectedArticleIDs)
+		#expect(pagedArticleIDs.count == 35)
+	}
+
+	@Test func syncAndAsyncPagesAgree() async {
+		let database = await makeDatabase(itemCount: 30)
+
+		let syncPage = database.fetchArticlesPage(feedIDs: [feedID], filter: ArticlesPageFilter(), sortDirection: .orderedDescending, after: nil, limit: 12)
+		let asyncPage = await database.fetchArticlesPageAsync(feedIDs: [feedID], filter: ArticlesPageFilter(), sortDirection: .orderedDescending, after: nil, limit: 12)
+
+		#expect(syncPage.articles.map(\.articleID) == asyncPage.articles.map(\.articleID))
+		#expect(syncPage.nextCursor == asyncPage.nextCursor)
+		#expect(syncPage.nextCursor != nil)
+	}
+}
+
+private extension ArticlesPageTests {
+
+	/// Every fifth item shares its date with the one before it, and every
+	/// seventh has no datePublished, to exercise ties and the fallback dates.
+	func makeDatabase(itemCount: Int) async -> ArticlesDatabase {
+		let items = Set((0..<itemCount).map { i in
+			let datePublished: Date? = i % 7 == 0 ? nil : Date(timeIntervalSinceReferenceDate: 800_000_000 - Double(i - (i % 5 == 0 ? 1 : 0)) * 3_600)
+			return ParsedItem(syncServiceID: nil, uniqueID: String(i), feedURL: feedID, url: nil, externalURL: nil, title: "Article \(i)", language: nil, contentHTML: nil, contentText: nil, markdown: nil, summary: nil, imageURL: nil, bannerImageURL: nil, datePublished: datePublished, dateModified: nil, authors: nil, tags: nil, attachments: nil)
+		})
+
+		let database = ArticlesDatabase(databaseFilePath: databasePath, accountID: "test", retentionStyle: .feedBased)
+		_ = await database.updateAsync(parsedItems: items, feedID: feedID, deleteOlder: false)
+		return database
+	}
+
+	func fetchAllPages(_ database: ArticlesDatabase, filter: ArticlesPageFilter, sortDirection: ComparisonResult, limit: Int) async -> [String] {
+		var articleIDs = [String]()
+		var cursor: ArticlesPageCursor?
+		repeat {
+			let page = await database.fetchArticlesPageAsync(feedIDs: [feedID], filter: filter, sortDirection: sortDirection, after: cursor, limit: limit)
+			#expect(page.articles.count <= limit)
+			articleIDs += page.articles.map(\.articleID)
+			cursor = page.nextCursor
+		} while cursor != nil
+		return articleIDs
+	}
+}
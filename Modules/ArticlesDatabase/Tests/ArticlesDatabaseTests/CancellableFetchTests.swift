@@ -0,0 +1,68 @@
+//
+//  CancellableFetchTests.swift
+//  ArticlesDatabase
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import Testing
+import Articles
+import RSParser
+import RSDatabase
+import ArticlesDatabase
+
+/// Fetches are cancelable only when given a token: task cancellation alone
+/// must not turn a fetch’s result into an empty set.
+@MainActor @Suite final class CancellableFetchTests {
+
+	private let feedID = "https://example.com/feed.xml"
+	private let folder = (NSTemporaryDirectory() as NSString).appendingPathComponent("CancellableFetchTests-\(UUID().uuidString)")
+	private var databasePath: String {
+		(folder as NSString).appendingPathComponent("DB.sqlite3")
+	}
+
+	init() throws {
+		try FileManager.default.createDirectory(atPath: folder, withIntermediateDirectories: true)
+	}
+
+	deinit {
+		try? FileManager.default.removeItem(atPath: folder)
+	}
+
+	@Test func canceledTaskStillGetsArticles() async {
+		let database = await makeDatabase(itemCount: 10)
+
+		let task = Task { @MainActor in
+			withUnsafeCurrentTask { $0?.cancel() }
+			return await database.fetchArticlesAsync(feedID: feedID)
+		}
+		#expect(await task.value.count == 10)
+	}
+
+	@Test func canceledTokenReturnsEmptySet() async {
+		let database = await makeDatabase(itemCount: 10)
+
+		let cancellationToken = DatabaseCancellationToken()
+		cancellationToken.cancel()
+		let articles = await database.fetchArticlesAsync(feedID: feedID, cancellationToken: cancellationToken)
+		#expect(articles.isEmpty)
+
+		let unreadArticles = await database.fetchUnreadArticlesAsync(feedIDs: [feedID], cancellationToken: DatabaseCancellationToken())
+		#expect(unreadArticles.count == 10)
+	}
+}
+
+private extension CancellableFetchTests {
+
+	func makeDatabase(itemCount: Int) async -> ArticlesDatabase {
+		let database = ArticlesDatabase(databaseFilePath: databasePath, accountID: "test", retentionStyle: .feedBased)
+		let items = Set((0..<itemCount).map { item(uniqueID: "\($0)") })
+		_ = await database.updateAsync(parsedItems: items, feedID: feedID, deleteOlder: false)
+		return database
+	}
+
+	func item(uniqueID: String) -> ParsedItem {
+		ParsedItem(syncServiceID: nil, uniqueID: uniqueID, feedURL: feedID, url: "https://example.com/\(uniqueID)", externalURL: nil, title: uniqueID, language: nil, contentHTML: "<p>\(uniqueID)</p>", contentText: nil, markdown: nil, summary: nil, imageURL: nil, bannerImageURL: nil, datePublished: nil, dateModified: nil, authors: nil, tags: nil, attachments: nil)
+	}
+}
@@ -0,0 +1,128 @@
+//
+//  SharedArticleBodyTests.swift
+//  ArticlesDatabase
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import Testing
+import Articles
+import RSParser
+import RSDatabaseObjC
+import ArticlesDatabase
+
+/// The same long body arriving through several feeds is stored once, in
+/// `articleBodies`, with one search row. These tests check what’s stored
+/// through a separate connection.
+@MainActor @Suite final class SharedArticleBodyTests {
+
+	private let feedIDs = ["https://example.com/feed.xml", "https://example.org/topic.xml", "https://example.net/aggregator.xml"]
+	private let body = String(repeating: "<p>The same story, syndicated to several feeds.</p>\n", count: 40) + "<p>quetzalcoatl</p>"
+	private let folder = (NSTemporaryDirectory() as NSString).appendingPathComponent("SharedArticleBodyTests-\(UUID().uuidString)")
+	private var databasePath: String {
+		(folder as NSString).appendingPathComponent("DB.sqlite3")
+	}
+
+	init() throws {
+		try FileManager.default.createDirectory(atPath: folder, withIntermediateDirectories: true)
+	}
+
+	deinit {
+		try? FileManager.default.removeItem(atPath: folder)
+	}
+
+	@Test func identicalBodiesAreStoredOnce() async throws {
+		let database = ArticlesDatabase(databaseFilePath: databasePath, accountID: "test", retentionStyle: .feedBased)
+		for feedID in feedIDs {
+			_ = await database.updateAsync(parsedItems: [item(feedID, contentHTML: body)], feedID: feedID, deleteOlder: false)
+		}
+
+		let matches = await database.fetchArticlesMatchingAsync(searchString: "quetzalcoatl", feedIDs: Set(feedIDs))
+		#expect(matches.count == 3)
+
+		#expect(try query("select count(*) from articleBodies;") == 1)
+		#expect(try query("select referenceCount from articleBodies;") == 3)
+		#expect(try query("select count(*) from articles where contentHTML is null and bodyHash is not null;") == 3)
+		#expect(try query("select count(distinct searchRowID) from articles;") == 1)
+		#expect(try query("select count(*) from search;") == 1)
+
+		// Read back without the articles cache.
+		let reader = ArticlesDatabase(databaseFilePath: databasePath, accountID: "test", retentionStyle: .feedBased)
+		let articles = await reader.fetchArticlesAsync(feedIDs: Set(feedIDs))
+		#expect(articles.count == 3)
+		#expect(articles.allSatisfy { $0.contentHTML == body })
+	}
+
+	@Test func bodyIsDeletedWithItsLastArticle() async throws {
+		let database = ArticlesDatabase(databaseFilePath: databasePath, accountID: "test", retentionStyle: .feedBased)
+		var articleIDs = [String]()
+		for feedID in feedIDs.prefix(2) {
+			let changes = await database.updateAsync(parsedItems: [item(feedID, contentHTML: body)], feedID: feedID, deleteOlder: false)
+			articleIDs += try #require(changes.new).map(\.articleID)
+		}
+
+		await database.deleteAsync(articleIDs: [articleIDs[0]])
+		#expect(await database.fetchArticlesMatchingAsync(searchString: "quetzalcoatl", feedIDs: Set(feedIDs)).count == 1)
+		#expect(try query("select referenceCount from articleBodies;") == 1)
+		#expect(try query("select count(*) from search;") == 1)
+
+		await database.deleteAsync(articleIDs: [articleIDs[1]])
+		#expect(await database.fetchArticlesMatchingAsync(searchString: "quetzalcoatl", feedIDs: Set(feedIDs)).isEmpty)
+		#expect(try query("select count(*) from articleBodies;") == 0)
+		#expect(try query("select count(*) from search;") == 0)
+	}
+
+	@Test func changedBodyLeavesOtherArticlesAlone() async throws {
+		let database = ArticlesDatabase(databaseFilePath: databasePath, accountID: "test", retentionStyle: .feedBased)
+		for feedID in feedIDs.prefix(2) {
+			_ = await database.updateAsync(parsedItems: [item(feedID, contentHTML: body)], feedID: feedID, deleteOlder: false)
+		}
+
+		let revisedBody = body + "<p>Update: xylophone</p>"
+		let changes = await database.updateAsync(parsedItems: [item(feedIDs[0], contentHTML: revisedBody)], feedID: feedIDs[0], deleteOlder: false)
+		#expect(changes.updated?.count == 1)
+
+		#expect(try query("select count(*) from articleBodies;") == 2)
+		#expect(try query("select sum(referenceCount) from articleBodies;") == 2)
+		#expect(try query("select count(distinct searchRowID) from articles;") == 2)
+		#expect(await database.fetchArticlesMatchingAsync(searchString: "quetzalcoatl", feedIDs: Set(feedIDs)).count == 2)
+		#expect(await database.fetchArticlesMatchingAsync(searchString: "xylophone", feedIDs: Set(feedIDs)).count == 1)
+
+		let reader = ArticlesDatabase(databaseFilePath: databasePath, accountID: "test", retentionStyle: .feedBased)
+		#expect(await reader.fetchArticlesAsync(feedID: feedIDs[1]).first?.contentHTML == body)
+		#expect(await reader.fetchArticlesAsync(feedID: feedIDs[0]).first?.contentHTML == revisedBody)
+	}
+
+	@Test func shortBodiesStayInTheArticleRow() async throws {
+		let database = ArticlesDatabase(databaseFilePath: databasePath, accountID: "test", retentionStyle: .feedBased)
+		for feedID in feedIDs {
+			_ = await database.updateAsync(parsedItems: [item(feedID, contentHTML: "<p>Short</p>")], feedID: feedID, deleteOlder: false)
+		}
+		_ = await database.fetchArticlesAsync(feedIDs: Set(feedIDs))
+
+		#expect(try query("select count(*) from articleBodies;") == 0)
+		#expect(try query("select count(*) from articles where contentHTML is not null and bodyHash is null;") == 3)
+	}
+}
+
+private extension SharedArticleBodyTests {
+
+	func item(_ feedID: String, contentHTML: String) -> ParsedItem {
+		ParsedItem(syncServiceID: nil, uniqueID: "story", feedURL: feedID, url: "https://example.com/story", externalURL: nil, title: "The Story", language: nil, contentHTML: contentHTML, contentText: nil, markdown: nil, summary: nil, imageURL: nil, bannerImageURL: nil, datePublished: nil, dateModified: nil, authors: nil, tags: nil, attachments: nil)
+	}
+
+	func query(_ sql: String) throws -> Int {
+		let database = try #require(FMDatabase(path: databasePath))
+		#expect(database.open())
+		defer {
+			database.close()
+		}
+		let resultSet = try #require(database.executeQuery(sql, withArgumentsIn: []))
+		defer {
+			resultSet.close()
+		}
+		#expect(resultSet.next())
+		return Int(resultSet.longLongInt(forColumnIndex: 0))
+	}
+}
@@ -0,0 +1,99 @@
+//
+//  StatusesCleanupTests.swift
+//  ArticlesDatabase
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import Testing
+import Articles
+import RSParser
+import RSDatabase
+import RSDatabaseObjC
+import ArticlesDatabase
+
+/// `statuses` is migrated to WITHOUT ROWID, so its cleanup jobs can’t page
+/// by rowid. These tests run them against a migrated database, checking
+/// what’s deleted through a separate connection.
+@MainActor @Suite final class StatusesCleanupTests {
+
+	private let subscribedFeedID = "https://example.com/feed.xml"
+	private let unsubscribedFeedID = "https://example.org/feed.xml"
+	private let folder = (NSTemporaryDirectory() as NSString).appendingPathComponent("StatusesCleanupTests-\(UUID().uuidString)")
+	private var databasePath: String {
+		(folder as NSString).appendingPathComponent("DB.sqlite3")
+	}
+
+	init() throws {
+		try FileManager.default.createDirectory(atPath: folder, withIntermediateDirectories: true)
+	}
+
+	deinit {
+		try? FileManager.default.removeItem(atPath: folder)
+	}
+
+	@Test func statusesCleanupJobsDeleteRowsAfterMigration() async throws {
+		// The old rowid schema, with three statuses old enough to delete
+		// and no articles.
+		let oldDate = Date().addingTimeInterval(-60 * 24 * 60 * 60)
+		try execute { database in
+			database.executeStatements("CREATE TABLE statuses (articleID TEXT NOT NULL PRIMARY KEY, read BOOL NOT NULL DEFAULT 0, starred BOOL NOT NULL DEFAULT 0, dateArrived DATE NOT NULL DEFAULT 0);")
+			for articleID in ["orphan1", "orphan2", "orphan3"] {
+				database.executeUpdate("INSERT INTO statuses (articleID, read, starred, dateArrived) VALUES (?, 1, 0, ?);", withArgumentsIn: [articleID, oldDate])
+			}
+		}
+
+		let database = ArticlesDatabase(databaseFilePath: databasePath, accountID: "test", retentionStyle: .feedBased)
+		for feedID in [subscribedFeedID, unsubscribedFeedID] {
+			let items = Set(["one", "two"].map { item(feedID, uniqueID: $0) })
+			_ = await database.updateAsync(parsedItems: items, feedID: feedID, deleteOlder: false)
+		}
+		#expect(try query("select count(*) from statuses;") == 7)
+
+		database.runDeferredStartupWork()
+		// The migration runs at maintenance priority, and maintenance work
+		// runs in order — so it’s done once the vacuum is.
+		await database.vacuum()
+		#expect(try query("select count(*) from sqlite_master where name = 'statuses' and sql like '%WITHOUT ROWID%';") == 1)
+
+		let reports = await database.cleanupDatabase(subscribedToFeedIDs: [subscribedFeedID])
+		let rowsDeleted = Dictionary(uniqueKeysWithValues: reports.map { ($0.jobName, $0.rowsDeleted) })
+
+		#expect(reports.allSatisfy { $0.didFinish && !$0.didFail })
+		#expect(rowsDeleted["deleteStatusesNotInSubscribedToFeedIDs"] == 2)
+		#expect(rowsDeleted["deleteOldStatuses"] == 3)
+		#expect(try query("select count(*) from statuses;") == 2)
+		#expect(try query("select count(*) from RSDatabaseInfo where key like 'maintenance.%';") == 0)
+	}
+}
+
+private extension StatusesCleanupTests {
+
+	func item(_ feedID: String, uniqueID: String) -> ParsedItem {
+		ParsedItem(syncServiceID: nil, uniqueID: uniqueID, feedURL: feedID, url: "https://example.com/\(uniqueID)", externalURL: nil, title: uniqueID, language: nil, contentHTML: "<p>\(uniqueID)</p>", contentText: nil, markdown: nil, summary: nil, imageURL: nil, bannerImageURL: nil, datePublished: nil, dateModified: nil, authors: nil, tags: nil, attachments: nil)
+	}
+
+	func execute(_ block: (FMDatabase) -> Void) throws {
+		let database = try #require(FMDatabase(path: databasePath))
+		#expect(database.open())
+		defer {
+			database.close()
+		}
+		block(database)
+	}
+
+	func query(_ sql: String) throws -> Int {
+		let database = try #require(FMDatabase(path: databasePath))
+		#expect(database.open())
+		defer {
+			database.close()
+		}
+		let resultSet = try #require(database.executeQuery(sql, withArgumentsIn: []))
+		defer {
+			resultSet.close()
+		}
+		#expect(resultSet.next())
+		return Int(resultSet.longLongInt(forColumnIndex: 0))
+	}
+}
@@ -56,7 +56,7 @@ public final class FeedFinder {
 			return (Set([feedSpecifier]), .specialCase)
 		}
 
-		let downloadResponse = try await downloadAndLog(url)
+		let downloadResponse = try await downloadPageAndLog(url)
 		let data = downloadResponse.data
 		let response = downloadResponse.response
 
@@ -95,9 +95,24 @@ public final class FeedFinder {
 	/// fetch shows up in the Feed Finder activity stream. Public so feed-finding-adjacent
 	/// fetches can join the same stream.
 	public static func downloadAndLog(_ url: URL) async throws -> DownloadResponse {
+		try await downloadAndLog(url) {
+			try await Downloader.shared.download(url)
+		}
+	}
+
+	/// Like `downloadAndLog`, but stops after the page’s `<head>` if the head
+	/// links to a feed. Those are the feeds `find` returns — it reads the
+	/// body only when the head has none.
+	static func downloadPageAndLog(_ url: URL) async throws -> DownloadResponse {
+		try await downloadAndLog(url) {
+			try await downloadPage(url)
+		}
+	}
+
+	private static func downloadAndLog(_ url: URL, _ download: () async throws -> DownloadResponse) async throws -> DownloadResponse {
 		let id = await activityFetchStart(url: url)
 		do {
-			let downloadResponse = try await Downloader.shared.download(url)
+			let downloadResponse = try await download()
 			await activityFetchComplete(id: id, data: downloadResponse.data, response: downloadResponse.response, returnedFromCache: downloadResponse.returnedFromCache)
 			return downloadResponse
 		} catch {
@@ -204,6 +219,29 @@ private extension FeedFinder {
 		return feedSpecifiers
 	}
 
+	@MainActor static let headDownloader = HTMLHeadDownloader(userAgentStyle: .feed)
+
+	@MainActor static func downloadPage(_ url: URL) async throws -> DownloadResponse {
+		let urlString = url.absoluteString
+		let downloadResponse = try await headDownloader.download(url) { head in
+			headHasFeedLinks(head, urlString)
+		}
+		if downloadResponse.response == nil {
+			// Skipped — DownloadSession remembers 4xx responses for a while.
+			// Someone asked for this page just now, so ask the server again.
+			return try await Downloader.shared.download(url)
+		}
+		return downloadResponse
+	}
+
+	@MainActor static func headHasFeedLinks(_ head: Data, _ urlString: String) -> Bool {
+		guard head.isProbablyHTML else {
+			return false
+		}
+		let metadata = HTMLMetadataParser.htmlMetadata(with: ParserData(url: urlString, data: head))
+		return metadata.feedLinks.contains { $0.urlString != nil }
+	}
+
 	static func isHTML(_ data: Data) -> Bool {
 		return data.isProbablyHTML
 	}
@@ -117,7 +117,7 @@ nonisolated private extension HTMLMetadataDownloader {
 			activityLog.didStart(.htmlMetadataDownloader, kind: kind)
 
 			do {
-				let downloadResponse = try await Downloader.shared.download(actualURL, userAgentStyle: .browser)
+				let downloadResponse = try await Self.download(actualURL)
 
 				if let data = downloadResponse.data, !data.isEmpty, let response = downloadResponse.response, response.statusIsOK {
 					let urlToUse = response.url ?? actualURL
@@ -156,6 +156,15 @@ nonisolated private extension HTMLMetadataDownloader {
 		}
 	}
 
+	/// Everything we want is in the `<head>`, so stop there — except for
+	/// pages whose metadata isn’t all in the head.
+	@MainActor static func download(_ url: URL) async throws -> DownloadResponse {
+		if HTMLMetadataParser.scansPastHead(url.absoluteString) {
+			return try await Downloader.shared.download(url, userAgentStyle: .browser)
+		}
+		return try await HTMLHeadDownloader.shared.download(url)
+	}
+
 	func postNotification(_ record: HTMLMetadataRecord) {
 		let userInfo: [String: Any] = [
 			HTMLMetadataUserInfoKey.record: record,
@@ -0,0 +1,207 @@
+//
+//  AsyncOperation.swift
+//  RSCore
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import os
+
+/// Code to be run by an `OperationExecutor`, off the main actor.
+///
+/// Override `run()` with the code to be run — this is the only
+/// thing that needs to be overridden. Unlike `MainThreadOperation`,
+/// there’s no `didComplete()` to call: the operation is finished
+/// when `run()` returns.
+///
+/// `run()` should check `isCanceled` (or `Task.isCancelled`) at
+/// appropriate times, and do its best to stop when canceled —
+/// without leaving data in an inconsistent state.
+///
+/// The completion block is called once the operation is finished,
+/// regardless of cancellation status — even if `run()` was never called.
+/// It’s called on the executor, not on the main thread.
+open class AsyncOperation: Hashable, @unchecked Sendable {
+
+	public enum Priority: Int, Comparable, CaseIterable, Sendable {
+		case utility
+		case normal
+		case userInitiated
+
+		public static func < (lhs: Priority, rhs: Priority) -> Bool {
+			lhs.rawValue < rhs.rawValue
+		}
+
+		var taskPriority: TaskPriority {
+			switch self {
+			case .utility:
+				return .utility
+			case .normal:
+				return .medium
+			case .userInitiated:
+				return .userInitiated
+			}
+		}
+	}
+
+	public typealias CompletionBlock = @Sendable (AsyncOperation) -> Void
+
+	public let id: Int
+	public let name: String?
+	public let priority: Priority
+
+	private static let nextID = OSAllocatedUnfairLock(initialState: 0)
+
+	private struct State: Sendable {
+		var isCanceled = false
+		var isFinished = false
+		var dependencies = [AsyncOperation]()
+		var completionBlock: CompletionBlock?
+		var finishContinuations = [CheckedContinuation<Void, Never>]()
+		weak var executor: OperationExecutor?
+	}
+	private let state = OSAllocatedUnfairLock(initialState: State())
+
+	/// Create a new AsyncOperation.
+	///
+	/// This doesn’t add the operation to an executor.
+	/// Call `OperationExecutor.add` to add it.
+	///
+	/// - Parameters:
+	///   - name: Name of the operation — used for debugging and for `cancel(named:)`.
+	///   - priority: Higher-priority operations that are ready to run go first.
+	///   - completionBlock: Called once the operation has finished or been canceled.
+	public init(name: String? = nil, priority: Priority = .normal, completionBlock: CompletionBlock? = nil) {
+		self.id = Self.nextID.withLock { id in
+			defer { id += 1 }
+			return id
+		}
+		self.name = name
+		self.priority = priority
+		self.state.withLock { $0.completionBlock = completionBlock }
+	}
+
+	/// Do the thing this operation does. This method must be subclassed.
+	///
+	/// Runs on the cooperative thread pool. Hop to the main actor
+	/// only for work that has to happen there.
+	open func run() async {
+		preconditionFailure("AsyncOperation.run must be overridden.")
+	}
+
+	/// Check this at appropriate times in case the operation has been canceled.
+	public var isCanceled: Bool {
+		state.withLock { $0.isCanceled }
+	}
+
+	public var isFinished: Bool {
+		state.withLock { $0.isFinished }
+	}
+
+	public var completionBlock: CompletionBlock? {
+		get { state.withLock { $0.completionBlock } }
+		set { state.withLock { $0.completionBlock = newValue } }
+	}
+
+	/// Cancel this operation.
+	///
+	/// If it hasn’t started, it won’t. If it’s running, the task running it
+	/// is canceled too. Operations that depend on it are canceled as well.
+	public func cancel() {
+		let executor = state.withLock { state -> OperationExecutor? in
+			guard !state.isCanceled && !state.isFinished else {
+				return nil
+			}
+			state.isCanceled = true
+			return state.executor
+		}
+		if let executor {
+			Task {
+				await executor.operationWasCanceled(self)
+			}
+		}
+	}
+
+	/// Make this operation dependent on another operation.
+	///
+	/// Do this before adding to the executor. The other operation must
+	/// finish before this one runs. If the other operation is canceled,
+	/// this one is canceled too.
+	public func addDependency(_ parentOperation: AsyncOperation) {
+		state.withLock { $0.dependencies.append(parentOperation) }
+	}
+
+	/// Returns once the operation has finished or been canceled.
+	public func waitUntilFinished() async {
+		await withCheckedContinuation { continuation in
+			let isFinished = state.withLock { state in
+				if !state.isFinished {
+					state.finishContinuations.append(continuation)
+				}
+				return state.isFinished
+			}
+			if isFinished {
+				continuation.resume()
+			}
+		}
+	}
+
+	// MARK: - Hashable
+
+	public func hash(into hasher: inout Hasher) {
+		hasher.combine(id)
+	}
+
+	// MARK: - Equatable
+
+	public static func ==(lhs: AsyncOperation, rhs: AsyncOperation) -> Bool {
+		lhs.id == rhs.id
+	}
+}
+
+// MARK: - OperationExecutor
+
+extension AsyncOperation {
+
+	var dependencies: [AsyncOperation] {
+		state.withLock { $0.dependencies }
+	}
+
+	func setExecutor(_ executor: OperationExecutor) {
+		state.withLock { $0.executor = executor }
+	}
+
+	/// Marks the operation canceled without notifying the executor —
+	/// for when the executor itself is doing the canceling.
+	func markCanceled() {
+		state.withLock { $0.isCanceled = true }
+	}
+
+	/// Marks the operation finished, then calls the completion block and
+	/// resumes anyone in `waitUntilFinished()`. Returns false if it was
+	/// already finished.
+	func finish() -> Bool {
+		let finished = state.withLock { state -> (completionBlock: CompletionBlock?, continuations: [CheckedContinuation<Void, Never>])? in
+			guard !state.isFinished else {
+				return nil
+			}
+			state.isFinished = true
+			defer {
+				state.completionBlock = nil
+				state.finishContinuations = []
+				state.dependencies = []
+			}
+			return (state.completionBlock, state.finishContinuations)
+		}
+		guard let finished else {
+			return false
+		}
+
+		finished.completionBlock?(self)
+		for continuation in finished.continuations {
+			continuation.resume()
+		}
+		return true
+	}
+}
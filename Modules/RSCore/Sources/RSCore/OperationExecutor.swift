@@ -0,0 +1,311 @@
+//
+//  OperationExecutor.swift
+//  RSCore
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+
+/// Runs `AsyncOperation`s off the main actor.
+///
+/// Up to `maxConcurrentOperationCount` operations run at once. An operation
+/// is ready when all of its dependencies have finished; ready operations run
+/// highest priority first, then in the order they were added.
+///
+/// This is for database and sync work. Scheduling, dependency tracking, and
+/// completion all happen here, so they don’t compete with UI work on the
+/// main thread. (`MainThreadOperationQueue` is still the thing to use for
+/// operations that are mostly UI.)
+///
+/// The executor can be suspended and resumed.
+/// It is *not* suspended on creation — it is active.
+public actor OperationExecutor {
+
+	public nonisolated let maxConcurrentOperationCount: Int
+
+	/// Reports progress on the main actor, for the UI.
+	/// Valid only when `isTrackingProgress` is true.
+	public nonisolated let progress: OperationExecutorProgress
+
+	/// Ready to run, in the order added, one list per priority.
+	private var readyOperations = [AsyncOperation.Priority: [AsyncOperation]]()
+
+	/// Waiting on dependencies, with the number of dependencies still unfinished.
+	private var blockedOperations = [Int: (operation: AsyncOperation, unfinishedDependencyCount: Int)]()
+
+	/// Operations waiting on each operation, by its ID.
+	private var dependentOperationIDs = [Int: [Int]]()
+
+	private var runningOperations = [Int: (operation: AsyncOperation, task: Task<Void, Never>)]()
+	private var isSuspended = false
+
+	/// Operations added but not yet started and not canceled.
+	/// Kept as a count, so reading it doesn’t walk anything.
+	public private(set) var pendingOperationsCount = 0
+
+	private var numberCompleted = 0
+	private var lastReportedProgressInfo = ProgressInfo()
+	private var progressSequenceNumber = 0
+
+	/// Controls whether or not `progress` is updated.
+	///
+	/// Turn it on at the beginning of a sync session and off
+	/// when the sync session completes.
+	public var isTrackingProgress = false {
+		didSet {
+			if isTrackingProgress != oldValue {
+				numberCompleted = 0
+				updateProgress()
+			}
+		}
+	}
+
+	public init(maxConcurrentOperationCount: Int = 1) {
+		precondition(maxConcurrentOperationCount > 0)
+		self.maxConcurrentOperationCount = maxConcurrentOperationCount
+		self.progress = OperationExecutorProgress()
+	}
+
+	public var runningOperationsCount: Int {
+		runningOperations.count
+	}
+
+	/// Add an operation. It runs once its dependencies have finished.
+	public func add(_ operation: AsyncOperation) {
+		if isPending(operation) || runningOperations[operation.id] != nil {
+			assertionFailure("Tried to add operation to OperationExecutor that had already been added.")
+			return
+		}
+		operation.setExecutor(self)
+
+		if operation.isCanceled {
+			finish(operation)
+			startOperationsIfNeeded()
+			return
+		}
+
+		pendingOperationsCount += 1
+
+		var unfinishedDependencyCount = 0
+		var hasCanceledDependency = false
+		for dependency in operation.dependencies {
+			if dependency.isFinished {
+				hasCanceledDependency = hasCanceledDependency || dependency.isCanceled
+			} else {
+				unfinishedDependencyCount += 1
+				dependentOperationIDs[dependency.id, default: [Int]()].append(operation.id)
+			}
+		}
+
+		if hasCanceledDependency {
+			blockedOperations[operation.id] = (operation, unfinishedDependencyCount)
+			cancelPending(operation)
+		} else if unfinishedDependencyCount > 0 {
+			blockedOperations[operation.id] = (operation, unfinishedDependencyCount)
+		} else {
+			readyOperations[operation.priority, default: [AsyncOperation]()].append(operation)
+		}
+
+		startOperationsIfNeeded()
+	}
+
+	/// Add multiple operations.
+	/// It’s a convenience — better than calling `add` one-by-one.
+	public func add(_ operations: [AsyncOperation]) {
+		for operation in operations {
+			add(operation)
+		}
+	}
+
+	/// Cancel all running and pending operations.
+	public func cancelAll() {
+		cancel(allOperations)
+	}
+
+	/// Cancel some operations. Operations that depend on them
+	/// are canceled too.
+	public func cancel(_ operations: [AsyncOperation]) {
+		for operation in operations {
+			operation.markCanceled()
+			operationWasCanceled(operation)
+		}
+	}
+
+	/// Cancel operations with the given name — running ones as well as pending ones.
+	/// Operations that depend on them are canceled too.
+	public func cancel(named name: String) {
+		cancel(allOperations.filter { $0.name == name })
+	}
+
+	/// Stop starting operations until `resume()` is called.
+	/// Running operations run to completion — they aren’t canceled.
+	public func suspend() {
+		isSuspended = true
+	}
+
+	/// Resume starting operations.
+	public func resume() {
+		isSuspended = false
+		startOperationsIfNeeded()
+	}
+
+	/// Called by an operation that was canceled via its own `cancel()`.
+	func operationWasCanceled(_ operation: AsyncOperation) {
+		if let running = runningOperations[operation.id] {
+			// It finishes when `run()` returns.
+			running.task.cancel()
+		} else if isPending(operation) {
+			cancelPending(operation)
+			startOperationsIfNeeded()
+		}
+	}
+}
+
+// MARK: - Private
+
+private extension AsyncOperation.Priority {
+
+	static let highestFirst = AsyncOperation.Priority.allCases.sorted(by: >)
+}
+
+private extension OperationExecutor {
+
+	var allOperations: [AsyncOperation] {
+		var operations = runningOperations.values.map(\.operation)
+		operations += blockedOperations.values.map(\.operation)
+		for priorityOperations in readyOperations.values {
+			operations += priorityOperations
+		}
+		return operations
+	}
+
+	func isPending(_ operation: AsyncOperation) -> Bool {
+		blockedOperations[operation.id] != nil || readyOperations[operation.priority]?.contains(operation) == true
+	}
+
+	func startOperationsIfNeeded() {
+		while !isSuspended && runningOperations.count < maxConcurrentOperationCount, let operation = popReadyOperation() {
+			start(operation)
+		}
+		updateProgress()
+	}
+
+	func popReadyOperation() -> AsyncOperation? {
+		for priority in AsyncOperation.Priority.highestFirst {
+			if var operations = readyOperations[priority], !operations.isEmpty {
+				let operation = operations.removeFirst()
+				readyOperations[priority] = operations
+				return operation
+			}
+		}
+		return nil
+	}
+
+	func start(_ operation: AsyncOperation) {
+		pendingOperationsCount -= 1
+
+		// Detached, so `run()` doesn’t run on this actor — or on the main actor.
+		let task = Task.detached(priority: operation.priority.taskPriority) {
+			await operation.run()
+			await self.operationDidRun(operation)
+		}
+		runningOperations[operation.id] = (operation, task)
+	}
+
+	func operationDidRun(_ operation: AsyncOperation) {
+		runningOperations[operation.id] = nil
+		finish(operation)
+		startOperationsIfNeeded()
+	}
+
+	/// Removes a pending operation without running it, and finishes it as canceled.
+	func cancelPending(_ operation: AsyncOperation) {
+		operation.markCanceled()
+		if blockedOperations.removeValue(forKey: operation.id) == nil {
+			readyOperations[operation.priority]?.removeAll { $0 == operation }
+		}
+		pendingOperationsCount -= 1
+		finish(operation)
+	}
+
+	/// Calls the completion block, then releases — or cancels — the operations waiting on this one.
+	func finish(_ operation: AsyncOperation) {
+		guard operation.finish() else {
+			return
+		}
+		if isTrackingProgress {
+			numberCompleted += 1
+		}
+
+		guard let dependentIDs = dependentOperationIDs.removeValue(forKey: operation.id) else {
+			return
+		}
+		let wasCanceled = operation.isCanceled
+		for dependentID in dependentIDs {
+			guard let blocked = blockedOperations[dependentID] else {
+				continue
+			}
+			if wasCanceled {
+				cancelPending(blocked.operation)
+				continue
+			}
+			let unfinishedDependencyCount = blocked.unfinishedDependencyCount - 1
+			if unfinishedDependencyCount > 0 {
+				blockedOperations[dependentID] = (blocked.operation, unfinishedDependencyCount)
+			} else {
+				blockedOperations[dependentID] = nil
+				readyOperations[blocked.operation.priority, default: [AsyncOperation]()].append(blocked.operation)
+			}
+		}
+	}
+
+	/// Hops to the main actor only when there’s something new to show.
+	func updateProgress() {
+		var progressInfo = ProgressInfo()
+		if isTrackingProgress {
+			let numberRemaining = pendingOperationsCount + runningOperations.count
+			progressInfo = ProgressInfo(numberOfTasks: numberCompleted + numberRemaining,
+										numberCompleted: numberCompleted,
+										numberRemaining: numberRemaining)
+		}
+		guard progressInfo != lastReportedProgressInfo else {
+			return
+		}
+		lastReportedProgressInfo = progressInfo
+
+		progressSequenceNumber += 1
+		let sequenceNumber = progressSequenceNumber
+		let progress = progress
+		Task { @MainActor in
+			progress.update(progressInfo, sequenceNumber: sequenceNumber)
+		}
+	}
+}
+
+// MARK: - OperationExecutorProgress
+
+/// An `OperationExecutor`’s progress, on the main actor.
+@MainActor public final class OperationExecutorProgress: ProgressInfoReporter {
+
+	public private(set) var progressInfo = ProgressInfo() {
+		didSet {
+			if progressInfo != oldValue {
+				postProgressInfoDidChangeNotification()
+			}
+		}
+	}
+
+	private var sequenceNumber = 0
+
+	nonisolated init() {}
+
+	/// Updates can arrive out of order — the latest one wins.
+	func update(_ progressInfo: ProgressInfo, sequenceNumber: Int) {
+		guard sequenceNumber > self.sequenceNumber else {
+			return
+		}
+		self.sequenceNumber = sequenceNumber
+		self.progressInfo = progressInfo
+	}
+}
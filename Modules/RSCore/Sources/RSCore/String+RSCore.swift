@@ -49,18 +49,54 @@ public extension String {
 	/// MD5 hash of the string's UTF-8 bytes, formatted as 32 lowercase hex characters.
 	/// Defined for the empty string — MD5("") is "d41d8cd98f00b204e9800998ecf8427e".
 	var md5String: String {
-		let digest = Insecure.MD5.hash(data: Data(utf8))
-		// Build the 32-byte hex buffer directly from the 16 digest bytes — no per-byte
-		// String allocations, no printf format-string parsing.
-		var hex = [UInt8](repeating: 0, count: 32)
-		var i = 0
-		for byte in digest {
-			hex[i]     = hexDigits[Int(byte >> 4)]
-			hex[i + 1] = hexDigits[Int(byte & 0x0F)]
-			i += 2
+		var md5 = Insecure.MD5()
+		updateMD5(&md5)
+		return Self.hexString(md5.finalize())
+	}
+
+	/// The same as `"\(first) \(second)".md5String`, without building the
+	/// joined string: both strings are hashed straight from their UTF-8 bytes.
+	/// Used for article IDs, which are calculated for every incoming item.
+	static func md5String(_ first: String, spaceSeparated second: String) -> String {
+		var md5 = Insecure.MD5()
+		first.updateMD5(&md5)
+		md5.update(data: spaceBytes)
+		second.updateMD5(&md5)
+		return hexString(md5.finalize())
+	}
+}
+
+private extension String {
+
+	static let spaceBytes: [UInt8] = [UInt8(ascii: " ")]
+
+	/// Native strings hash from their own storage; bridged strings that
+	/// aren’t contiguous UTF-8 are copied first.
+	func updateMD5(_ md5: inout Insecure.MD5) {
+		let didUpdate: Void? = utf8.withContiguousStorageIfAvailable { bytes in
+			md5.update(bufferPointer: UnsafeRawBufferPointer(bytes))
+		}
+		if didUpdate == nil {
+			md5.update(data: Array(utf8))
+		}
+	}
+
+	/// Builds the 32-character string in place from the 16 digest bytes — no
+	/// per-byte String allocations, no intermediate byte array.
+	static func hexString(_ digest: Insecure.MD5.Digest) -> String {
+		String(unsafeUninitializedCapacity: Insecure.MD5.Digest.byteCount * 2) { buffer in
+			var i = 0
+			for byte in digest {
+				buffer[i]     = hexDigits[Int(byte >> 4)]
+				buffer[i + 1] = hexDigits[Int(byte & 0x0F)]
+				i += 2
+			}
+			return i
 		}
-		return String(decoding: hex, as: UTF8.self)
 	}
+}
+
+public extension String {
 
 	/// Trims leading and trailing whitespace and collapses other whitespace into a single space.
 	///
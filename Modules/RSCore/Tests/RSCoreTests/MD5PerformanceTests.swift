@@ -24,4 +24,18 @@ final class MD5PerformanceTests: XCTestCase {
 			}
 		}
 	}
+
+	/// Benchmark article ID calculation: a feed URL and a uniqueID, hashed
+	/// without joining them first.
+	func testArticleIDMD5Performance() {
+		let feedURL = "https://example.com/feed.xml"
+		let uniqueIDs = (0..<1000).map { i in
+			"https://example.com/article/\(i)1234567890"
+		}
+		self.measure {
+			for uniqueID in uniqueIDs {
+				_ = String.md5String(feedURL, spaceSeparated: uniqueID)
+			}
+		}
+	}
 }
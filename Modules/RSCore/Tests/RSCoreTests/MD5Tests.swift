@@ -5,6 +5,7 @@
 //  Created by Brent Simmons on 4/19/26.
 //
 
+import Foundation
 import Testing
 @testable import RSCore
 
@@ -32,4 +33,20 @@ import Testing
 			("0"..."9").contains(c) || ("a"..."f").contains(c)
 		})
 	}
+
+	@Test("Space-separated pair matches hashing the joined string",
+	      arguments: [
+	          ("https://example.com/feed.xml", "https://example.com/article/1"),
+	          ("", ""),
+	          ("https://example.com/föed", "日本語のガイド")
+	      ])
+	func spaceSeparatedPair(_ first: String, _ second: String) {
+		#expect(String.md5String(first, spaceSeparated: second) == "\(first) \(second)".md5String)
+	}
+
+	@Test("Bridged strings hash the same as native strings")
+	func bridgedString() {
+		let bridged = NSString(string: "café ünïcode") as String
+		#expect(bridged.md5String == "café ünïcode".md5String)
+	}
 }
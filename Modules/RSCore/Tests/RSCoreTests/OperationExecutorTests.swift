@@ -0,0 +1,187 @@
+//
+//  OperationExecutorTests.swift
+//  RSCoreTests
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import Testing
+import os
+@testable import RSCore
+
+@Suite struct OperationExecutorTests {
+
+	@Test func operationRunsOffMainThread() async {
+		let executor = OperationExecutor()
+		let ranOnMainThread = OSAllocatedUnfairLock<Bool?>(initialState: nil)
+		let operation = TestBlockOperation {
+			ranOnMainThread.withLock { $0 = Thread.isMainThread }
+		}
+
+		await executor.add(operation)
+		await operation.waitUntilFinished()
+
+		#expect(ranOnMainThread.withLock { $0 } == false)
+		#expect(await executor.pendingOperationsCount == 0)
+	}
+
+	@Test func dependencyRunsFirst() async {
+		let executor = OperationExecutor(maxConcurrentOperationCount: 4)
+		let order = OSAllocatedUnfairLock(initialState: [String]())
+		let parent = TestBlockOperation {
+			try? await Task.sleep(for: .milliseconds(20))
+			order.withLock { $0.append("parent") }
+		}
+		let child = TestBlockOperation {
+			order.withLock { $0.append("child") }
+		}
+		child.addDependency(parent)
+
+		// Added out of order, with room to run both at once.
+		await executor.add([child, parent])
+		await child.waitUntilFinished()
+
+		#expect(order.withLock { $0 } == ["parent", "child"])
+	}
+
+	@Test func cancelingParentCancelsDependents() async {
+		let executor = OperationExecutor()
+		await executor.suspend()
+
+		let didRun = OSAllocatedUnfairLock(initialState: false)
+		let completionCount = OSAllocatedUnfairLock(initialState: 0)
+		let parent = TestBlockOperation {
+			didRun.withLock { $0 = true }
+		}
+		let child = TestBlockOperation {
+			didRun.withLock { $0 = true }
+		}
+		let grandchild = TestBlockOperation {
+			didRun.withLock { $0 = true }
+		}
+		child.addDependency(parent)
+		grandchild.addDependency(child)
+		for operation in [parent, child, grandchild] {
+			operation.completionBlock = { _ in
+				completionCount.withLock { $0 += 1 }
+			}
+		}
+
+		await executor.add([parent, child, grandchild])
+		#expect(await executor.pendingOperationsCount == 3)
+
+		await executor.cancel([parent])
+		await grandchild.waitUntilFinished()
+
+		#expect(child.isCanceled)
+		#expect(grandchild.isCanceled)
+		#expect(completionCount.withLock { $0 } == 3)
+		#expect(await executor.pendingOperationsCount == 0)
+
+		await executor.resume()
+		#expect(!didRun.withLock { $0 })
+	}
+
+	@Test func cancelingRunningOperationCancelsItsTask() async {
+		let executor = OperationExecutor()
+		let sawTaskCancellation = OSAllocatedUnfairLock(initialState: false)
+		let operation = TestBlockOperation {
+			while !Task.isCancelled {
+				try? await Task.sleep(for: .milliseconds(1))
+			}
+			sawTaskCancellation.withLock { $0 = true }
+		}
+
+		await executor.add(operation)
+		try? await Task.sleep(for: .milliseconds(10))
+		operation.cancel()
+		await operation.waitUntilFinished()
+
+		#expect(operation.isCanceled)
+		#expect(sawTaskCancellation.withLock { $0 })
+	}
+
+	@Test func higherPriorityRunsFirst() async {
+		let executor = OperationExecutor()
+		await executor.suspend()
+
+		let order = OSAllocatedUnfairLock(initialState: [AsyncOperation.Priority]())
+		let operations = [AsyncOperation.Priority.utility, .normal, .userInitiated, .normal].map { priority in
+			TestBlockOperation(priority: priority) {
+				order.withLock { $0.append(priority) }
+			}
+		}
+		await executor.add(operations)
+		await executor.resume()
+		for operation in operations {
+			await operation.waitUntilFinished()
+		}
+
+		#expect(order.withLock { $0 } == [.userInitiated, .normal, .normal, .utility])
+	}
+
+	@Test func concurrencyWidthIsRespected() async {
+		let width = 3
+		let executor = OperationExecutor(maxConcurrentOperationCount: width)
+		let counts = OSAllocatedUnfairLock(initialState: (running: 0, maximum: 0))
+		let operations = (0..<12).map { _ in
+			TestBlockOperation {
+				counts.withLock { counts in
+					counts.running += 1
+					counts.maximum = max(counts.maximum, counts.running)
+				}
+				try? await Task.sleep(for: .milliseconds(10))
+				counts.withLock { $0.running -= 1 }
+			}
+		}
+
+		await executor.add(operations)
+		for operation in operations {
+			await operation.waitUntilFinished()
+		}
+
+		#expect(counts.withLock { $0.maximum } == width)
+	}
+
+	@MainActor @Test func progressIsReportedOnMainActor() async {
+		let executor = OperationExecutor()
+		await executor.suspend()
+		await executor.setIsTrackingProgress(true)
+
+		let operations = (0..<4).map { _ in TestBlockOperation {} }
+		await executor.add(operations)
+		try? await Task.sleep(for: .milliseconds(50))
+		#expect(executor.progress.progressInfo.numberRemaining == 4)
+
+		await executor.resume()
+		for operation in operations {
+			await operation.waitUntilFinished()
+		}
+		// Let the last update reach the main actor.
+		try? await Task.sleep(for: .milliseconds(50))
+
+		#expect(executor.progress.progressInfo == ProgressInfo(numberOfTasks: 4, numberCompleted: 4, numberRemaining: 0))
+	}
+}
+
+private final class TestBlockOperation: AsyncOperation, @unchecked Sendable {
+
+	private let block: @Sendable () async -> Void
+
+	init(priority: Priority = .normal, block: @escaping @Sendable () async -> Void) {
+		self.block = block
+		super.init(priority: priority)
+	}
+
+	override func run() async {
+		await block()
+	}
+}
+
+private extension OperationExecutor {
+
+	func setIsTrackingProgress(_ isTrackingProgress: Bool) {
+		self.isTrackingProgress = isTrackingProgress
+	}
+}
@@ -0,0 +1,31 @@
+//
+//  DatabaseCancellationToken.swift
+//  RSDatabase
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import os
+
+/// Cancels work given to `DatabaseQueue.runInDatabase(cancellationToken:_:ifCanceled:)`.
+///
+/// Work still waiting in the queue is skipped. Work already running is
+/// interrupted: SQLite checks the token as it steps through a statement,
+/// and fails that statement — and any later ones in the same block —
+/// with `SQLITE_INTERRUPT`.
+public final class DatabaseCancellationToken: Sendable {
+
+	private let canceled = OSAllocatedUnfairLock(initialState: false)
+
+	public init() {
+	}
+
+	public var isCanceled: Bool {
+		canceled.withLock { $0 }
+	}
+
+	public func cancel() {
+		canceled.withLock { $0 = true }
+	}
+}
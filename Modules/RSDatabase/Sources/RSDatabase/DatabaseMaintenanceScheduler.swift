@@ -0,0 +1,226 @@
+//
+//  DatabaseMaintenanceScheduler.swift
+//  RSDatabase
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import os
+import RSDatabaseObjC
+
+/// A cleanup job that deletes rows from one table, in `keyColumn` order,
+/// where `whereClause` matches.
+///
+/// Table name, key column, and where clause are assumed to be trusted;
+/// parameters are not.
+public struct DatabaseMaintenanceJob: Sendable {
+
+	public static let rowIDColumn = "rowid"
+
+	/// Unique per database — used as the key for the persisted resume point.
+	public let name: String
+	public let tableName: String
+	public let whereClause: String
+	public let parameters: [any Sendable]
+	/// The unique, indexed column that rows are deleted in order of: `rowid`,
+	/// or — for a WITHOUT ROWID table — its primary key.
+	public let keyColumn: String
+
+	public init(name: String, tableName: String, whereClause: String, parameters: [any Sendable] = [], keyColumn: String = DatabaseMaintenanceJob.rowIDColumn) {
+		self.name = name
+		self.tableName = tableName
+		self.whereClause = whereClause
+		self.parameters = parameters
+		self.keyColumn = keyColumn
+	}
+}
+
+/// What a job did during one `DatabaseMaintenanceScheduler.run` call.
+public struct DatabaseMaintenanceReport: Sendable {
+	public let jobName: String
+	public let rowsDeleted: Int
+	public let slices: Int
+	public let elapsed: TimeInterval
+	/// False when the run stopped early (task cancelled, or a query failed).
+	/// The job resumes where it left off next time.
+	public let didFinish: Bool
+	/// True when a query failed. The failure is logged, and the resume point
+	/// is kept, so the job is retried from there next time.
+	public let didFail: Bool
+
+	public var rowsPerSecond: Double {
+		elapsed > 0 ? Double(rowsDeleted) / elapsed : 0
+	}
+}
+
+/// Runs maintenance jobs incrementally, so that cleaning up a large database
+/// doesn’t hold the database queue for seconds at a time.
+///
+/// Each job is run as a series of slices. A slice is one transaction on the
+/// queue: it deletes batches of rows, in key order, until it runs out of
+/// rows or its time budget is used up. Between slices the scheduler sleeps,
+/// which lets fetches and updates waiting on the queue run.
+///
+/// Slices run at `.maintenance` priority, so other work on the queue goes
+/// first. A slice also ends early, between batches, as soon as more urgent
+/// work is waiting for it.
+///
+/// The last key handled is saved (in `RSDatabaseInfoTable`) in the same
+/// transaction as the deletes, so a job interrupted by quitting the app
+/// resumes from there at next launch. When a job reaches the end of its
+/// table the resume point is cleared, and the next run starts over.
+/// (Rows behind the resume point that newly match — or whose rowids changed
+/// during a vacuum — are picked up by that next pass.)
+public struct DatabaseMaintenanceScheduler: Sendable {
+
+	let queue: DatabaseQueue
+	let sliceTimeBudget: TimeInterval
+	let pauseBetweenSlices: Duration
+	let batchSize: Int
+
+	private static let logger = Logger(subsystem: logSubsystem, category: "DatabaseMaintenanceScheduler")
+
+	public init(queue: DatabaseQueue, sliceTimeBudget: TimeInterval = 0.05, pauseBetweenSlices: Duration = .milliseconds(50), batchSize: Int = 200) {
+		precondition(batchSize > 0)
+		self.queue = queue
+		self.sliceTimeBudget = sliceTimeBudget
+		self.pauseBetweenSlices = pauseBetweenSlices
+		self.batchSize = batchSize
+	}
+
+	/// Run jobs one after another, in order.
+	@discardableResult
+	public func run(_ jobs: [DatabaseMaintenanceJob]) async -> [DatabaseMaintenanceReport] {
+		var reports = [DatabaseMaintenanceReport]()
+		for job in jobs {
+			let report = await run(job)
+			reports.append(report)
+			if !report.didFinish {
+				break
+			}
+		}
+		return reports
+	}
+
+	@discardableResult
+	public func run(_ job: DatabaseMaintenanceJob) async -> DatabaseMaintenanceReport {
+		let startTime = Date()
+		var rowsDeleted = 0
+		var slices = 0
+		var didFinish = false
+		var didFail = false
+
+		while !Task.isCancelled {
+			let result = await runSlice(job)
+			rowsDeleted += result.rowsDeleted
+			slices += 1
+			if result.didFail {
+				didFail = true
+				break
+			}
+			if result.isComplete {
+				didFinish = true
+				break
+			}
+			try? await Task.sleep(for: pauseBetweenSlices)
+		}
+
+		let report = DatabaseMaintenanceReport(jobName: job.name, rowsDeleted: rowsDeleted, slices: slices, elapsed: Date().timeIntervalSince(startTime), didFinish: didFinish, didFail: didFail)
+		if report.rowsDeleted > 0 || !report.didFinish {
+			Self.logger.info("DatabaseMaintenanceScheduler: \(job.name, privacy: .public) deleted \(report.rowsDeleted, privacy: .public) rows in \(report.slices, privacy: .public) slices — \(report.elapsed, format: .fixed(precision: 3), privacy: .public) seconds, \(report.rowsPerSecond, format: .fixed(precision: 0), privacy: .public) rows/second, finished: \(report.didFinish, privacy: .public), failed: \(report.didFail, privacy: .public)")
+		}
+		return report
+	}
+}
+
+private extension DatabaseMaintenanceScheduler {
+
+	struct SliceResult: Sendable {
+		let rowsDeleted: Int
+		let isComplete: Bool
+		var didFail = false
+	}
+
+	func runSlice(_ job: DatabaseMaintenanceJob) async -> SliceResult {
+		await withCheckedContinuation { continuation in
+			queue.runInTransaction(priority: .maintenance) { database in
+				continuation.resume(returning: self.runSlice(job, database))
+			}
+		}
+	}
+
+	func runSlice(_ job: DatabaseMaintenanceJob, _ database: FMDatabase) -> SliceResult {
+		RSDatabaseInfoTable.createTableIfNeeded(database: database)
+
+		let resumeKey = Self.resumeKey(job)
+		var lastKey = RSDatabaseInfoTable.value(forKey: resumeKey, database: database)
+		var rowsDeleted = 0
+		let startTime = Date()
+
+		while true {
+			// A failed query is not the end of the table: keep the resume point,
+			// so that the job picks up from there when it’s next run.
+			guard let keys = nextBatchOfKeys(job, after: lastKey, database) else {
+				return failedSlice(job, rowsDeleted, lastKey, database)
+			}
+			if !keys.isEmpty {
+				guard deleteRows(keys, job, database) else {
+					return failedSlice(job, rowsDeleted, lastKey, database)
+				}
+				rowsDeleted += keys.count
+				lastKey = keys.last!
+			}
+
+			if keys.count < batchSize {
+				RSDatabaseInfoTable.removeValue(forKey: resumeKey, database: database)
+				return SliceResult(rowsDeleted: rowsDeleted, isComplete: true)
+			}
+			if Date().timeIntervalSince(startTime) > sliceTimeBudget || queue.hasWaitingWork(moreUrgentThan: .maintenance) {
+				RSDatabaseInfoTable.setValue(lastKey!, forKey: resumeKey, database: database)
+				return SliceResult(rowsDeleted: rowsDeleted, isComplete: false)
+			}
+		}
+	}
+
+	func failedSlice(_ job: DatabaseMaintenanceJob, _ rowsDeleted: Int, _ lastKey: Any?, _ database: FMDatabase) -> SliceResult {
+		Self.logger.error("DatabaseMaintenanceScheduler: \(job.name, privacy: .public) failed — \(database.lastErrorMessage(), privacy: .public)")
+		if rowsDeleted > 0, let lastKey {
+			RSDatabaseInfoTable.setValue(lastKey, forKey: Self.resumeKey(job), database: database)
+		}
+		return SliceResult(rowsDeleted: rowsDeleted, isComplete: false, didFail: true)
+	}
+
+	/// The next batch of matching rows’ `keyColumn` values, in order.
+	/// Nil if the query failed.
+	func nextBatchOfKeys(_ job: DatabaseMaintenanceJob, after lastKey: Any?, _ database: FMDatabase) -> [Any]? {
+		var parameters = [Any]()
+		var sql = "select \(job.keyColumn) from \(job.tableName) where "
+		if let lastKey {
+			sql += "\(job.keyColumn) > ? and "
+			parameters.append(lastKey)
+		}
+		sql += "(\(job.whereClause)) order by \(job.keyColumn) limit ?;"
+		parameters += job.parameters.map { $0 as Any }
+		parameters.append(batchSize)
+
+		guard let resultSet = database.executeQuery(sql, withArgumentsIn: parameters) else {
+			return nil
+		}
+		return resultSet.compactMap { $0.object(forColumnIndex: 0) }
+	}
+
+	func deleteRows(_ keys: [Any], _ job: DatabaseMaintenanceJob, _ database: FMDatabase) -> Bool {
+		guard let placeholders = NSString.rs_SQLValueList(withPlaceholders: UInt(keys.count)) else {
+			return false
+		}
+		return database.executeUpdate("delete from \(job.tableName) where \(job.keyColumn) in \(placeholders);", withArgumentsIn: keys)
+	}
+
+	static func resumeKey(_ job: DatabaseMaintenanceJob) -> String {
+		if job.keyColumn == DatabaseMaintenanceJob.rowIDColumn {
+			return "maintenance.\(job.name).lastRowID"
+		}
+		return "maintenance.\(job.name).lastKey"
+	}
+}
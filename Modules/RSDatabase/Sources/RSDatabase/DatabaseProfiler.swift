@@ -0,0 +1,437 @@
+//
+//  DatabaseProfiler.swift
+//  RSDatabase
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import os
+import SQLite3
+import RSDatabaseObjC
+
+/// Per-database query profile: counters per statement fingerprint, time
+/// spent waiting on and running in the `DatabaseQueue`, and the recent
+/// slow statements — optionally with their query plans.
+///
+/// Off by default, and free when off: the SQLite trace hook is only
+/// installed while profiling is on. Turn it on for every database with
+/// `DatabaseQueue.setProfilingEnabled(_:)`.
+public final class DatabaseProfiler: Sendable {
+
+	public let databaseName: String
+
+	private let state = OSAllocatedUnfairLock(initialState: State())
+
+	private static let logger = Logger(subsystem: logSubsystem, category: "DatabaseProfiler")
+	private static let maximumSlowStatements = 100
+	private static let maximumCachedFingerprints = 1000
+
+	init(databaseName: String) {
+		self.databaseName = databaseName
+	}
+
+	public func report() -> DatabaseProfile {
+		state.withLock { state in
+			let statements = state.statementStats.map { fingerprint, stats in
+				DatabaseProfile.Statement(fingerprint: fingerprint, calls: stats.calls, rows: stats.rows, totalMilliseconds: stats.latency.totalMilliseconds, p99Milliseconds: stats.latency.percentileMilliseconds(0.99), maximumMilliseconds: stats.latency.maximumMilliseconds)
+			}.sorted { $0.totalMilliseconds > $1.totalMilliseconds }
+			let queue = DatabaseProfile.Queue(calls: state.queueWait.count, totalWaitMilliseconds: state.queueWait.totalMilliseconds, p99WaitMilliseconds: state.queueWait.percentileMilliseconds(0.99), maximumWaitMilliseconds: state.queueWait.maximumMilliseconds, totalRunMilliseconds: state.queueRun.totalMilliseconds, p99RunMilliseconds: state.queueRun.percentileMilliseconds(0.99), maximumRunMilliseconds: state.queueRun.maximumMilliseconds)
+			return DatabaseProfile(databaseName: databaseName, startDate: state.startDate, statements: statements, queue: queue, slowStatements: state.slowStatements)
+		}
+	}
+
+	public func reset() {
+		state.withLock { state in
+			state = State()
+		}
+	}
+}
+
+// MARK: - Profile
+
+/// A snapshot of a `DatabaseProfiler`, ready to encode as JSON.
+public struct DatabaseProfile: Codable, Sendable {
+
+	public struct Statement: Codable, Sendable {
+		public let fingerprint: String
+		public let calls: Int
+		public let rows: Int
+		public let totalMilliseconds: Double
+		public let p99Milliseconds: Double
+		public let maximumMilliseconds: Double
+	}
+
+	public struct Queue: Codable, Sendable {
+		public let calls: Int
+		public let totalWaitMilliseconds: Double
+		public let p99WaitMilliseconds: Double
+		public let maximumWaitMilliseconds: Double
+		public let totalRunMilliseconds: Double
+		public let p99RunMilliseconds: Double
+		public let maximumRunMilliseconds: Double
+	}
+
+	public struct SlowStatement: Codable, Sendable {
+		public let databaseName: String
+		public let fingerprint: String
+		public let sql: String
+		public let milliseconds: Double
+		public let rows: Int
+		public let date: Date
+		public internal(set) var queryPlan: [String]?
+	}
+
+	public let databaseName: String
+	public let startDate: Date
+	/// Sorted by total time, most first.
+	public let statements: [Statement]
+	public let queue: Queue
+	/// Oldest first.
+	public let slowStatements: [SlowStatement]
+
+	public static func jsonData(_ profiles: [DatabaseProfile]) throws -> Data {
+		let encoder = JSONEncoder()
+		encoder.outputFormatting = [.prettyPrinted, .sortedKeys]
+		encoder.dateEncodingStrategy = .iso8601
+		return try encoder.encode(profiles)
+	}
+}
+
+// MARK: - Recording
+
+extension DatabaseProfiler {
+
+	struct Options: Sendable {
+		var slowStatementThresholdMilliseconds: Double = 50
+		var capturesQueryPlans = false
+	}
+
+	typealias SlowStatementHandler = @Sendable (DatabaseProfile.SlowStatement) -> Void
+
+	/// Installs or removes the trace hook. Call on the database queue.
+	func setTracing(_ enabled: Bool, database: FMDatabase) {
+		guard let handle = database.sqlite3Handle else {
+			return
+		}
+		if enabled {
+			let mask = UInt32(SQLITE_TRACE_PROFILE | SQLITE_TRACE_ROW)
+			sqlite3_trace_v2(handle, mask, databaseProfilerTrace, Unmanaged.passUnretained(self).toOpaque())
+		} else {
+			sqlite3_trace_v2(handle, 0, nil, nil)
+			state.withLock { state in
+				state.rowCounts.removeAll()
+			}
+		}
+	}
+
+	func recordQueueCall(waitNanoseconds: UInt64, runNanoseconds: UInt64) {
+		state.withLock { state in
+			state.queueWait.record(nanoseconds: waitNanoseconds)
+			state.queueRun.record(nanoseconds: runNanoseconds)
+		}
+	}
+
+	/// Called after each database block, on the database queue, when no
+	/// statement is running: the safe time to run `EXPLAIN QUERY PLAN`.
+	func databaseBlockDidFinish(_ database: FMDatabase, options: Options, handler: SlowStatementHandler?) {
+		var pendingSlowStatements = state.withLock { state in
+			let pendingSlowStatements = state.pendingSlowStatements
+			state.pendingSlowStatements.removeAll()
+			return pendingSlowStatements
+		}
+		guard !pendingSlowStatements.isEmpty else {
+			return
+		}
+
+		if options.capturesQueryPlans, let handle = database.sqlite3Handle {
+			state.withLock { $0.isCapturingQueryPlans = true }
+			for index in pendingSlowStatements.indices {
+				pendingSlowStatements[index].queryPlan = Self.queryPlan(pendingSlowStatements[index].sql, handle)
+			}
+			state.withLock { $0.isCapturingQueryPlans = false }
+		}
+
+		state.withLock { state in
+			state.slowStatements.append(contentsOf: pendingSlowStatements)
+			if state.slowStatements.count > Self.maximumSlowStatements {
+				state.slowStatements.removeFirst(state.slowStatements.count - Self.maximumSlowStatements)
+			}
+		}
+
+		for slowStatement in pendingSlowStatements {
+			Self.logger.info("DatabaseProfiler: \(slowStatement.databaseName, privacy: .public) slow statement — \(slowStatement.milliseconds, format: .fixed(precision: 1), privacy: .public) ms: \(slowStatement.fingerprint, privacy: .public)")
+			handler?(slowStatement)
+		}
+	}
+
+	/// A statement’s SQL with literals and parameter lists normalized, so
+	/// ad-hoc variants of the same query are counted together. `in (?, ?, ?)`
+	/// becomes `in (?…)`; string and number literals become `?`.
+	static func fingerprint(_ sql: String) -> String {
+		var result = [UInt8]()
+		result.reserveCapacity(sql.utf8.count)
+		let bytes = Array(sql.utf8)
+		var i = 0
+
+		func appendPlaceholder() {
+			// Collapse `?, ?, ?` into `?…`
+			var j = result.count
+			var sawComma = false
+			while j > 0 && (result[j - 1] == .space || result[j - 1] == .comma) {
+				sawComma = sawComma || result[j - 1] == .comma
+				j -= 1
+			}
+			if sawComma {
+				if j > 0 && result[j - 1] == .questionMark {
+					result.removeSubrange((j - 1)...)
+					result.append(contentsOf: Self.collapsedPlaceholders)
+					return
+				}
+				if result[..<j].suffix(Self.collapsedPlaceholders.count).elementsEqual(Self.collapsedPlaceholders) {
+					result.removeSubrange(j...)
+					return
+				}
+			}
+			result.append(.questionMark)
+		}
+
+		while i < bytes.count {
+			let byte = bytes[i]
+			if byte == .singleQuote {
+				// String literal, with '' as an escaped quote.
+				i += 1
+				while i < bytes.count {
+					if bytes[i] == .singleQuote {
+						if i + 1 < bytes.count && bytes[i + 1] == .singleQuote {
+							i += 2
+							continue
+						}
+						break
+					}
+					i += 1
+				}
+				i += 1
+				appendPlaceholder()
+				continue
+			}
+			if byte.isDigit && (result.last.map { !$0.isIdentifierCharacter } ?? true) {
+				while i < bytes.count && (bytes[i].isDigit || bytes[i] == .period) {
+					i += 1
+				}
+				appendPlaceholder()
+				continue
+			}
+			if byte == .questionMark {
+				i += 1
+				appendPlaceholder()
+				continue
+			}
+			if byte.isWhitespace {
+				if let last = result.last, last != .space {
+					result.append(.space)
+				}
+				i += 1
+				continue
+			}
+			result.append(byte)
+			i += 1
+		}
+
+		while result.last == .space {
+			result.removeLast()
+		}
+		return String(decoding: result, as: UTF8.self)
+	}
+}
+
+private extension DatabaseProfiler {
+
+	struct StatementStats {
+		var calls = 0
+		var rows = 0
+		var latency = LatencyHistogram()
+	}
+
+	struct State: @unchecked Sendable { // OpaquePointer keys
+		let startDate = Date()
+		var statementStats = [String: StatementStats]()
+		var fingerprintsBySQL = [String: String]()
+		var rowCounts = [OpaquePointer: Int]()
+		var queueWait = LatencyHistogram()
+		var queueRun = LatencyHistogram()
+		var slowStatements = [DatabaseProfile.SlowStatement]()
+		var pendingSlowStatements = [DatabaseProfile.SlowStatement]()
+		var isCapturingQueryPlans = false
+	}
+
+	static let collapsedPlaceholders: [UInt8] = Array("?…".utf8)
+
+	func statementDidReturnRow(_ statement: OpaquePointer) {
+		state.withLock { state in
+			guard !state.isCapturingQueryPlans else {
+				return
+			}
+			state.rowCounts[statement, default: 0] += 1
+		}
+	}
+
+	func statementDidFinish(_ statement: OpaquePointer, nanoseconds: Int64) {
+		guard let cSQL = sqlite3_sql(statement) else {
+			return
+		}
+		let sql = String(cString: cSQL)
+		let options = DatabaseQueue.profilingOptions
+
+		state.withLock { state in
+			guard !state.isCapturingQueryPlans else {
+				return
+			}
+			let rows = state.rowCounts.removeValue(forKey: statement) ?? 0
+
+			let fingerprint: String
+			if let cachedFingerprint = state.fingerprintsBySQL[sql] {
+				fingerprint = cachedFingerprint
+			} else {
+				fingerprint = Self.fingerprint(sql)
+				if state.fingerprintsBySQL.count >= Self.maximumCachedFingerprints {
+					state.fingerprintsBySQL.removeAll(keepingCapacity: true)
+				}
+				state.fingerprintsBySQL[sql] = fingerprint
+			}
+
+			let nanoseconds = UInt64(max(nanoseconds, 0))
+			state.statementStats[fingerprint, default: StatementStats()].calls += 1
+			state.statementStats[fingerprint]!.rows += rows
+			state.statementStats[fingerprint]!.latency.record(nanoseconds: nanoseconds)
+
+			let milliseconds = Double(nanoseconds) / 1_000_000
+			if milliseconds >= options.slowStatementThresholdMilliseconds {
+				let slowStatement = DatabaseProfile.SlowStatement(databaseName: databaseName, fingerprint: fingerprint, sql: sql, milliseconds: milliseconds, rows: rows, date: Date(), queryPlan: nil)
+				state.pendingSlowStatements.append(slowStatement)
+			}
+		}
+	}
+
+	/// `EXPLAIN QUERY PLAN` for `sql`, with its parameters unbound. One line
+	/// per plan row, indented by depth.
+	static func queryPlan(_ sql: String, _ handle: OpaquePointer) -> [String]? {
+		var statement: OpaquePointer?
+		guard sqlite3_prepare_v2(handle, "EXPLAIN QUERY PLAN \(sql)", -1, &statement, nil) == SQLITE_OK, let statement else {
+			return nil
+		}
+		defer {
+			sqlite3_finalize(statement)
+		}
+
+		var lines = [String]()
+		var depthByID = [Int32: Int]()
+		while sqlite3_step(statement) == SQLITE_ROW {
+			let id = sqlite3_column_int(statement, 0)
+			let parent = sqlite3_column_int(statement, 1)
+			let depth = (depthByID[parent] ?? -1) + 1
+			depthByID[id] = depth
+			guard let detail = sqlite3_column_text(statement, 3) else {
+				continue
+			}
+			lines.append(String(repeating: "  ", count: depth) + String(cString: detail))
+		}
+		return lines
+	}
+}
+
+/// The `sqlite3_trace_v2` callback. `context` is the profiler; for a row
+/// event `p` is the statement; for a profile event `p` is the statement
+/// and `x` points to its run time in nanoseconds.
+private func databaseProfilerTrace(_ event: UInt32, _ context: UnsafeMutableRawPointer?, _ p: UnsafeMutableRawPointer?, _ x: UnsafeMutableRawPointer?) -> Int32 {
+	guard let context, let p else {
+		return 0
+	}
+	let profiler = Unmanaged<DatabaseProfiler>.fromOpaque(context).takeUnretainedValue()
+	let statement = OpaquePointer(p)
+	if event == UInt32(SQLITE_TRACE_ROW) {
+		profiler.statementDidReturnRow(statement)
+	} else if event == UInt32(SQLITE_TRACE_PROFILE), let x {
+		profiler.statementDidFinish(statement, nanoseconds: x.load(as: Int64.self))
+	}
+	return 0
+}
+
+// MARK: - LatencyHistogram
+
+/// Total, maximum, and counts in power-of-two microsecond buckets — enough
+/// for a p99 within a factor of two, in constant space.
+///
+/// Public so that other timings — refresh stages, for instance — can be
+/// summarized the same way as database time.
+public struct LatencyHistogram: Sendable {
+
+	public private(set) var count = 0
+	private var totalNanoseconds: UInt64 = 0
+	private var maximumNanoseconds: UInt64 = 0
+	private var buckets = [Int](repeating: 0, count: 40)
+
+	public init() {}
+
+	public var totalMilliseconds: Double {
+		Double(totalNanoseconds) / 1_000_000
+	}
+
+	public var maximumMilliseconds: Double {
+		Double(maximumNanoseconds) / 1_000_000
+	}
+
+	public mutating func record(nanoseconds: UInt64) {
+		count += 1
+		totalNanoseconds += nanoseconds
+		maximumNanoseconds = max(maximumNanoseconds, nanoseconds)
+		buckets[Self.bucket(nanoseconds)] += 1
+	}
+
+	/// The upper bound of the bucket holding the `percentile` sample,
+	/// capped at the maximum.
+	public func percentileMilliseconds(_ percentile: Double) -> Double {
+		guard count > 0 else {
+			return 0
+		}
+		let target = Int((Double(count) * percentile).rounded(.up))
+		var seen = 0
+		for (bucket, bucketCount) in buckets.enumerated() {
+			seen += bucketCount
+			if seen >= target {
+				let upperBoundMicroseconds = Double(UInt64(1) << UInt64(bucket))
+				return min(upperBoundMicroseconds / 1000, maximumMilliseconds)
+			}
+		}
+		return maximumMilliseconds
+	}
+
+	private static func bucket(_ nanoseconds: UInt64) -> Int {
+		let microseconds = nanoseconds / 1000
+		guard microseconds > 0 else {
+			return 0
+		}
+		return min(64 - microseconds.leadingZeroBitCount, 39)
+	}
+}
+
+private extension UInt8 {
+
+	static let space = UInt8(ascii: " ")
+	static let comma = UInt8(ascii: ",")
+	static let period = UInt8(ascii: ".")
+	static let questionMark = UInt8(ascii: "?")
+	static let singleQuote = UInt8(ascii: "'")
+
+	var isDigit: Bool {
+		self >= UInt8(ascii: "0") && self <= UInt8(ascii: "9")
+	}
+
+	var isWhitespace: Bool {
+		self == .space || self == UInt8(ascii: "\t") || self == UInt8(ascii: "\n") || self == UInt8(ascii: "\r")
+	}
+
+	var isIdentifierCharacter: Bool {
+		isDigit || self == UInt8(ascii: "_") || (self | 0x20 >= UInt8(ascii: "a") && self | 0x20 <= UInt8(ascii: "z"))
+	}
+}
@@ -12,6 +12,14 @@ import SQLite3
 import RSDatabaseObjC
 
 /// Manage a serial queue and a SQLite database.
+///
+/// Blocks run one at a time, most urgent first — see `Priority`. Waiting
+/// blocks are kept by the `DatabaseScheduler`, and the serial dispatch
+/// queue runs them: it holds at most one pump block, which runs the most
+/// urgent waiting block and then dispatches the next pump. A synchronous
+/// call goes on the dispatch queue itself, so it waits for the running
+/// block and then for the waiting work that’s ahead of it — not for
+/// everything added before it.
 public final class DatabaseQueue: Sendable {
 	private struct State: @unchecked Sendable {
 		var isCallingDatabase = false
@@ -25,6 +33,11 @@ public final class DatabaseQueue: Sendable {
 	private let state: OSAllocatedUnfairLock<State>
 	private let databasePath: String
 	private let serialDispatchQueue: DispatchQueue
+	private let scheduler = OSAllocatedUnfairLock(initialState: DatabaseScheduler())
+
+	/// Query counters, queue wait and run times, and slow statements —
+	/// recorded only while profiling is on.
+	public let profiler: DatabaseProfiler
 
 	private static let logger = Logger(subsystem: logSubsystem, category: "DatabaseQueue")
 
@@ -36,29 +49,61 @@ public final class DatabaseQueue: Sendable {
 		self.databasePath = databasePath
 		let database = FMDatabase(path: databasePath)!
 		self.state = OSAllocatedUnfairLock(initialState: State(database))
+		self.profiler = DatabaseProfiler(databaseName: Self.profileName(databasePath))
 
 		self.state.withLock { openDatabase($0.database) }
+
+		let isProfilingEnabled = Self.profiling.withLock { profiling in
+			profiling.queues.removeAll { $0.queue == nil }
+			profiling.queues.append(WeakDatabaseQueue(queue: self))
+			return profiling.isEnabled
+		}
+		if isProfilingEnabled {
+			setTracing(true)
+		}
 	}
 
 	// MARK: - Make Database Calls
 
 	/// Run a DatabaseBlock synchronously. This call will block the main thread
 	/// potentially for a while, depending on how long it takes to execute
-	/// the DatabaseBlock *and* depending on how many other calls have been
-	/// scheduled on the queue. Use sparingly — prefer async versions.
-	public func runInDatabaseSync(_ databaseBlock: DatabaseBlock) {
-		serialDispatchQueue.sync {
+	/// the DatabaseBlock *and* depending on how much work at `priority` or
+	/// higher is waiting ahead of it. Use sparingly — prefer async versions.
+	///
+	/// The waiting work ahead of it runs right here, on the calling thread —
+	/// which may be the main thread. That’s the earlier work at `priority` or
+	/// above, plus any lower-priority work that has waited long enough to be
+	/// promoted past it. So a sync call from the main thread can end up
+	/// running a refresh save or a maintenance slice there.
+	public func runInDatabaseSync(priority: Priority = .userInitiated, _ databaseBlock: DatabaseBlock) {
+		runSync(priority, databaseBlock, false)
+	}
+
+	/// Run a DatabaseBlock asynchronously.
+	public func runInDatabase(priority: Priority = .userInitiated, _ databaseBlock: @escaping DatabaseBlock) {
+		let enqueueTime = DispatchTime.now().uptimeNanoseconds
+		runAsync(priority, enqueueTime) {
 			self.state.withLock { state in
-				self._runInDatabase(&state, databaseBlock, false)
+				self._runInDatabase(&state, databaseBlock, false, enqueueTime)
 			}
 		}
 	}
 
-	/// Run a DatabaseBlock asynchronously.
-	public func runInDatabase(_ databaseBlock: @escaping DatabaseBlock) {
-		serialDispatchQueue.async {
+	/// Run a DatabaseBlock asynchronously, unless `cancellationToken` is canceled first.
+	///
+	/// A block still waiting in the queue when the token is canceled is dropped,
+	/// and `ifCanceled` is called instead. A block that’s already running is
+	/// interrupted: its statements fail with `SQLITE_INTERRUPT`, so its queries
+	/// come back empty and it finishes early. Use this only for reads.
+	public func runInDatabase(priority: Priority = .userInitiated, cancellationToken: DatabaseCancellationToken, _ databaseBlock: @escaping DatabaseBlock, ifCanceled: @escaping @Sendable () -> Void) {
+		let enqueueTime = DispatchTime.now().uptimeNanoseconds
+		runAsync(priority, enqueueTime) {
+			if cancellationToken.isCanceled {
+				ifCanceled()
+				return
+			}
 			self.state.withLock { state in
-				self._runInDatabase(&state, databaseBlock, false)
+				self._runInDatabase(&state, databaseBlock, false, enqueueTime, cancellationToken)
 			}
 		}
 	}
@@ -66,25 +111,40 @@ public final class DatabaseQueue: Sendable {
 	/// Run a DatabaseBlock wrapped in a transaction synchronously.
 	/// Transactions help performance significantly when updating the database.
 	/// Nevertheless, it’s best to avoid this because it will block the main thread —
-	/// prefer the async `runInTransaction` instead.
-	public func runInTransactionSync(_ databaseBlock: @escaping DatabaseBlock) {
-		serialDispatchQueue.sync {
-			self.state.withLock { state in
-				self._runInDatabase(&state, databaseBlock, true)
-			}
-		}
+	/// prefer the async `runInTransaction` instead. Like `runInDatabaseSync`,
+	/// it runs the waiting work ahead of it on the calling thread.
+	public func runInTransactionSync(priority: Priority = .userInitiated, _ databaseBlock: @escaping DatabaseBlock) {
+		runSync(priority, databaseBlock, true)
 	}
 
 	/// Run a DatabaseBlock wrapped in a transaction asynchronously.
 	/// Transactions help performance significantly when updating the database.
-	public func runInTransaction(_ databaseBlock: @escaping DatabaseBlock) {
-		serialDispatchQueue.async {
+	public func runInTransaction(priority: Priority = .userInitiated, _ databaseBlock: @escaping DatabaseBlock) {
+		let enqueueTime = DispatchTime.now().uptimeNanoseconds
+		runAsync(priority, enqueueTime) {
 			self.state.withLock { state in
-				self._runInDatabase(&state, databaseBlock, true)
+				self._runInDatabase(&state, databaseBlock, true, enqueueTime)
 			}
 		}
 	}
 
+	// MARK: - Scheduling
+
+	/// True when work more urgent than `priority` is waiting — including
+	/// synchronous calls blocked on the queue.
+	///
+	/// Long-running blocks at low priority can check this at safe points —
+	/// between batches, say — and stop early, to continue in a later block.
+	public func hasWaitingWork(moreUrgentThan priority: Priority) -> Bool {
+		scheduler.withLock { $0.hasWaitingWork(moreUrgentThan: priority) }
+	}
+
+	/// How long blocks waited to run, by lane, since the queue was created.
+	/// Always recorded — unlike the rest of the `profiler` numbers.
+	public func laneWaitTimes() -> [Priority: DatabaseLaneWaitTimes] {
+		scheduler.withLock { $0.laneWaitTimes }
+	}
+
 	/// Run all the lines that start with "create".
 	/// Use this to create tables, indexes, etc.
 	public func runCreateStatements(_ statements: String) {
@@ -106,7 +166,7 @@ public final class DatabaseQueue: Sendable {
 	/// since the last vacuum() call.
 	public func vacuum() async {
 		await withCheckedContinuation { continuation in
-			runInDatabase { database in
+			runInDatabase(priority: .maintenance) { database in
 				database.vacuum()
 				continuation.resume()
 			}
@@ -114,16 +174,119 @@ public final class DatabaseQueue: Sendable {
 	}
 }
 
+// MARK: - Profiling
+
+public extension DatabaseQueue {
+
+	/// Turns query profiling on or off for every database, including ones
+	/// opened later. Statements that take at least
+	/// `slowStatementThresholdMilliseconds` are logged, passed to
+	/// `slowStatementHandler`, and — with `capturesQueryPlans` — recorded
+	/// with their `EXPLAIN QUERY PLAN` output.
+	static func setProfilingEnabled(_ enabled: Bool, slowStatementThresholdMilliseconds: Double = 50, capturesQueryPlans: Bool = false, slowStatementHandler: (@Sendable (DatabaseProfile.SlowStatement) -> Void)? = nil) {
+		let queues = profiling.withLock { profiling in
+			profiling.isEnabled = enabled
+			profiling.options = DatabaseProfiler.Options(slowStatementThresholdMilliseconds: slowStatementThresholdMilliseconds, capturesQueryPlans: capturesQueryPlans)
+			profiling.slowStatementHandler = slowStatementHandler
+			profiling.queues.removeAll { $0.queue == nil }
+			return profiling.queues.compactMap { $0.queue }
+		}
+		for queue in queues {
+			queue.setTracing(enabled)
+		}
+	}
+
+	static var isProfilingEnabled: Bool {
+		profiling.withLock { $0.isEnabled }
+	}
+
+	/// Profiles for every open database.
+	static func profiles() -> [DatabaseProfile] {
+		let queues = profiling.withLock { profiling in
+			profiling.queues.compactMap { $0.queue }
+		}
+		return queues.map { $0.profiler.report() }
+	}
+}
+
+extension DatabaseQueue {
+
+	struct Profiling: Sendable {
+		var isEnabled = false
+		var options = DatabaseProfiler.Options()
+		var slowStatementHandler: DatabaseProfiler.SlowStatementHandler?
+		var queues = [WeakDatabaseQueue]()
+	}
+
+	struct WeakDatabaseQueue: Sendable {
+		weak var queue: DatabaseQueue?
+	}
+
+	static let profiling = OSAllocatedUnfairLock(initialState: Profiling())
+
+	static var profilingOptions: DatabaseProfiler.Options {
+		profiling.withLock { $0.options }
+	}
+}
+
 private extension DatabaseQueue {
 
-	private func _runInDatabase(_ state: inout State, _ databaseBlock: DatabaseBlock, _ useTransaction: Bool) {
+	func runAsync(_ priority: Priority, _ enqueueTime: UInt64, _ run: @escaping @Sendable () -> Void) {
+		let needsPump = scheduler.withLock { $0.enqueue(priority, enqueueTime, run) }
+		if needsPump {
+			serialDispatchQueue.async {
+				self.pump()
+			}
+		}
+	}
+
+	/// Runs the most urgent waiting block, then dispatches the next pump if
+	/// there’s more. One block per pump, so a synchronous call dispatched in
+	/// the meantime gets its turn next.
+	func pump() {
+		if let work = scheduler.withLock({ $0.next() }) {
+			work.run?()
+		}
+		let hasMoreWork = scheduler.withLock { $0.pumpDidFinish() }
+		if hasMoreWork {
+			serialDispatchQueue.async {
+				self.pump()
+			}
+		}
+	}
+
+	func runSync(_ priority: Priority, _ databaseBlock: DatabaseBlock, _ useTransaction: Bool) {
+		let enqueueTime = DispatchTime.now().uptimeNanoseconds
+		let sequence = scheduler.withLock { $0.reserve(priority) }
+		serialDispatchQueue.sync {
+			// Run what the scheduler would run first — earlier work at this
+			// priority or above, and anything that has aged past it.
+			scheduler.withLock { $0.insertReserved(sequence, priority, enqueueTime) }
+			while let work = scheduler.withLock({ $0.next() }), work.sequence != sequence {
+				work.run?()
+			}
+			self.state.withLock { state in
+				self._runInDatabase(&state, databaseBlock, useTransaction, enqueueTime)
+			}
+		}
+	}
+
+	private func _runInDatabase(_ state: inout State, _ databaseBlock: DatabaseBlock, _ useTransaction: Bool, _ enqueueTime: UInt64, _ cancellationToken: DatabaseCancellationToken? = nil) {
 		precondition(!state.isCallingDatabase)
 
 		state.isCallingDatabase = true
+		if let cancellationToken {
+			state.database.setCancellationToken(cancellationToken)
+		}
 		defer {
+			if cancellationToken != nil {
+				state.database.setCancellationToken(nil)
+			}
 			state.isCallingDatabase = false
 		}
 
+		let startTime = DispatchTime.now().uptimeNanoseconds
+
 		autoreleasepool {
 			if useTransaction {
 				state.database.beginTransaction()
@@ -133,6 +296,26 @@ private extension DatabaseQueue {
 				state.database.commit()
 			}
 		}
+
+		let (isProfilingEnabled, options, handler) = Self.profiling.withLock { ($0.isEnabled, $0.options, $0.slowStatementHandler) }
+		if isProfilingEnabled {
+			let endTime = DispatchTime.now().uptimeNanoseconds
+			profiler.recordQueueCall(waitNanoseconds: startTime - enqueueTime, runNanoseconds: endTime - startTime)
+			profiler.databaseBlockDidFinish(state.database, options: options, handler: handler)
+		}
+	}
+
+	func setTracing(_ enabled: Bool) {
+		runInDatabase { database in
+			self.profiler.setTracing(enabled, database: database)
+		}
+	}
+
+	/// The database’s folder and file name, such as `OnMyMac/DB.sqlite3` —
+	/// enough to tell accounts apart.
+	static func profileName(_ databasePath: String) -> String {
+		let url = URL(fileURLWithPath: databasePath)
+		return "\(url.deletingLastPathComponent().lastPathComponent)/\(url.lastPathComponent)"
 	}
 
 	func openDatabase(_ database: FMDatabase) {
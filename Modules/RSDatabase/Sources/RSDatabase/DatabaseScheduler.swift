@@ -0,0 +1,170 @@
+//
+//  DatabaseScheduler.swift
+//  RSDatabase
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+
+public extension DatabaseQueue {
+
+	/// Which lane a database block waits in. A `DatabaseQueue` runs the
+	/// most urgent waiting block next, and blocks in the same lane in the
+	/// order they were added.
+	///
+	/// Work in a lower lane can be overtaken by work added after it in a
+	/// higher lane. So `.utility` and `.maintenance` are for work that no
+	/// later call depends on having finished — cleanup, indexing, saving a
+	/// refresh. `.interactive` can overtake `.userInitiated` writes, so it’s
+	/// for reads that are fine with not seeing them yet — the timeline’s
+	/// cancellable article fetches, for instance.
+	enum Priority: String, CaseIterable, Codable, CodingKeyRepresentable, Comparable, Sendable {
+		case maintenance
+		case utility
+		case userInitiated
+		case interactive
+
+		var rank: Int {
+			switch self {
+			case .maintenance:
+				return 0
+			case .utility:
+				return 1
+			case .userInitiated:
+				return 2
+			case .interactive:
+				return 3
+			}
+		}
+
+		public static func < (lhs: Priority, rhs: Priority) -> Bool {
+			lhs.rank < rhs.rank
+		}
+	}
+}
+
+/// How long blocks in one lane waited to run, since the queue was created.
+public struct DatabaseLaneWaitTimes: Codable, Sendable {
+	public let calls: Int
+	public let totalMilliseconds: Double
+	public let p50Milliseconds: Double
+	public let p95Milliseconds: Double
+	public let p99Milliseconds: Double
+	public let maximumMilliseconds: Double
+
+	init(_ histogram: LatencyHistogram) {
+		self.calls = histogram.count
+		self.totalMilliseconds = histogram.totalMilliseconds
+		self.p50Milliseconds = histogram.percentileMilliseconds(0.5)
+		self.p95Milliseconds = histogram.percentileMilliseconds(0.95)
+		self.p99Milliseconds = histogram.percentileMilliseconds(0.99)
+		self.maximumMilliseconds = histogram.maximumMilliseconds
+	}
+}
+
+/// The waiting blocks of a `DatabaseQueue`, by lane. Lives behind the
+/// queue’s lock; the queue’s serial dispatch queue does the running.
+///
+/// A block that has waited a while is treated as one lane more urgent for
+/// each `agingIntervalNanoseconds` it has waited, so a busy higher lane can delay
+/// maintenance but not starve it.
+struct DatabaseScheduler: Sendable {
+
+	struct Work: Sendable {
+		let sequence: UInt64
+		let priority: DatabaseQueue.Priority
+		let enqueueTime: UInt64
+		/// Nil for the placeholder of a synchronous call, which runs its own block.
+		let run: (@Sendable () -> Void)?
+	}
+
+	/// True while a pump block is on the dispatch queue, or running.
+	var isPumpScheduled = false
+
+	private var lanes = [[Work]](repeating: [], count: DatabaseQueue.Priority.allCases.count)
+	private var waitingSyncCalls = [Int](repeating: 0, count: DatabaseQueue.Priority.allCases.count)
+	private var waitTimes = [DatabaseQueue.Priority: LatencyHistogram]()
+	private var nextSequence: UInt64 = 0
+
+	static let agingIntervalNanoseconds: UInt64 = 500_000_000
+
+	var laneWaitTimes: [DatabaseQueue.Priority: DatabaseLaneWaitTimes] {
+		waitTimes.mapValues { DatabaseLaneWaitTimes($0) }
+	}
+
+	/// Adds asynchronous work. Returns true if a pump block needs to be dispatched.
+	mutating func enqueue(_ priority: DatabaseQueue.Priority, _ enqueueTime: UInt64, _ run: @escaping @Sendable () -> Void) -> Bool {
+		lanes[priority.rank].append(Work(sequence: takeSequence(), priority: priority, enqueueTime: enqueueTime, run: run))
+		if isPumpScheduled {
+			return false
+		}
+		isPumpScheduled = true
+		return true
+	}
+
+	/// Takes a place in line for a synchronous call that’s waiting for the dispatch queue.
+	mutating func reserve(_ priority: DatabaseQueue.Priority) -> UInt64 {
+		waitingSyncCalls[priority.rank] += 1
+		return takeSequence()
+	}
+
+	/// Puts a synchronous call’s placeholder in its lane, in sequence order,
+	/// once the call has the dispatch queue.
+	mutating func insertReserved(_ sequence: UInt64, _ priority: DatabaseQueue.Priority, _ enqueueTime: UInt64) {
+		waitingSyncCalls[priority.rank] -= 1
+		let work = Work(sequence: sequence, priority: priority, enqueueTime: enqueueTime, run: nil)
+		let index = lanes[priority.rank].firstIndex { $0.sequence > sequence } ?? lanes[priority.rank].endIndex
+		lanes[priority.rank].insert(work, at: index)
+	}
+
+	/// Removes and returns the most urgent work, counting aging.
+	mutating func next() -> Work? {
+		let now = DispatchTime.now().uptimeNanoseconds
+		var best: (rank: Int, urgency: Int, sequence: UInt64)?
+		for (rank, lane) in lanes.enumerated() {
+			guard let head = lane.first else {
+				continue
+			}
+			let urgency = rank + Int(min((now - min(now, head.enqueueTime)) / Self.agingIntervalNanoseconds, UInt64(lanes.count)))
+			// Less urgent, or as urgent but added later.
+			if let best, (urgency, best.sequence) < (best.urgency, head.sequence) {
+				continue
+			}
+			best = (rank, urgency, head.sequence)
+		}
+		guard let best else {
+			return nil
+		}
+
+		let work = lanes[best.rank].removeFirst()
+		waitTimes[work.priority, default: LatencyHistogram()].record(nanoseconds: now - min(now, work.enqueueTime))
+		return work
+	}
+
+	/// Called when a pump block finishes. Returns true if another is needed.
+	mutating func pumpDidFinish() -> Bool {
+		if lanes.contains(where: { !$0.isEmpty }) {
+			return true
+		}
+		isPumpScheduled = false
+		return false
+	}
+
+	func hasWaitingWork(moreUrgentThan priority: DatabaseQueue.Priority) -> Bool {
+		for rank in (priority.rank + 1)..<lanes.count where !lanes[rank].isEmpty || waitingSyncCalls[rank] > 0 {
+			return true
+		}
+		return false
+	}
+}
+
+private extension DatabaseScheduler {
+
+	mutating func takeSequence() -> UInt64 {
+		defer {
+			nextSequence += 1
+		}
+		return nextSequence
+	}
+}
@@ -6,6 +6,7 @@
 //
 
 import Foundation
+import SQLite3
 import RSDatabaseObjC
 import os
 
@@ -24,6 +25,11 @@ public extension FMDatabase {
 		return database
 	}
 
+	/// The underlying `sqlite3` handle, typed for calling SQLite directly.
+	var sqlite3Handle: OpaquePointer? {
+		OpaquePointer(sqliteHandle())
+	}
+
 	func executeUpdateInTransaction(_ sql: String, withArgumentsIn parameters: [Any]? = nil) {
 		beginTransaction()
 		guard executeUpdate(sql, withArgumentsIn: parameters) else {
@@ -111,3 +117,35 @@ public extension FMDatabase {
 		return count
 	}
 }
+
+// MARK: - Cancellation
+
+extension FMDatabase {
+
+	/// Virtual machine instructions SQLite runs between checks of the
+	/// cancellation token — frequent enough to stop a long query promptly,
+	/// rare enough to cost nothing measurable.
+	static let cancellationCheckInstructionCount: Int32 = 1000
+
+	/// Makes statements fail with `SQLITE_INTERRUPT` once `token` is canceled.
+	/// Pass nil to stop checking. Call on the database queue.
+	func setCancellationToken(_ token: DatabaseCancellationToken?) {
+		guard let handle = sqlite3Handle else {
+			return
+		}
+		if let token {
+			sqlite3_progress_handler(handle, Self.cancellationCheckInstructionCount, databaseCancellationCheck, Unmanaged.passUnretained(token).toOpaque())
+		} else {
+			sqlite3_progress_handler(handle, 0, nil, nil)
+		}
+	}
+}
+
+/// The progress handler. Returning non-zero interrupts the running statement.
+private func databaseCancellationCheck(_ context: UnsafeMutableRawPointer?) -> Int32 {
+	guard let context else {
+		return 0
+	}
+	let token = Unmanaged<DatabaseCancellationToken>.fromOpaque(context).takeUnretainedValue()
+	return token.isCanceled ? 1 : 0
+}
@@ -10,8 +10,8 @@ import RSDatabaseObjC
 
 /// Shared single-table key/value store kept in every database, under a common
 /// name, for RSDatabase-level bookkeeping. Currently it records the last
-/// vacuum date (see `FMDatabase.vacuumIfNeeded`); it can hold more per-database
-/// metadata later (schema version, last-prune date, etc.).
+/// vacuum date (see `FMDatabase.vacuumIfNeeded`) and the resume points of
+/// in-progress maintenance jobs (see `DatabaseMaintenanceScheduler`).
 public enum RSDatabaseInfoTable {
 
 	public static let tableName = "RSDatabaseInfo"
@@ -41,4 +41,27 @@ public enum RSDatabaseInfoTable {
 	static func setLastVacuumDate(_ date: Date, database: FMDatabase) {
 		database.executeUpdate("INSERT OR REPLACE INTO \(tableName) (\(keyColumn), \(valueColumn)) VALUES (?, ?);", withArgumentsIn: [lastVacuumDateKey, date.timeIntervalSince1970])
 	}
+
+	/// The stored value — an `NSNumber`, `NSString`, or `NSData` — or nil.
+	static func value(forKey key: String, database: FMDatabase) -> Any? {
+		guard let resultSet = database.executeQuery("SELECT \(valueColumn) FROM \(tableName) WHERE \(keyColumn) = ?;", withArgumentsIn: [key]) else {
+			return nil
+		}
+		defer {
+			resultSet.close()
+		}
+		guard resultSet.next() else {
+			return nil
+		}
+		let value: Any? = resultSet.object(forColumnName: valueColumn)
+		return value is NSNull ? nil : value
+	}
+
+	static func setValue(_ value: Any, forKey key: String, database: FMDatabase) {
+		database.executeUpdate("INSERT OR REPLACE INTO \(tableName) (\(keyColumn), \(valueColumn)) VALUES (?, ?);", withArgumentsIn: [key, value])
+	}
+
+	static func removeValue(forKey key: String, database: FMDatabase) {
+		database.executeUpdate("DELETE FROM \(tableName) WHERE \(keyColumn) = ?;", withArgumentsIn: [key])
+	}
 }
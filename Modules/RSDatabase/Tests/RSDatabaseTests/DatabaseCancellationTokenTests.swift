@@ -0,0 +1,88 @@
+//
+//  DatabaseCancellationTokenTests.swift
+//  RSDatabase
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Testing
+import Foundation
+import SQLite3
+@testable import RSDatabase
+import RSDatabaseObjC
+
+@Suite("DatabaseCancellationToken")
+struct DatabaseCancellationTokenTests {
+
+	@Test func canceledBlockIsDroppedFromQueue() async {
+		let queue = DatabaseQueue(databasePath: ":memory:")
+		let token = DatabaseCancellationToken()
+
+		// Hold up the queue so the cancellable block is still waiting when canceled.
+		let blocker = DispatchSemaphore(value: 0)
+		queue.runInDatabase { _ in
+			blocker.wait()
+		}
+
+		let didRun = await withCheckedContinuation { continuation in
+			queue.runInDatabase(cancellationToken: token, { _ in
+				continuation.resume(returning: true)
+			}, ifCanceled: {
+				continuation.resume(returning: false)
+			})
+			token.cancel()
+			blocker.signal()
+		}
+
+		#expect(!didRun)
+	}
+
+	@Test func uncanceledBlockRuns() async {
+		let queue = DatabaseQueue(databasePath: ":memory:")
+
+		let count = await withCheckedContinuation { continuation in
+			queue.runInDatabase(cancellationToken: DatabaseCancellationToken(), { database in
+				let resultSet = database.executeQuery("with recursive c(x) as (select 1 union all select x + 1 from c where x < 100000) select count(*) from c;", withArgumentsIn: nil)!
+				continuation.resume(returning: resultSet.intWithCountResult())
+			}, ifCanceled: {
+				continuation.resume(returning: nil)
+			})
+		}
+
+		#expect(count == 100_000)
+	}
+
+	@Test func runningQueryIsInterrupted() async {
+		let queue = DatabaseQueue(databasePath: ":memory:")
+		let token = DatabaseCancellationToken()
+
+		let start = Date()
+		let errorCode = await withCheckedContinuation { continuation in
+			queue.runInDatabase(cancellationToken: token, { database in
+				// Never finishes on its own.
+				let resultSet = database.executeQuery("with recursive c(x) as (select 1 union all select x + 1 from c) select count(*) from c;", withArgumentsIn: nil)!
+				_ = resultSet.next()
+				let errorCode = database.lastErrorCode()
+				resultSet.close()
+				continuation.resume(returning: errorCode)
+			}, ifCanceled: {
+				continuation.resume(returning: SQLITE_OK)
+			})
+			DispatchQueue.global().asyncAfter(deadline: .now() + 0.1) {
+				token.cancel()
+			}
+		}
+
+		#expect(errorCode == SQLITE_INTERRUPT)
+		#expect(Date().timeIntervalSince(start) < 5)
+
+		// The progress handler is gone: later blocks aren’t affected.
+		let count = await withCheckedContinuation { continuation in
+			queue.runInDatabase { database in
+				let resultSet = database.executeQuery("select count(*) from sqlite_master;", withArgumentsIn: nil)!
+				continuation.resume(returning: resultSet.intWithCountResult())
+			}
+		}
+		#expect(count == 0)
+	}
+}
@@ -0,0 +1,114 @@
+//
+//  DatabaseMaintenanceSchedulerTests.swift
+//  RSDatabase
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Testing
+import Foundation
+import RSDatabase
+import RSDatabaseObjC
+
+@Suite("DatabaseMaintenanceScheduler")
+struct DatabaseMaintenanceSchedulerTests {
+
+	@Test func deletesMatchingRowsAcrossSlices() async {
+		let queue = makeQueue(rowCount: 1000)
+		let job = DatabaseMaintenanceJob(name: "deleteOdd", tableName: "t", whereClause: "value % 2 = ?", parameters: [1])
+
+		// A zero time budget forces one batch per slice.
+		let scheduler = DatabaseMaintenanceScheduler(queue: queue, sliceTimeBudget: 0, pauseBetweenSlices: .zero, batchSize: 100)
+		let report = await scheduler.run(job)
+
+		#expect(report.didFinish)
+		#expect(report.rowsDeleted == 500)
+		#expect(report.slices > 1)
+		#expect(count("select count(*) from t;", queue) == 500)
+		#expect(count("select count(*) from t where value % 2 = 1;", queue) == 0)
+	}
+
+	@Test func clearsResumePointWhenFinished() async {
+		let queue = makeQueue(rowCount: 300)
+		let job = DatabaseMaintenanceJob(name: "deleteAll", tableName: "t", whereClause: "1")
+
+		let scheduler = DatabaseMaintenanceScheduler(queue: queue, sliceTimeBudget: 0, pauseBetweenSlices: .zero, batchSize: 50)
+		await scheduler.run([job])
+
+		#expect(count("select count(*) from t;", queue) == 0)
+		#expect(count("select count(*) from RSDatabaseInfo where key like 'maintenance.%';", queue) == 0)
+	}
+
+	@Test func doesNothingWhenNothingMatches() async {
+		let queue = makeQueue(rowCount: 100)
+		let job = DatabaseMaintenanceJob(name: "deleteNone", tableName: "t", whereClause: "value < 0")
+
+		let report = await DatabaseMaintenanceScheduler(queue: queue).run(job)
+
+		#expect(report.didFinish)
+		#expect(report.rowsDeleted == 0)
+		#expect(report.slices == 1)
+		#expect(count("select count(*) from t;", queue) == 100)
+	}
+
+	@Test func deletesByPrimaryKeyFromWithoutRowIDTable() async {
+		let queue = DatabaseQueue(databasePath: ":memory:")
+		queue.runInTransactionSync { database in
+			database.executeStatements("CREATE TABLE w (key TEXT NOT NULL PRIMARY KEY, value INTEGER) WITHOUT ROWID;")
+			for value in 0..<500 {
+				database.executeUpdate("INSERT INTO w (key, value) VALUES (?, ?);", withArgumentsIn: ["key\(value)", value])
+			}
+		}
+		let job = DatabaseMaintenanceJob(name: "deleteEven", tableName: "w", whereClause: "value % 2 = 0", keyColumn: "key")
+
+		// One batch per slice, so the text resume point is saved and read back.
+		let scheduler = DatabaseMaintenanceScheduler(queue: queue, sliceTimeBudget: 0, pauseBetweenSlices: .zero, batchSize: 50)
+		let report = await scheduler.run(job)
+
+		#expect(report.didFinish)
+		#expect(!report.didFail)
+		#expect(report.rowsDeleted == 250)
+		#expect(report.slices > 1)
+		#expect(count("select count(*) from w where value % 2 = 0;", queue) == 0)
+		#expect(count("select count(*) from w;", queue) == 250)
+	}
+
+	@Test func failedQueryKeepsResumePointAndDoesNotFinish() async {
+		let queue = makeQueue(rowCount: 100)
+		queue.runInDatabaseSync { database in
+			database.executeStatements("CREATE TABLE IF NOT EXISTS RSDatabaseInfo (key TEXT PRIMARY KEY NOT NULL, value);")
+			database.executeUpdate("INSERT INTO RSDatabaseInfo (key, value) VALUES (?, ?);", withArgumentsIn: ["maintenance.broken.lastRowID", 10])
+		}
+		let job = DatabaseMaintenanceJob(name: "broken", tableName: "t", whereClause: "noSuchColumn = 1")
+
+		let reports = await DatabaseMaintenanceScheduler(queue: queue).run([job])
+
+		#expect(reports.count == 1)
+		#expect(reports[0].didFail)
+		#expect(!reports[0].didFinish)
+		#expect(count("select count(*) from t;", queue) == 100)
+		#expect(count("select value from RSDatabaseInfo where key = 'maintenance.broken.lastRowID';", queue) == 10)
+	}
+}
+
+private extension DatabaseMaintenanceSchedulerTests {
+
+	func makeQueue(rowCount: Int) -> DatabaseQueue {
+		let queue = DatabaseQueue(databasePath: ":memory:")
+		queue.runInTransactionSync { database in
+			database.executeStatements("CREATE TABLE t (value INTEGER);")
+			for value in 0..<rowCount {
+				database.executeUpdate("INSERT INTO t (value) VALUES (?);", withArgumentsIn: [value])
+			}
+		}
+		return queue
+	}
+
+	func count(_ sql: String, _ queue: DatabaseQueue) -> Int {
+		nonisolated(unsafe) var count = 0
+		queue.runInDatabaseSync { database in
+			count = database.executeQuery(sql, withArgumentsIn: nil)?.intWithCountResult() ?? 0
+		}
+		return count
+	}
+}
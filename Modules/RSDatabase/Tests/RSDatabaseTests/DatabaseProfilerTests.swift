@@ -0,0 +1,87 @@
+//
+//  DatabaseProfilerTests.swift
+//  RSDatabase
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Testing
+import Foundation
+@testable import RSDatabase
+import RSDatabaseObjC
+
+@Suite("DatabaseProfiler", .serialized)
+struct DatabaseProfilerTests {
+
+	@Test("Fingerprints normalize literals and parameter lists",
+	      arguments: [
+	          ("select * from articles where articleID in (?, ?, ?);", "select * from articles where articleID in (?…);"),
+	          ("select * from articles where articleID in (?);", "select * from articles where articleID in (?);"),
+	          ("select articleID from statuses where read=1 limit 500;", "select articleID from statuses where read=? limit ?;"),
+	          ("select * from t where name = 'it''s'  and\n\tid = 3", "select * from t where name = ? and id = ?"),
+	          ("update articles set title = ?, summary = ? where articleID = ?;", "update articles set title = ?, summary = ? where articleID = ?;"),
+	          ("select h1 from t1", "select h1 from t1")
+	      ])
+	func fingerprint(_ sql: String, _ expected: String) {
+		#expect(DatabaseProfiler.fingerprint(sql) == expected)
+	}
+
+	@Test func profilesStatementsQueueTimeAndQueryPlans() async throws {
+		let queue = DatabaseQueue(databasePath: ":memory:")
+		DatabaseQueue.setProfilingEnabled(true, slowStatementThresholdMilliseconds: 0, capturesQueryPlans: true)
+		defer {
+			DatabaseQueue.setProfilingEnabled(false)
+		}
+
+		queue.runInDatabaseSync { database in
+			database.executeStatements("create table t (id integer primary key, name text);")
+			for i in 0..<10 {
+				database.executeUpdate("insert into t (id, name) values (?, ?);", withArgumentsIn: [i, "name \(i)"])
+			}
+			let resultSet = database.executeQuery("select * from t where id in (?, ?, ?);", withArgumentsIn: [1, 2, 3])!
+			while resultSet.next() {
+			}
+			resultSet.close()
+		}
+
+		let profile = queue.profiler.report()
+
+		let insert = try #require(profile.statements.first { $0.fingerprint == "insert into t (id, name) values (?…);" })
+		#expect(insert.calls == 10)
+
+		let select = try #require(profile.statements.first { $0.fingerprint == "select * from t where id in (?…);" })
+		#expect(select.calls == 1)
+		#expect(select.rows == 3)
+		#expect(select.p99Milliseconds <= select.maximumMilliseconds)
+
+		#expect(profile.queue.calls >= 1)
+		let slowSelect = try #require(profile.slowStatements.first { $0.fingerprint == select.fingerprint })
+		#expect(slowSelect.queryPlan?.isEmpty == false)
+
+		let json = try DatabaseProfile.jsonData([profile])
+		let decoded = try JSONDecoder.iso8601.decode([DatabaseProfile].self, from: json)
+		#expect(decoded.first?.statements.count == profile.statements.count)
+	}
+
+	@Test func percentileIsWithinAFactorOfTwo() {
+		var histogram = LatencyHistogram()
+		for _ in 0..<99 {
+			histogram.record(nanoseconds: 100_000) // 0.1 ms
+		}
+		histogram.record(nanoseconds: 40_000_000) // 40 ms
+
+		#expect(histogram.count == 100)
+		let p99 = histogram.percentileMilliseconds(0.99)
+		#expect(p99 >= 0.1 && p99 <= 0.2)
+		#expect(histogram.percentileMilliseconds(1.0) == 40)
+	}
+}
+
+private extension JSONDecoder {
+
+	static var iso8601: JSONDecoder {
+		let decoder = JSONDecoder()
+		decoder.dateDecodingStrategy = .iso8601
+		return decoder
+	}
+}
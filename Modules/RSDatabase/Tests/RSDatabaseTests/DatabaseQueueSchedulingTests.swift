@@ -0,0 +1,105 @@
+//
+//  DatabaseQueueSchedulingTests.swift
+//  RSDatabase
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Testing
+import Foundation
+import os
+import SQLite3
+import RSDatabase
+import RSDatabaseObjC
+
+@Suite("DatabaseQueue scheduling")
+struct DatabaseQueueSchedulingTests {
+
+	@Test func runsMoreUrgentWorkFirst() {
+		let queue = DatabaseQueue(databasePath: ":memory:")
+		let order = OSAllocatedUnfairLock(initialState: [DatabaseQueue.Priority]())
+
+		// Hold the queue so that everything below is waiting at once.
+		let started = DispatchSemaphore(value: 0)
+		let release = DispatchSemaphore(value: 0)
+		queue.runInDatabase { _ in
+			started.signal()
+			release.wait()
+		}
+		started.wait()
+
+		for priority in [DatabaseQueue.Priority.maintenance, .utility, .userInitiated, .interactive] {
+			queue.runInDatabase(priority: priority) { _ in
+				order.withLock { $0.append(priority) }
+			}
+		}
+		release.signal()
+
+		// A synchronous maintenance call waits for all of the above.
+		queue.runInDatabaseSync(priority: .maintenance) { _ in }
+
+		#expect(order.withLock { $0 } == [.interactive, .userInitiated, .utility, .maintenance])
+		#expect(queue.laneWaitTimes()[.maintenance]?.calls == 2)
+		#expect(queue.laneWaitTimes()[.interactive]?.calls == 1)
+	}
+
+	@Test func synchronousReadSeesEarlierWrite() {
+		let queue = DatabaseQueue(databasePath: ":memory:")
+		queue.runCreateStatements("CREATE TABLE t (value INTEGER);")
+
+		queue.runInTransaction { database in
+			database.executeUpdate("INSERT INTO t (value) VALUES (?);", withArgumentsIn: [1])
+		}
+
+		nonisolated(unsafe) var count = 0
+		queue.runInDatabaseSync { database in
+			count = database.executeQuery("select count(*) from t;", withArgumentsIn: nil)?.intWithCountResult() ?? 0
+		}
+		#expect(count == 1)
+	}
+
+	@Test func maintenanceYieldsToInteractiveReads() async {
+		let rowCount = 200_000
+		let queue = DatabaseQueue(databasePath: ":memory:")
+		queue.runInTransactionSync { database in
+			database.executeStatements("CREATE TABLE t (value INTEGER);")
+			for value in 0..<rowCount {
+				database.executeUpdate("INSERT INTO t (value) VALUES (?);", withArgumentsIn: [value])
+			}
+		}
+
+		// Signals as soon as the slice is scanning for rows, so the read
+		// below is added while the slice is partway through.
+		let sliceStarted = DispatchSemaphore(value: 0)
+		queue.runInDatabaseSync { database in
+			database.makeFunctionNamed("signalSliceStarted", maximumArguments: 0) { context, _, _ in
+				sliceStarted.signal()
+				sqlite3_result_int(OpaquePointer(context), 1)
+			}
+		}
+
+		// A slice budget long enough to delete everything in one slice —
+		// unless the slice stops early for the read below.
+		let job = DatabaseMaintenanceJob(name: "deleteAll", tableName: "t", whereClause: "signalSliceStarted()")
+		let scheduler = DatabaseMaintenanceScheduler(queue: queue, sliceTimeBudget: 60, pauseBetweenSlices: .zero, batchSize: 100)
+		let maintenance = Task {
+			await scheduler.run(job)
+		}
+		sliceStarted.wait()
+
+		nonisolated(unsafe) var remainingRowCount = 0
+		queue.runInDatabaseSync(priority: .interactive) { database in
+			remainingRowCount = database.executeQuery("select count(*) from t;", withArgumentsIn: nil)?.intWithCountResult() ?? 0
+		}
+		// The read ran between two of the slice’s batches: after it had
+		// deleted some rows, and before it had deleted them all.
+		#expect(remainingRowCount > 0)
+		#expect(remainingRowCount < rowCount)
+
+		let report = await maintenance.value
+		#expect(report.didFinish)
+		#expect(report.rowsDeleted == rowCount)
+		#expect(report.slices > 1)
+		#expect(queue.laneWaitTimes()[.maintenance] != nil)
+	}
+}
@@ -13,6 +13,15 @@ import Foundation
 
 public typealias FeedParserCallback = @Sendable (_ parsedFeed: ParsedFeed?, _ error: Error?) -> Void
 
+/// How long a parse waited for the parse queue, and how long it ran.
+public struct FeedParserTiming: Sendable {
+	public let queueWaitMilliseconds: Double
+	public let parseMilliseconds: Double
+	/// CPU time of the parsing thread — less than `parseMilliseconds` when
+	/// the thread was preempted.
+	public let parseCPUMilliseconds: Double
+}
+
 public struct FeedParser {
 
 	private static let parseQueue = DispatchQueue(label: "FeedParser parse queue")
@@ -82,6 +91,24 @@ public struct FeedParser {
 		}
 	}
 
+	/// Like `parse(_:) async`, but also returns its `FeedParserTiming`.
+	/// The parse queue is serial, so when many feeds arrive at once —
+	/// during a refresh — the wait can be longer than the parse.
+	public static func timedParse(_ parserData: ParserData) async throws -> (parsedFeed: ParsedFeed?, timing: FeedParserTiming) {
+		let enqueueTime = DispatchTime.now().uptimeNanoseconds
+		return try await withCheckedThrowingContinuation { continuation in
+			parseQueue.async {
+				let startTime = DispatchTime.now().uptimeNanoseconds
+				let startCPUTime = clock_gettime_nsec_np(CLOCK_THREAD_CPUTIME_ID)
+				let result = Result { try parse(parserData) }
+				let endCPUTime = clock_gettime_nsec_np(CLOCK_THREAD_CPUTIME_ID)
+				let endTime = DispatchTime.now().uptimeNanoseconds
+				let timing = FeedParserTiming(queueWaitMilliseconds: Double(startTime - enqueueTime) / 1_000_000, parseMilliseconds: Double(endTime - startTime) / 1_000_000, parseCPUMilliseconds: Double(endCPUTime - startCPUTime) / 1_000_000)
+				continuation.resume(with: result.map { ($0, timing) })
+			}
+		}
+	}
+
 	public static func parse(_ parserData: ParserData, _ completion: @escaping FeedParserCallback) {
 
 		parseQueue.async {
@@ -32,18 +32,11 @@ public func feedType(_ parserData: ParserData, isPartialData: Bool = false) -> F
 	}
 
 	let data = parserData.data
-
-	if data.isProbablyJSONFeed {
-		return .jsonFeed
-	}
-	if data.isProbablyRSSInJSON {
-		return .rssInJSON
-	}
-	if data.isProbablyRSS {
-		return .rss
+	let type = parserData.feedTypeCache.feedType {
+		FeedTypeSniffer.feedType(data)
 	}
-	if data.isProbablyAtom {
-		return .atom
+	if type != .notAFeed {
+		return type
 	}
 
 	if isPartialData && data.isProbablyJSON {
@@ -0,0 +1,215 @@
+//
+//  FeedTypeSniffer.swift
+//  RSParser
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import os
+
+/// Detects the feed type of some data in a single pass, looking for all the
+/// markers `feedType` cares about at once (Aho–Corasick).
+///
+/// Markup — RSS, RDF, Atom, or HTML that isn’t a feed — is only searched in
+/// its first `markupWindow` bytes: a feed names its root element near the
+/// top, so a multi-megabyte web page costs no more than a small one. JSON is
+/// searched in full, since a JSON Feed’s `version` may be its last key.
+enum FeedTypeSniffer {
+
+	static let markupWindow = 64 * 1024
+
+	static func feedType(_ data: Data) -> FeedType {
+		let isJSON = data.isProbablyJSON
+		let markers = data.withUnsafeBytes { buffer -> FeedMarkers in
+			let bytes = buffer.assumingMemoryBound(to: UInt8.self)
+			if isJSON {
+				return jsonMatcher.markers(in: bytes) { $0.containsJSONFeedVersion }
+			}
+			let window = UnsafeBufferPointer(rebasing: bytes.prefix(markupWindow))
+			return markupMatcher.markers(in: window) { $0.isRSS }
+		}
+
+		if isJSON {
+			if markers.containsJSONFeedVersion {
+				return .jsonFeed
+			}
+			if markers.isSuperset(of: [.rss, .channel, .item]) {
+				return .rssInJSON
+			}
+		}
+		if markers.isRSS {
+			return .rss
+		}
+		if markers.contains(.feedElement) {
+			return .atom
+		}
+		return .notAFeed
+	}
+}
+
+/// A `FeedType` worked out once and kept with its `ParserData`.
+final class FeedTypeCache: Sendable {
+
+	private let cachedType = OSAllocatedUnfairLock<FeedType?>(initialState: nil)
+
+	func feedType(_ sniff: () -> FeedType) -> FeedType {
+		if let feedType = cachedType.withLock({ $0 }) {
+			return feedType
+		}
+		let feedType = sniff()
+		cachedType.withLock { $0 = feedType }
+		return feedType
+	}
+}
+
+// MARK: - Private
+
+private struct FeedMarkers: OptionSet, Sendable {
+
+	let rawValue: UInt32
+
+	/// The JSON Feed marker, in canonical and in backslash-escaped form
+	/// (serializers sometimes escape the slashes).
+	static let jsonFeedVersion = FeedMarkers(rawValue: 1 << 0)
+	static let escapedJSONFeedVersion = FeedMarkers(rawValue: 1 << 1)
+
+	// RSS-in-JSON.
+	static let rss = FeedMarkers(rawValue: 1 << 2)
+	static let channel = FeedMarkers(rawValue: 1 << 3)
+	static let item = FeedMarkers(rawValue: 1 << 4)
+
+	static let rssElement = FeedMarkers(rawValue: 1 << 5)
+	static let rdfElement = FeedMarkers(rawValue: 1 << 6)
+	static let channelElement = FeedMarkers(rawValue: 1 << 7)
+	static let pubDateElement = FeedMarkers(rawValue: 1 << 8)
+	static let feedElement = FeedMarkers(rawValue: 1 << 9)
+
+	var containsJSONFeedVersion: Bool {
+		!isDisjoint(with: [.jsonFeedVersion, .escapedJSONFeedVersion])
+	}
+
+	/// `<rss` or `<rdf:RDF` — or `<channel>` plus `<pubDate>`, which catches
+	/// feeds like natashatherobot.com that omit the opening `<rss>`.
+	var isRSS: Bool {
+		!isDisjoint(with: [.rssElement, .rdfElement]) || isSuperset(of: [.channelElement, .pubDateElement])
+	}
+}
+
+private let markupPatterns: [(String, FeedMarkers)] = [
+	("<rss", .rssElement),
+	("<rdf:RDF", .rdfElement),
+	("<channel>", .channelElement),
+	("<pubDate>", .pubDateElement),
+	("<feed", .feedElement)
+]
+
+private let jsonPatterns: [(String, FeedMarkers)] = [
+	("://jsonfeed.org/version/", .jsonFeedVersion),
+	(":\\/\\/jsonfeed.org\\/version\\/", .escapedJSONFeedVersion),
+	("rss", .rss),
+	("channel", .channel),
+	("item", .item)
+] + markupPatterns
+
+private let markupMatcher = MultiPatternMatcher(markupPatterns)
+private let jsonMatcher = MultiPatternMatcher(jsonPatterns)
+
+/// An Aho–Corasick automaton, compiled to a table with a next state for every
+/// state and byte — so matching is one lookup per byte, with no backtracking.
+private struct MultiPatternMatcher: Sendable {
+
+	private let transitions: [UInt16]
+	private let outputs: [FeedMarkers]
+	/// When every pattern starts with the same byte, `memchr` skips to it
+	/// whenever nothing is partly matched.
+	private let commonFirstByte: UInt8?
+
+	init(_ patterns: [(String, FeedMarkers)]) {
+		var transitions = [Int](repeating: -1, count: 256)
+		var outputs = [FeedMarkers()]
+
+		// Trie of the patterns, with -1 for no edge.
+		for (pattern, marker) in patterns {
+			var state = 0
+			for byte in pattern.utf8 {
+				let index = state * 256 + Int(byte)
+				if transitions[index] == -1 {
+					transitions[index] = outputs.count
+					transitions += [Int](repeating: -1, count: 256)
+					outputs.append([])
+				}
+				state = transitions[index]
+			}
+			outputs[state].insert(marker)
+		}
+
+		// Breadth-first, fill in the missing edges from each state’s failure
+		// state — the longest proper suffix that’s also in the trie — and
+		// inherit its outputs, so a match ending inside a longer one counts.
+		var failures = [Int](repeating: 0, count: outputs.count)
+		var queue = [Int]()
+		for byte in 0..<256 {
+			if transitions[byte] == -1 {
+				transitions[byte] = 0
+			} else {
+				queue.append(transitions[byte])
+			}
+		}
+		var head = 0
+		while head < queue.count {
+			let state = queue[head]
+			head += 1
+			outputs[state].formUnion(outputs[failures[state]])
+			for byte in 0..<256 {
+				let index = state * 256 + byte
+				let failureTarget = transitions[failures[state] * 256 + byte]
+				if transitions[index] == -1 {
+					transitions[index] = failureTarget
+				} else {
+					failures[transitions[index]] = failureTarget
+					queue.append(transitions[index])
+				}
+			}
+		}
+
+		precondition(outputs.count <= Int(UInt16.max))
+		self.transitions = transitions.map { UInt16($0) }
+		self.outputs = outputs
+		let firstBytes = Set(patterns.compactMap { $0.0.utf8.first })
+		self.commonFirstByte = firstBytes.count == 1 ? firstBytes.first : nil
+	}
+
+	/// The markers found in `bytes`. Stops early once `isDone` is true.
+	func markers(in bytes: UnsafeBufferPointer<UInt8>, isDone: (FeedMarkers) -> Bool) -> FeedMarkers {
+		guard let base = bytes.baseAddress else {
+			return []
+		}
+		let count = bytes.count
+
+		return transitions.withUnsafeBufferPointer { transitions in
+			var found = FeedMarkers()
+			var state = 0
+			var i = 0
+			while i < count {
+				if state == 0, let commonFirstByte {
+					guard let match = memchr(base + i, Int32(commonFirstByte), count - i) else {
+						break
+					}
+					i = UnsafeRawPointer(base).distance(to: UnsafeRawPointer(match))
+				}
+				state = Int(transitions[state &* 256 &+ Int(base[i])])
+				i += 1
+
+				let output = outputs[state]
+				if !found.isSuperset(of: output) {
+					found.formUnion(output)
+					if isDone(found) {
+						break
+					}
+				}
+			}
+			return found
+		}
+	}
+}
@@ -0,0 +1,179 @@
+//
+//  HTMLContentSummary.swift
+//  RSParser
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+
+/// Everything derived from an article body, from one `HTMLScanner` pass:
+/// the plain text (for the search index), a short preview (for the timeline),
+/// and the lead image URL.
+///
+/// Run once, at ingest, for new and changed articles. The text follows
+/// `strippingHTML` conventions: tags and script/style content removed,
+/// block-level tags become a space, runs of ASCII whitespace collapse to one
+/// space, ends trimmed. Unlike strip-then-decode, entity references are
+/// expanded by the scanner as text, so `&lt;i&gt;` stays the literal text `<i>`.
+public struct HTMLContentSummary: Sendable {
+
+	public static let defaultPreviewLength = 300
+
+	/// The whole body as plain text.
+	public let text: String
+
+	/// The first `previewLength` characters of `text`.
+	public let preview: String
+
+	/// The `src` of the first `<img>` that isn’t a 1×1 tracking pixel or a
+	/// `data:` URL — resolved against `baseURL` when relative.
+	public let leadImageURL: String?
+
+	public init(html: String, baseURL: URL? = nil, previewLength: Int = Self.defaultPreviewLength) {
+		let delegate = ContentSummaryDelegate(baseURL: baseURL)
+		let scanner = HTMLScanner(delegate: delegate)
+		scanner.parse(Array(html.utf8))
+
+		let text = delegate.text
+		self.text = text
+		self.preview = Self.preview(of: text, length: previewLength)
+		self.leadImageURL = delegate.leadImageURL
+	}
+}
+
+private extension HTMLContentSummary {
+
+	static func preview(of text: String, length: Int) -> String {
+		guard length > 0 else {
+			return ""
+		}
+		// `utf8.count` is O(1) and never less than the character count.
+		if text.utf8.count <= length {
+			return text
+		}
+		guard let endIndex = text.index(text.startIndex, offsetBy: length, limitedBy: text.endIndex) else {
+			return text
+		}
+		var preview = text[..<endIndex]
+		while preview.last == " " {
+			preview.removeLast()
+		}
+		return String(preview)
+	}
+}
+
+// MARK: - Delegate
+
+private final class ContentSummaryDelegate: HTMLScannerDelegate {
+
+	private let baseURL: URL?
+	private var textBytes = [UInt8]()
+	private var lastByteWasSpace = true // Skips leading whitespace
+	private var rawTextDepth = 0
+	private(set) var leadImageURL: String?
+
+	var text: String {
+		var end = textBytes.count
+		while end > 0 && textBytes[end - 1] == .asciiSpace {
+			end -= 1
+		}
+		return String(decoding: textBytes[..<end], as: UTF8.self)
+	}
+
+	init(baseURL: URL?) {
+		self.baseURL = baseURL
+	}
+
+	func htmlScanner(_ scanner: HTMLScanner,
+	                 didStartTag name: ArraySlice<UInt8>,
+	                 attributes: HTMLAttributes,
+	                 selfClosing: Bool) {
+		if isRawTextTag(name) {
+			if !selfClosing {
+				rawTextDepth += 1
+			}
+			return
+		}
+		if isBlockTag(name) {
+			appendSpace()
+			return
+		}
+		if leadImageURL == nil && tagNameEqualsIgnoringCase(name, Self.imgBytes) {
+			leadImageURL = imageURL(attributes)
+		}
+	}
+
+	func htmlScanner(_ scanner: HTMLScanner,
+	                 didEndTag name: ArraySlice<UInt8>) {
+		if isRawTextTag(name) {
+			rawTextDepth = max(rawTextDepth - 1, 0)
+			return
+		}
+		if isBlockTag(name) {
+			appendSpace()
+		}
+	}
+
+	func htmlScanner(_ scanner: HTMLScanner,
+	                 didFindCharacters bytes: ArraySlice<UInt8>) {
+		if rawTextDepth > 0 {
+			return
+		}
+		textBytes.reserveCapacity(textBytes.count + bytes.count)
+		for byte in bytes {
+			if byte == .asciiSpace || byte == .asciiTab || byte == .asciiNewline || byte == .asciiCarriageReturn {
+				appendSpace()
+			} else {
+				textBytes.append(byte)
+				lastByteWasSpace = false
+			}
+		}
+	}
+
+	// MARK: Helpers
+
+	static let imgBytes: [UInt8] = Array("img".utf8)
+	static let rawTextTags: [[UInt8]] = ["script", "style"].map { Array($0.utf8) }
+	static let blockTags: [[UInt8]] = ["p", "div", "br", "blockquote", "li", "ul", "ol", "h1", "h2", "h3", "h4", "h5", "h6", "pre", "hr", "table", "tr", "td", "th", "section", "article", "figure", "figcaption", "dd", "dt"].map { Array($0.utf8) }
+
+	private func appendSpace() {
+		if !lastByteWasSpace {
+			textBytes.append(.asciiSpace)
+			lastByteWasSpace = true
+		}
+	}
+
+	private func imageURL(_ attributes: HTMLAttributes) -> String? {
+		guard let src = attributes["src"]?.trimmingCharacters(in: .whitespaces), !src.isEmpty else {
+			return nil
+		}
+		if src.hasPrefix("data:") {
+			return nil
+		}
+		if attributes["width"] == "1" && attributes["height"] == "1" {
+			return nil
+		}
+		return URL(string: src, relativeTo: baseURL)?.absoluteString ?? src
+	}
+
+	private func isRawTextTag(_ name: ArraySlice<UInt8>) -> Bool {
+		Self.rawTextTags.contains { tagNameEqualsIgnoringCase(name, $0) }
+	}
+
+	private func isBlockTag(_ name: ArraySlice<UInt8>) -> Bool {
+		name.count <= 10 && Self.blockTags.contains { tagNameEqualsIgnoringCase(name, $0) }
+	}
+
+	private func tagNameEqualsIgnoringCase(_ name: ArraySlice<UInt8>, _ lowercased: [UInt8]) -> Bool {
+		guard name.count == lowercased.count else {
+			return false
+		}
+		for (a, b) in zip(name, lowercased) {
+			if a.asciiLowercased != b {
+				return false
+			}
+		}
+		return true
+	}
+}
@@ -0,0 +1,272 @@
+//
+//  HTMLHeadScanner.swift
+//  RSParser
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+
+// Incremental scanner that finds where an HTML document’s `<head>` ends —
+// for downloads that can stop as soon as they have it. Favicons, feed links,
+// and OpenGraph and Twitter tags all live in the head; the body is usually
+// most of the page.
+//
+// Feed it the bytes received so far, each time more arrive. It resumes where
+// the previous call left off. A construct cut off at the end of the data —
+// a tag, comment, or CDATA section — is rescanned from its start next time.
+//
+// Follows `HTMLScanner`’s rules for what counts as markup: comments, CDATA,
+// DOCTYPE, and PIs are skipped, quoted attribute values may contain `>`, and
+// the content of `<script>` and `<style>` is raw text. So a `</head>` inside
+// a script string or a comment doesn’t end the head.
+//
+// The head ends at `</head>` or `<body>`, whichever comes first.
+
+public struct HTMLHeadScanner: Sendable {
+
+	/// Byte count of the head — everything before the `</head>` or `<body>`
+	/// tag. Nil until found.
+	public private(set) var headLength: Int?
+
+	private var pos = 0
+	private var rawTextTagName: [UInt8]? // Lowercased. Inside <script> or <style>.
+
+	public init() {}
+
+	/// Scans `data`, which must start with the bytes passed to earlier calls.
+	/// Returns the head length once found.
+	@discardableResult
+	public mutating func scan(_ data: Data) -> Int? {
+		if headLength == nil {
+			data.withUnsafeBytes { rawBuffer in
+				scan(rawBuffer.assumingMemoryBound(to: UInt8.self))
+			}
+		}
+		return headLength
+	}
+}
+
+// MARK: - Private
+
+private extension HTMLHeadScanner {
+
+	static let headBytes: [UInt8] = Array("head".utf8)
+	static let bodyBytes: [UInt8] = Array("body".utf8)
+	static let scriptBytes: [UInt8] = Array("script".utf8)
+	static let styleBytes: [UInt8] = Array("style".utf8)
+	static let commentEndBytes: [UInt8] = Array("-->".utf8)
+	static let cdataEndBytes: [UInt8] = Array("]]>".utf8)
+	static let processingInstructionEndBytes: [UInt8] = Array("?>".utf8)
+	static let greaterThanBytes: [UInt8] = [.asciiGreaterThan]
+
+	mutating func scan(_ input: UnsafeBufferPointer<UInt8>) {
+		while pos < input.count {
+			if let tagName = rawTextTagName {
+				guard let endTagStart = Self.indexOfEndTag(tagName, in: input, from: pos) else {
+					// Keep enough of the tail to catch an end tag split across calls.
+					pos = max(pos, input.count - tagName.count - 2)
+					return
+				}
+				rawTextTagName = nil
+				pos = endTagStart
+			}
+
+			guard let lessThan = Self.index(of: .asciiLessThan, in: input, from: pos) else {
+				pos = input.count
+				return
+			}
+			pos = lessThan
+			guard let next = scanMarkup(input) else {
+				return // Incomplete — rescan from `pos` when more arrives.
+			}
+			if headLength != nil {
+				return
+			}
+			pos = next
+		}
+	}
+
+	/// Scans the markup starting with the `<` at `pos`. Returns where scanning
+	/// continues, or nil if the markup runs past the end of `input`.
+	mutating func scanMarkup(_ input: UnsafeBufferPointer<UInt8>) -> Int? {
+		let start = pos
+		guard start + 1 < input.count else {
+			return nil
+		}
+
+		switch input[start + 1] {
+		case .asciiExclamation:
+			return scanDeclaration(input)
+
+		case .asciiQuestion:
+			return Self.index(after: Self.processingInstructionEndBytes, in: input, from: start + 2)
+
+		case .asciiSlash:
+			guard let nameEnd = Self.tagNameEnd(in: input, from: start + 2) else {
+				return nil
+			}
+			if Self.equalsIgnoringCase(input[(start + 2)..<nameEnd], Self.headBytes) {
+				headLength = start
+				return start
+			}
+			return Self.index(after: Self.greaterThanBytes, in: input, from: nameEnd)
+
+		case let b where b.isASCIILetter:
+			guard let nameEnd = Self.tagNameEnd(in: input, from: start + 1) else {
+				return nil
+			}
+			let name = input[(start + 1)..<nameEnd]
+			if Self.equalsIgnoringCase(name, Self.bodyBytes) {
+				headLength = start
+				return start
+			}
+			guard let tagEnd = Self.startTagEnd(in: input, from: nameEnd) else {
+				return nil
+			}
+			let selfClosing = input[tagEnd - 2] == .asciiSlash
+			if !selfClosing {
+				if Self.equalsIgnoringCase(name, Self.scriptBytes) {
+					rawTextTagName = Self.scriptBytes
+				} else if Self.equalsIgnoringCase(name, Self.styleBytes) {
+					rawTextTagName = Self.styleBytes
+				}
+			}
+			return tagEnd
+
+		default:
+			return start + 1 // A literal `<` in text.
+		}
+	}
+
+	/// `<!--…-->`, `<![CDATA[…]]>`, or `<!DOCTYPE …>` and the like.
+	func scanDeclaration(_ input: UnsafeBufferPointer<UInt8>) -> Int? {
+		let start = pos
+		let available = input.count - start
+
+		if available < 4 {
+			return nil
+		}
+		if input[start + 2] == .asciiHyphen && input[start + 3] == .asciiHyphen {
+			return Self.index(after: Self.commentEndBytes, in: input, from: start + 4)
+		}
+		if input[start + 2] == .asciiLeftBracket {
+			if available < 9 {
+				return nil
+			}
+			if Self.hasPrefix("<![CDATA[", in: input, at: start) {
+				return Self.index(after: Self.cdataEndBytes, in: input, from: start + 9)
+			}
+		}
+		return Self.index(after: Self.greaterThanBytes, in: input, from: start + 2)
+	}
+
+	// MARK: - Utilities
+
+	static func index(of byte: UInt8, in input: UnsafeBufferPointer<UInt8>, from start: Int) -> Int? {
+		var i = start
+		while i < input.count {
+			if input[i] == byte {
+				return i
+			}
+			i += 1
+		}
+		return nil
+	}
+
+	/// The index just past the first `literal` at or after `start`.
+	static func index(after literal: [UInt8], in input: UnsafeBufferPointer<UInt8>, from start: Int) -> Int? {
+		guard let first = literal.first else {
+			return start
+		}
+		var i = start
+		while let candidate = index(of: first, in: input, from: i) {
+			let end = candidate + literal.count
+			if end > input.count {
+				return nil
+			}
+			if input[candidate..<end].elementsEqual(literal) {
+				return end
+			}
+			i = candidate + 1
+		}
+		return nil
+	}
+
+	/// The end of the tag name starting at `start`, or nil if the name
+	/// might continue past the end of `input`.
+	static func tagNameEnd(in input: UnsafeBufferPointer<UInt8>, from start: Int) -> Int? {
+		var i = start
+		while i < input.count && input[i].isXMLNameChar {
+			i += 1
+		}
+		return i < input.count ? i : nil
+	}
+
+	/// The index just past the `>` that closes a start tag, skipping over
+	/// quoted attribute values.
+	static func startTagEnd(in input: UnsafeBufferPointer<UInt8>, from start: Int) -> Int? {
+		var quote: UInt8?
+		var afterEquals = false
+		var i = start
+		while i < input.count {
+			let b = input[i]
+			if let q = quote {
+				if b == q {
+					quote = nil
+				}
+			} else if b == .asciiGreaterThan {
+				return i + 1
+			} else if b == .asciiEquals {
+				afterEquals = true
+			} else if afterEquals && (b == .asciiDoubleQuote || b == .asciiSingleQuote) {
+				quote = b
+				afterEquals = false
+			} else if !b.isASCIIWhitespace {
+				afterEquals = false
+			}
+			i += 1
+		}
+		return nil
+	}
+
+	/// The index of the `<` of `</name`, matched case-insensitively.
+	static func indexOfEndTag(_ name: [UInt8], in input: UnsafeBufferPointer<UInt8>, from start: Int) -> Int? {
+		var i = start
+		while let candidate = index(of: .asciiLessThan, in: input, from: i) {
+			let nameStart = candidate + 2
+			let nameEnd = nameStart + name.count
+			if nameEnd > input.count {
+				return nil
+			}
+			if input[candidate + 1] == .asciiSlash && equalsIgnoringCase(input[nameStart..<nameEnd], name) {
+				return candidate
+			}
+			i = candidate + 1
+		}
+		return nil
+	}
+
+	static func hasPrefix(_ literal: StaticString, in input: UnsafeBufferPointer<UInt8>, at start: Int) -> Bool {
+		let count = literal.utf8CodeUnitCount
+		if start + count > input.count {
+			return false
+		}
+		return literal.withUTF8Buffer { ptr in
+			input[start..<(start + count)].elementsEqual(ptr)
+		}
+	}
+
+	/// `lowercased` must already be lowercase.
+	static func equalsIgnoringCase(_ bytes: Slice<UnsafeBufferPointer<UInt8>>, _ lowercased: [UInt8]) -> Bool {
+		guard bytes.count == lowercased.count else {
+			return false
+		}
+		for (a, b) in zip(bytes, lowercased) {
+			if a.asciiLowercased != b {
+				return false
+			}
+		}
+		return true
+	}
+}
@@ -19,12 +19,17 @@ import Foundation
 public enum HTMLMetadataParser {
 
 	public static func htmlMetadata(with parserData: ParserData) -> HTMLMetadata {
-		let scanPastHead = parserData.url.range(of: "youtube", options: .caseInsensitive) != nil
-		let delegate = MetadataParserDelegate(scanPastHead: scanPastHead)
+		let delegate = MetadataParserDelegate(scanPastHead: scansPastHead(parserData.url))
 		let scanner = HTMLScanner(delegate: delegate)
 		scanner.parse(Array(parserData.data))
 		return HTMLMetadata(urlString: parserData.url, tags: delegate.tags)
 	}
+
+	/// True for pages whose metadata isn’t all in the `<head>` — so a
+	/// head-only download won’t do.
+	public static func scansPastHead(_ urlString: String) -> Bool {
+		urlString.range(of: "youtube", options: .caseInsensitive) != nil
+	}
 }
 
 // MARK: - Delegate
@@ -14,6 +14,10 @@ public struct ParserData: Sendable {
 	public let url: String
 	public let data: Data
 
+	/// Filled in by `feedType(_:isPartialData:)`, so that checking the type
+	/// and then parsing — `FeedParser.canParse` then `parse` — sniffs once.
+	let feedTypeCache = FeedTypeCache()
+
 	public init(url: String, data: Data) {
 		self.url = url
 		self.data = data
@@ -29,10 +29,10 @@ enum XMLEncoding {
 			return Array(input.dropFirst(3))
 		}
 		if hasUTF16LEBOM(input, count: count) {
-			return transcode(input.dropFirst(2), encoding: .utf16LittleEndian) ?? input
+			return transcodeUTF16(input.dropFirst(2), bigEndian: false) ?? transcode(input.dropFirst(2), encoding: .utf16LittleEndian) ?? input
 		}
 		if hasUTF16BEBOM(input, count: count) {
-			return transcode(input.dropFirst(2), encoding: .utf16BigEndian) ?? input
+			return transcodeUTF16(input.dropFirst(2), bigEndian: true) ?? transcode(input.dropFirst(2), encoding: .utf16BigEndian) ?? input
 		}
 
 		// No BOM — look at the XML declaration for an `encoding` attribute.
@@ -48,7 +48,7 @@ enum XMLEncoding {
 		case .windows1252:
 			return transcodeWindows1252(input, count: count)
 		case .foundation(let swiftEncoding):
-			return transcode(input[...], encoding: swiftEncoding) ?? input
+			return transcodeNatively(input[...], encoding: swiftEncoding) ?? transcode(input[...], encoding: swiftEncoding) ?? input
 		}
 	}
 
@@ -60,7 +60,8 @@ enum XMLEncoding {
 		case latin1
 		/// Hand-rolled fast path for Windows-1252 — same as Latin-1 except 0x80–0x9F.
 		case windows1252
-		/// Anything else — delegate to Foundation's `String(data:encoding:)`.
+		/// Anything else — a native transcoder (see XMLTranscoding.swift) where
+		/// there is one, otherwise Foundation's `String(data:encoding:)`.
 		case foundation(String.Encoding)
 	}
 
@@ -265,13 +266,10 @@ private extension XMLEncoding {
 		return nil
 	}
 
-	static func cf(_ encoding: CFStringEncodings) -> String.Encoding {
-		String.Encoding(rawValue: CFStringConvertEncodingToNSStringEncoding(CFStringEncoding(encoding.rawValue)))
-	}
-
 	// MARK: - Transcoding
 
-	/// Foundation-based transcode: bytes → String → UTF-8 bytes.
+	/// Foundation-based transcode: bytes → String → UTF-8 bytes. The fallback
+	/// for encodings and inputs the native transcoders don't handle.
 	static func transcode(_ slice: ArraySlice<UInt8>, encoding: String.Encoding) -> [UInt8]? {
 		let data = Data(slice)
 		guard let str = String(data: data, encoding: encoding) else {
@@ -0,0 +1,408 @@
+//
+//  XMLTranscoding.swift
+//  RSParser
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+
+// Single-pass transcoders straight to UTF-8 for UTF-16 and the code pages
+// feeds actually use — no intermediate Data or String.
+//
+// Code page tables aren't spelled out in source: each one is derived from
+// Foundation's own decoder the first time its encoding is seen, so output
+// matches the Foundation path byte for byte. Anything a table can't answer
+// — an undefined byte, a truncated pair, a character outside the BMP —
+// makes the transcoder return nil, and the caller falls back to Foundation
+// for the whole document.
+
+extension XMLEncoding {
+
+	static func cf(_ encoding: CFStringEncodings) -> String.Encoding {
+		String.Encoding(rawValue: CFStringConvertEncodingToNSStringEncoding(CFStringEncoding(encoding.rawValue)))
+	}
+
+	/// Transcode with a native fast path, if there is one for `encoding`.
+	/// Returns nil when there isn't, or when the input needs Foundation.
+	static func transcodeNatively(_ input: ArraySlice<UInt8>, encoding: String.Encoding) -> [UInt8]? {
+		if encoding == .utf16LittleEndian {
+			return transcodeUTF16(input, bigEndian: false)
+		}
+		if encoding == .utf16BigEndian {
+			return transcodeUTF16(input, bigEndian: true)
+		}
+		if let codePage = SingleByteCodePage.codePage(for: encoding) {
+			return codePage.transcode(input)
+		}
+		if let codePage = DoubleByteCodePage.codePage(for: encoding) {
+			return codePage.transcode(input)
+		}
+		return nil
+	}
+
+	// MARK: - UTF-16
+
+	/// UTF-16 → UTF-8. Runs of ASCII are checked and narrowed four code units
+	/// at a time. Returns nil for an odd byte count or an unpaired surrogate.
+	static func transcodeUTF16(_ input: ArraySlice<UInt8>, bigEndian: Bool) -> [UInt8]? {
+		guard input.count % 2 == 0 else {
+			return nil
+		}
+		let unitCount = input.count / 2
+
+		// Every code unit is at most 3 bytes of UTF-8, and a surrogate pair is 4.
+		var isValid = true
+		let output = input.withUnsafeBytes { source in
+			[UInt8](unsafeUninitializedCapacity: unitCount * 3) { destination, initializedCount in
+				// Four code units, read as a little-endian word: unit k is bits 16k..<16k+16.
+				// ASCII means the high byte is zero and the low byte is under 0x80.
+				let asciiMask: UInt64 = bigEndian ? 0x80FF_80FF_80FF_80FF : 0xFF80_FF80_FF80_FF80
+				let lowByteShift: UInt64 = bigEndian ? 8 : 0
+
+				func codeUnit(_ index: Int) -> UInt32 {
+					let raw = source.loadUnaligned(fromByteOffset: index * 2, as: UInt16.self)
+					return UInt32(bigEndian ? UInt16(bigEndian: raw) : UInt16(littleEndian: raw))
+				}
+
+				var i = 0
+				var o = 0
+				while i < unitCount {
+					while i + 4 <= unitCount {
+						let word = UInt64(littleEndian: source.loadUnaligned(fromByteOffset: i * 2, as: UInt64.self))
+						if word & asciiMask != 0 {
+							break
+						}
+						destination[o] = UInt8(truncatingIfNeeded: word >> lowByteShift)
+						destination[o + 1] = UInt8(truncatingIfNeeded: word >> (16 + lowByteShift))
+						destination[o + 2] = UInt8(truncatingIfNeeded: word >> (32 + lowByteShift))
+						destination[o + 3] = UInt8(truncatingIfNeeded: word >> (48 + lowByteShift))
+						i += 4
+						o += 4
+					}
+					guard i < unitCount else {
+						break
+					}
+
+					let unit = codeUnit(i)
+					if unit & 0xF800 != 0xD800 {
+						o += writeUTF8(unit, to: destination, at: o)
+						i += 1
+						continue
+					}
+
+					// Surrogates: a high one followed by a low one, or it's malformed.
+					guard unit < 0xDC00, i + 1 < unitCount else {
+						isValid = false
+						break
+					}
+					let low = codeUnit(i + 1)
+					guard low & 0xFC00 == 0xDC00 else {
+						isValid = false
+						break
+					}
+					let scalar = 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00)
+					o += writeUTF8(scalar, to: destination, at: o)
+					i += 2
+				}
+				initializedCount = o
+			}
+		}
+		return isValid ? output : nil
+	}
+
+	// MARK: - UTF-8 output
+
+	/// Writes `scalar` as UTF-8 at `offset`, returning the number of bytes written.
+	@inline(__always)
+	static func writeUTF8(_ scalar: UInt32, to buffer: UnsafeMutableBufferPointer<UInt8>, at offset: Int) -> Int {
+		if scalar < 0x80 {
+			buffer[offset] = UInt8(scalar)
+			return 1
+		}
+		if scalar < 0x800 {
+			buffer[offset] = UInt8(0xC0 | (scalar >> 6))
+			buffer[offset + 1] = UInt8(0x80 | (scalar & 0x3F))
+			return 2
+		}
+		if scalar < 0x10000 {
+			buffer[offset] = UInt8(0xE0 | (scalar >> 12))
+			buffer[offset + 1] = UInt8(0x80 | ((scalar >> 6) & 0x3F))
+			buffer[offset + 2] = UInt8(0x80 | (scalar & 0x3F))
+			return 3
+		}
+		buffer[offset] = UInt8(0xF0 | (scalar >> 18))
+		buffer[offset + 1] = UInt8(0x80 | ((scalar >> 12) & 0x3F))
+		buffer[offset + 2] = UInt8(0x80 | ((scalar >> 6) & 0x3F))
+		buffer[offset + 3] = UInt8(0x80 | (scalar & 0x3F))
+		return 4
+	}
+
+	/// Appends a BMP codepoint as UTF-8.
+	@inline(__always)
+	static func appendUTF8(_ codepoint: UInt16, to output: inout [UInt8]) {
+		let cp = UInt32(codepoint)
+		if cp < 0x80 {
+			output.append(UInt8(cp))
+		} else if cp < 0x800 {
+			output.append(UInt8(0xC0 | (cp >> 6)))
+			output.append(UInt8(0x80 | (cp & 0x3F)))
+		} else {
+			output.append(UInt8(0xE0 | (cp >> 12)))
+			output.append(UInt8(0x80 | ((cp >> 6) & 0x3F)))
+			output.append(UInt8(0x80 | (cp & 0x3F)))
+		}
+	}
+
+	/// Length of the run of ASCII bytes starting at `start`, checked eight at a time.
+	@inline(__always)
+	static func asciiRunLength(_ bytes: UnsafeBufferPointer<UInt8>, from start: Int) -> Int {
+		let raw = UnsafeRawBufferPointer(bytes)
+		var i = start
+		while i + 8 <= bytes.count {
+			if raw.loadUnaligned(fromByteOffset: i, as: UInt64.self) & 0x8080_8080_8080_8080 != 0 {
+				break
+			}
+			i += 8
+		}
+		while i < bytes.count && bytes[i] < 0x80 {
+			i += 1
+		}
+		return i - start
+	}
+
+	/// Appends the ASCII run at `start`, if any, in one copy. Returns its length.
+	@inline(__always)
+	static func appendASCIIRun(_ bytes: UnsafeBufferPointer<UInt8>, from start: Int, to output: inout [UInt8]) -> Int {
+		let runLength = asciiRunLength(bytes, from: start)
+		if runLength > 0 {
+			output.append(contentsOf: UnsafeBufferPointer(rebasing: bytes[start..<(start + runLength)]))
+		}
+		return runLength
+	}
+
+	// MARK: - Building tables
+
+	/// Decodes `bytes` with Foundation and returns one codepoint per character,
+	/// or nil if it fails, doesn't produce `expectedCount` scalars, or produces
+	/// anything that isn't a BMP codepoint a table can hold.
+	static func decodedCodepoints(_ bytes: [UInt8], encoding: String.Encoding, expectedCount: Int) -> [UInt16]? {
+		guard let string = String(bytes: bytes, encoding: encoding) else {
+			return nil
+		}
+		var codepoints = [UInt16]()
+		codepoints.reserveCapacity(expectedCount)
+		for scalar in string.unicodeScalars {
+			// 0 marks a hole in the tables, and U+FFFD means the decoder gave up on a byte.
+			guard scalar.value != 0, scalar.value != 0xFFFD, scalar.value < 0x10000 else {
+				return nil
+			}
+			codepoints.append(UInt16(scalar.value))
+		}
+		return codepoints.count == expectedCount ? codepoints : nil
+	}
+
+	/// True if bytes 0x01–0x7F decode to themselves — the tables only cover
+	/// the high half, and the ASCII fast paths copy everything else as is.
+	static func isASCIICompatible(_ encoding: String.Encoding) -> Bool {
+		let ascii = [UInt8](0x01...0x7F)
+		return decodedCodepoints(ascii, encoding: encoding, expectedCount: ascii.count) == ascii.map { UInt16($0) }
+	}
+}
+
+// MARK: - SingleByteCodePage
+
+/// An ASCII-compatible 8-bit code page: ISO-8859-x, KOI8-R, windows-125x.
+final class SingleByteCodePage: Sendable {
+
+	/// Codepoints for bytes 0x80–0xFF. 0 where the code page has no character.
+	private let highHalf: [UInt16]
+
+	private init?(encoding: String.Encoding) {
+		guard XMLEncoding.isASCIICompatible(encoding) else {
+			return nil
+		}
+		var highHalf = [UInt16](repeating: 0, count: 128)
+		let bytes = [UInt8](0x80...0xFF)
+		if let codepoints = XMLEncoding.decodedCodepoints(bytes, encoding: encoding, expectedCount: bytes.count) {
+			highHalf = codepoints
+		} else {
+			// Some byte is undefined — find out which, one at a time.
+			for byte in bytes {
+				highHalf[Int(byte - 0x80)] = XMLEncoding.decodedCodepoints([byte], encoding: encoding, expectedCount: 1)?.first ?? 0
+			}
+		}
+		self.highHalf = highHalf
+	}
+
+	private static let codePages: [String.Encoding: SingleByteCodePage] = {
+		let encodings: [String.Encoding] = [
+			.isoLatin2,
+			XMLEncoding.cf(.isoLatinCyrillic),
+			XMLEncoding.cf(.isoLatin5),
+			XMLEncoding.cf(.isoLatin9),
+			.windowsCP1250,
+			.windowsCP1251,
+			.windowsCP1253,
+			.windowsCP1254,
+			XMLEncoding.cf(.KOI8_R)
+		]
+		var codePages = [String.Encoding: SingleByteCodePage]()
+		for encoding in encodings {
+			codePages[encoding] = SingleByteCodePage(encoding: encoding)
+		}
+		return codePages
+	}()
+
+	static func codePage(for encoding: String.Encoding) -> SingleByteCodePage? {
+		codePages[encoding]
+	}
+
+	func transcode(_ input: ArraySlice<UInt8>) -> [UInt8]? {
+		var output = [UInt8]()
+		output.reserveCapacity(input.count + input.count / 2)
+
+		let isValid = input.withUnsafeBufferPointer { bytes -> Bool in
+			var i = 0
+			while i < bytes.count {
+				i += XMLEncoding.appendASCIIRun(bytes, from: i, to: &output)
+				guard i < bytes.count else {
+					break
+				}
+				let codepoint = highHalf[Int(bytes[i] - 0x80)]
+				guard codepoint != 0 else {
+					return false
+				}
+				XMLEncoding.appendUTF8(codepoint, to: &output)
+				i += 1
+			}
+			return true
+		}
+		return isValid ? output : nil
+	}
+}
+
+// MARK: - DoubleByteCodePage
+
+/// An ASCII-compatible CJK encoding where a high byte is either a character
+/// on its own or the lead byte of a two-byte character: Shift_JIS, EUC-JP,
+/// GBK, Big5, EUC-KR.
+///
+/// EUC-JP's three-byte JIS X 0212 sequences aren't in the table; a
+/// document that uses them goes through Foundation.
+final class DoubleByteCodePage: Sendable {
+
+	/// Codepoints for bytes 0x80–0xFF standing alone. 0 for lead bytes and undefined bytes.
+	private let singleBytes: [UInt16]
+
+	/// Codepoints for (lead, trail), indexed by `(lead - 0x80) << 8 | trail`. 0 where undefined.
+	private let pairs: [UInt16]
+
+	/// Trail bytes in every supported encoding fall in 0x40–0xFE.
+	private static let trailBytes: ClosedRange<UInt8> = 0x40...0xFE
+
+	private init?(encoding: String.Encoding) {
+		guard XMLEncoding.isASCIICompatible(encoding) else {
+			return nil
+		}
+
+		var singleBytes = [UInt16](repeating: 0, count: 128)
+		for byte in UInt8(0x80)...UInt8(0xFF) {
+			singleBytes[Int(byte - 0x80)] = XMLEncoding.decodedCodepoints([byte], encoding: encoding, expectedCount: 1)?.first ?? 0
+		}
+
+		var pairs = [UInt16](repeating: 0, count: 128 * 256)
+		for lead in UInt8(0x80)...UInt8(0xFF) where singleBytes[Int(lead - 0x80)] == 0 {
+			Self.decodePairs(lead: lead, trails: Self.trailBytes, encoding: encoding, into: &pairs)
+		}
+
+		self.singleBytes = singleBytes
+		self.pairs = pairs
+	}
+
+	/// Decodes every (lead, trail) pair in one call. If that fails — some pair
+	/// in the range is undefined — splits the range in half and tries again,
+	/// so building a table costs a few hundred decodes instead of tens of thousands.
+	private static func decodePairs(lead: UInt8, trails: ClosedRange<UInt8>, encoding: String.Encoding, into pairs: inout [UInt16]) {
+		var bytes = [UInt8]()
+		bytes.reserveCapacity(trails.count * 2)
+		for trail in trails {
+			bytes.append(lead)
+			bytes.append(trail)
+		}
+
+		if let codepoints = XMLEncoding.decodedCodepoints(bytes, encoding: encoding, expectedCount: trails.count) {
+			let base = Int(lead - 0x80) << 8
+			for (trail, codepoint) in zip(trails, codepoints) {
+				pairs[base | Int(trail)] = codepoint
+			}
+			return
+		}
+
+		guard trails.count > 1 else {
+			return
+		}
+		let middle = trails.lowerBound + UInt8(trails.count / 2)
+		decodePairs(lead: lead, trails: trails.lowerBound...(middle - 1), encoding: encoding, into: &pairs)
+		decodePairs(lead: lead, trails: middle...trails.upperBound, encoding: encoding, into: &pairs)
+	}
+
+	// Built on first use: each table takes a few milliseconds.
+	private static let shiftJIS = DoubleByteCodePage(encoding: .shiftJIS)
+	private static let eucJP = DoubleByteCodePage(encoding: .japaneseEUC)
+	private static let gbk = DoubleByteCodePage(encoding: XMLEncoding.cf(.GBK_95))
+	private static let big5 = DoubleByteCodePage(encoding: XMLEncoding.cf(.big5))
+	private static let eucKR = DoubleByteCodePage(encoding: XMLEncoding.cf(.EUC_KR))
+
+	static func codePage(for encoding: String.Encoding) -> DoubleByteCodePage? {
+		switch encoding {
+		case .shiftJIS:
+			return shiftJIS
+		case .japaneseEUC:
+			return eucJP
+		case XMLEncoding.cf(.GBK_95):
+			return gbk
+		case XMLEncoding.cf(.big5):
+			return big5
+		case XMLEncoding.cf(.EUC_KR):
+			return eucKR
+		default:
+			return nil
+		}
+	}
+
+	func transcode(_ input: ArraySlice<UInt8>) -> [UInt8]? {
+		var output = [UInt8]()
+		output.reserveCapacity(input.count + input.count / 2)
+
+		let isValid = input.withUnsafeBufferPointer { bytes -> Bool in
+			var i = 0
+			while i < bytes.count {
+				i += XMLEncoding.appendASCIIRun(bytes, from: i, to: &output)
+				guard i < bytes.count else {
+					break
+				}
+
+				let highIndex = Int(bytes[i] - 0x80)
+				let single = singleBytes[highIndex]
+				if single != 0 {
+					XMLEncoding.appendUTF8(single, to: &output)
+					i += 1
+					continue
+				}
+
+				guard i + 1 < bytes.count else {
+					return false
+				}
+				let codepoint = pairs[highIndex << 8 | Int(bytes[i + 1])]
+				guard codepoint != 0 else {
+					return false
+				}
+				XMLEncoding.appendUTF8(codepoint, to: &output)
+				i += 2
+			}
+			return true
+		}
+		return isValid ? output : nil
+	}
+}
@@ -9,6 +9,7 @@ import XCTest
 import RSParser
 
 // Performance tests stay in XCTest — Swift Testing doesn't have a `measure { }` equivalent yet.
+// Each run makes a new ParserData, since ParserData caches its feed type.
 
 final class FeedParserTypePerformanceTests: XCTestCase {
 
@@ -16,7 +17,7 @@ final class FeedParserTypePerformanceTests: XCTestCase {
 		// 0.000 on my 2012 iMac.
 		let d = parserData("EMarley", "rss", "https://medium.com/@emarley")
 		self.measure {
-			_ = feedType(d)
+			_ = feedType(ParserData(url: d.url, data: d.data))
 		}
 	}
 
@@ -24,7 +25,7 @@ final class FeedParserTypePerformanceTests: XCTestCase {
 		// 0.000 on my 2012 iMac.
 		let d = parserData("inessential", "json", "http://inessential.com/")
 		self.measure {
-			_ = feedType(d)
+			_ = feedType(ParserData(url: d.url, data: d.data))
 		}
 	}
 
@@ -32,7 +33,7 @@ final class FeedParserTypePerformanceTests: XCTestCase {
 		// 0.000 on my 2012 iMac.
 		let d = parserData("DaringFireball", "html", "http://daringfireball.net/")
 		self.measure {
-			_ = feedType(d)
+			_ = feedType(ParserData(url: d.url, data: d.data))
 		}
 	}
 
@@ -40,7 +41,29 @@ final class FeedParserTypePerformanceTests: XCTestCase {
 		// 0.001 on my 2012 iMac.
 		let d = parserData("DaringFireball", "rss", "http://daringfireball.net/")
 		self.measure {
-			_ = feedType(d)
+			_ = feedType(ParserData(url: d.url, data: d.data))
+		}
+	}
+
+	func testFeedTypePerformanceAllResources() {
+		let resourcesURL = Bundle.module.resourceURL!.appendingPathComponent("Resources")
+		let urls = try! FileManager.default.contentsOfDirectory(at: resourcesURL, includingPropertiesForKeys: nil)
+		let datas = urls.map { try! Data(contentsOf: $0) }
+		self.measure {
+			for data in datas {
+				_ = feedType(ParserData(url: "https://example.com/", data: data))
+			}
+		}
+	}
+
+	func testFeedTypePerformanceLargeHTML() {
+		// Web pages of a few megabytes are common when finding feeds.
+		var data = parserData("YouTubeTheVolvoRocks", "html", "https://www.youtube.com/").data
+		while data.count < 4_000_000 {
+			data.append(data)
+		}
+		self.measure {
+			_ = feedType(ParserData(url: "https://www.youtube.com/", data: data))
 		}
 	}
 }
@@ -82,6 +82,27 @@ import RSParser
 		#expect(feedType(d) == .jsonFeed)
 	}
 
+	// MARK: - Large Documents
+
+	@Test func feedMarkerDeepInLargeHTMLIsIgnored() {
+		// Markup is only searched near the top, where a feed’s root element would be.
+		var data = parserData("DaringFireball", "html", "http://daringfireball.net/").data
+		while data.count < 1_000_000 {
+			data.append(data)
+		}
+		data.append(Data("<script>const s = '<rss version=\"2.0\">';</script>".utf8))
+		#expect(feedType(ParserData(url: "http://daringfireball.net/", data: data)) == .notAFeed)
+	}
+
+	@Test func jsonFeedVersionAtEndOfLargeJSONIsFound() {
+		var json = "{\"title\": \"Large\", \"items\": ["
+		for i in 0..<20_000 {
+			json += "{\"id\": \"\(i)\", \"content_text\": \"Hello\"},"
+		}
+		json += "{}], \"version\": \"https://jsonfeed.org/version/1.1\"}"
+		#expect(feedType(ParserData(url: "https://example.com/feed.json", data: Data(json.utf8))) == .jsonFeed)
+	}
+
 	// MARK: - Unknown
 
 	@Test func partialAllThisUnknownFeedType() {
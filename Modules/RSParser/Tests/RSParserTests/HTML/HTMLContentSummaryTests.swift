@@ -0,0 +1,63 @@
+//
+//  HTMLContentSummaryTests.swift
+//  RSParser
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import Testing
+import RSParser
+
+@Suite struct HTMLContentSummaryTests {
+
+	@Test func textStripsTagsAndCollapsesWhitespace() {
+		let summary = HTMLContentSummary(html: "<p>Hello <b>World</b></p>\n\n<p>Second   paragraph</p>")
+		#expect(summary.text == "Hello World Second paragraph")
+		#expect(summary.preview == summary.text)
+	}
+
+	@Test func blockTagsKeepWordsApart() {
+		let summary = HTMLContentSummary(html: "<ul><li>One</li><li>Two</li></ul>Three<br>Four")
+		#expect(summary.text == "One Two Three Four")
+	}
+
+	@Test func scriptAndStyleContentIsDropped() {
+		let summary = HTMLContentSummary(html: "<style>p { color: red; }</style><p>Visible</p><script>var x = '<p>nope</p>';</script>")
+		#expect(summary.text == "Visible")
+	}
+
+	@Test func entitiesAreDecodedAsText() {
+		// Author-escaped markup stays literal text rather than being stripped as a tag.
+		let summary = HTMLContentSummary(html: "<p>Use &lt;i&gt; for italics. Tom &amp; Jerry.</p>")
+		#expect(summary.text == "Use <i> for italics. Tom & Jerry.")
+	}
+
+	@Test func previewIsTruncatedWithoutTrailingSpace() {
+		let summary = HTMLContentSummary(html: "<p>abcd efgh</p>", previewLength: 5)
+		#expect(summary.preview == "abcd")
+		#expect(summary.text == "abcd efgh")
+	}
+
+	@Test func previewCountsCharactersNotBytes() {
+		let summary = HTMLContentSummary(html: "<p>ééééé</p>", previewLength: 3)
+		#expect(summary.preview == "ééé")
+	}
+
+	@Test func leadImageIsFirstRealImageResolvedAgainstBaseURL() {
+		let html = """
+		<img src="data:image/gif;base64,R0lGOD"><img src="https://tracker.example.com/p.gif" width="1" height="1">
+		<p>Text</p><img src="/images/lead.jpg"><img src="second.jpg">
+		"""
+		let summary = HTMLContentSummary(html: html, baseURL: URL(string: "https://example.com/2026/10/post.html"))
+		#expect(summary.leadImageURL == "https://example.com/images/lead.jpg")
+		#expect(summary.text == "Text")
+	}
+
+	@Test func noImageAndEmptyBody() {
+		let summary = HTMLContentSummary(html: "")
+		#expect(summary.text == "")
+		#expect(summary.preview == "")
+		#expect(summary.leadImageURL == nil)
+	}
+}
@@ -0,0 +1,98 @@
+//
+//  HTMLHeadScannerTests.swift
+//  RSParser
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import Testing
+import RSParser
+
+@Suite struct HTMLHeadScannerTests {
+
+	@Test func headEndsAtEndTag() {
+		let html = "<html><head><title>T</title></HEAD><body><p>Hi</p></body></html>"
+		#expect(headLength(html) == prefixLength(html, "</HEAD>"))
+	}
+
+	@Test func headEndsAtBodyWithoutEndTag() {
+		let html = "<!DOCTYPE html><html><head><meta charset=utf-8><link rel=icon href=/f.ico>\n<Body class=\"x\"><p>Hi</p>"
+		#expect(headLength(html) == prefixLength(html, "<Body"))
+	}
+
+	@Test func markupThatIsNotATagIsSkipped() {
+		let html = """
+		<head>
+		<!-- </head> in a comment -->
+		<script>var s = "</head><body>";</script>
+		<style>/* <body> */</style>
+		<meta name="description" content="</head> <body>">
+		<![CDATA[ </head> ]]>
+		<?pi </head> ?>
+		<bodyish>
+		</head>
+		"""
+		#expect(headLength(html) == prefixLength(html, "</head>"))
+	}
+
+	@Test func selfClosingScriptIsNotRawText() {
+		let html = "<head><script src=\"a.js\" /><link rel=alternate href=/feed></head>"
+		#expect(headLength(html) == prefixLength(html, "</head>"))
+	}
+
+	@Test func noHeadEndInPartialDocument() {
+		var scanner = HTMLHeadScanner()
+		#expect(scanner.scan(Data("<html><head><title>Still going".utf8)) == nil)
+		#expect(scanner.headLength == nil)
+	}
+
+	@Test func chunkedInputMatchesWholeInput() throws {
+		let data = parserData("DaringFireball", "html", "http://daringfireball.net/").data
+		var wholeScanner = HTMLHeadScanner()
+		let expected = try #require(wholeScanner.scan(data))
+
+		// Every split point lands inside some construct for some chunk size.
+		for chunkSize in [1, 2, 3, 7, 64, 1000] {
+			var scanner = HTMLHeadScanner()
+			var received = Data()
+			var found: Int?
+			var offset = 0
+			while found == nil && offset < data.count {
+				let end = min(offset + chunkSize, data.count)
+				received.append(data[offset..<end])
+				found = scanner.scan(received)
+				offset = end
+			}
+			#expect(found == expected, "chunk size \(chunkSize)")
+		}
+	}
+
+	@Test func headIsEnoughForMetadata() throws {
+		let d = parserData("DaringFireball", "html", "http://daringfireball.net/")
+		var scanner = HTMLHeadScanner()
+		let length = try #require(scanner.scan(d.data))
+		#expect(length < d.data.count)
+
+		let head = ParserData(url: d.url, data: d.data.prefix(length))
+		let headMetadata = HTMLMetadataParser.htmlMetadata(with: head)
+		let metadata = HTMLMetadataParser.htmlMetadata(with: d)
+		#expect(headMetadata.favicons.map(\.urlString) == metadata.favicons.map(\.urlString))
+		#expect(headMetadata.feedLinks.map(\.urlString) == metadata.feedLinks.map(\.urlString))
+	}
+}
+
+private extension HTMLHeadScannerTests {
+
+	func headLength(_ html: String) -> Int? {
+		var scanner = HTMLHeadScanner()
+		return scanner.scan(Data(html.utf8))
+	}
+
+	func prefixLength(_ html: String, _ marker: String) -> Int? {
+		guard let range = html.range(of: marker, options: .backwards) else {
+			return nil
+		}
+		return html.utf8.distance(from: html.startIndex, to: range.lowerBound)
+	}
+}
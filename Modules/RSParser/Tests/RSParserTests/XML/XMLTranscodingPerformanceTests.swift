@@ -0,0 +1,106 @@
+//
+//  XMLTranscodingPerformanceTests.swift
+//  RSParserTests
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import XCTest
+@testable import RSParser
+
+/// Throughput of the native transcoders in XMLTranscoding.swift against
+/// Foundation's `String(data:encoding:)` → `Array(string.utf8)`, which
+/// is what `XMLEncoding.toUTF8` did for these encodings before.
+///
+/// Each fixture is a ~1 MB feed-shaped document: ASCII markup with
+/// non-ASCII titles and descriptions, the mix real feeds have.
+///
+/// Compare each `testNative…` with its `testFoundation…` counterpart in
+/// a release build. The first native call builds the encoding's table,
+/// so each native test warms it up before measuring.
+final class XMLTranscodingPerformanceTests: XCTestCase {
+
+	// MARK: - Fixtures
+
+	private static func cfEnc(_ cf: CFStringEncodings) -> String.Encoding {
+		String.Encoding(rawValue: CFStringConvertEncodingToNSStringEncoding(CFStringEncoding(cf.rawValue)))
+	}
+
+	private static func feed(_ text: String) -> String {
+		let item = "<item><title>\(text)</title><link>https://example.com/2026/10/18/article</link><description>&lt;p&gt;\(text) \(text)&lt;/p&gt;</description><pubDate>Sun, 18 Oct 2026 12:00:00 GMT</pubDate></item>\n"
+		var document = "<rss version=\"2.0\"><channel><title>Feed</title>\n"
+		while document.utf8.count < 1_000_000 {
+			document += item
+		}
+		return document + "</channel></rss>\n"
+	}
+
+	private static func encoded(_ text: String, _ encoding: String.Encoding) -> [UInt8] {
+		Array(feed(text).data(using: encoding)!)
+	}
+
+	private static let shiftJISFeed = encoded("日本語のフィードの記事タイトルです。東京の天気は晴れ", .shiftJIS)
+	private static let gbkFeed = encoded("简体中文新闻标题：今天的天气很好，适合出门散步", cfEnc(.GBK_95))
+	private static let koi8RFeed = encoded("Новости дня: погода в Москве — ясно, без осадков", cfEnc(.KOI8_R))
+	private static let utf16LEFeed = encoded("Café résumé — “quotes” and 日本語 with 🎉", .utf16LittleEndian)
+
+	// MARK: - Benchmarks
+
+	func testNativeShiftJIS() {
+		measureNative(Self.shiftJISFeed, .shiftJIS)
+	}
+
+	func testFoundationShiftJIS() {
+		measureFoundation(Self.shiftJISFeed, .shiftJIS)
+	}
+
+	func testNativeGBK() {
+		measureNative(Self.gbkFeed, Self.cfEnc(.GBK_95))
+	}
+
+	func testFoundationGBK() {
+		measureFoundation(Self.gbkFeed, Self.cfEnc(.GBK_95))
+	}
+
+	func testNativeKOI8R() {
+		measureNative(Self.koi8RFeed, Self.cfEnc(.KOI8_R))
+	}
+
+	func testFoundationKOI8R() {
+		measureFoundation(Self.koi8RFeed, Self.cfEnc(.KOI8_R))
+	}
+
+	func testNativeUTF16LE() {
+		measureNative(Self.utf16LEFeed, .utf16LittleEndian)
+	}
+
+	func testFoundationUTF16LE() {
+		measureFoundation(Self.utf16LEFeed, .utf16LittleEndian)
+	}
+}
+
+private extension XMLTranscodingPerformanceTests {
+
+	func measureNative(_ bytes: [UInt8], _ encoding: String.Encoding) {
+		XCTAssertNotNil(XMLEncoding.transcodeNatively(bytes[...], encoding: encoding))
+		var checksum = 0
+		measure {
+			for _ in 0..<10 {
+				checksum &+= XMLEncoding.transcodeNatively(bytes[...], encoding: encoding)?.count ?? 0
+			}
+		}
+		XCTAssertGreaterThan(checksum, 0)
+	}
+
+	func measureFoundation(_ bytes: [UInt8], _ encoding: String.Encoding) {
+		var checksum = 0
+		measure {
+			for _ in 0..<10 {
+				if let string = String(data: Data(bytes), encoding: encoding) {
+					checksum &+= Array(string.utf8).count
+				}
+			}
+		}
+		XCTAssertGreaterThan(checksum, 0)
+	}
+}
@@ -0,0 +1,140 @@
+//
+//  XMLTranscodingTests.swift
+//  RSParserTests
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import Testing
+@testable import RSParser
+
+// The native transcoders must produce exactly what Foundation produces.
+// Each corpus entry is encoded with Foundation, transcoded natively, and
+// compared with Foundation's own decoding — inside a feed-shaped document,
+// so the ASCII fast paths and the tables both get exercised.
+
+@Suite struct XMLTranscodingTests {
+
+	private static func cfEnc(_ cf: CFStringEncodings) -> String.Encoding {
+		String.Encoding(rawValue: CFStringConvertEncodingToNSStringEncoding(CFStringEncoding(cf.rawValue)))
+	}
+
+	private static let corpus: [(name: String, encoding: String.Encoding, text: String)] = [
+		("shift_jis", .shiftJIS, "日本語のフィード — ｶﾀｶﾅ（半角）と漢字、ひらがな。記事のタイトル"),
+		("euc-jp", .japaneseEUC, "東京都の天気予報：晴れのち曇り。ニュース一覧"),
+		("gbk", cfEnc(.GBK_95), "简体中文新闻标题：今天的天气很好。鏡頭"),
+		("big5", cfEnc(.big5), "繁體中文新聞標題：今天天氣很好。臺灣"),
+		("euc-kr", cfEnc(.EUC_KR), "한국어 뉴스 제목: 오늘 날씨가 좋습니다."),
+		("koi8-r", cfEnc(.KOI8_R), "Новости дня: погода в Москве — ясно"),
+		("windows-1251", .windowsCP1251, "Новини України: «Київ» № 5"),
+		("iso-8859-5", cfEnc(.isoLatinCyrillic), "Съешь же ещё этих мягких французских булок"),
+		("iso-8859-2", .isoLatin2, "Příliš žluťoučký kůň úpěl ďábelské ódy"),
+		("iso-8859-9", cfEnc(.isoLatin5), "Pijamalı hasta yağız şoföre çabucak güvendi"),
+		("iso-8859-15", cfEnc(.isoLatin9), "Prix : 10 € — œuvre, Šárka, Žofie"),
+		("windows-1250", .windowsCP1250, "Zażółć gęślą jaźń „cytat” – koniec"),
+		("windows-1253", .windowsCP1253, "Ξεσκεπάζω την ψυχοφθόρα βδελυγμία"),
+		("windows-1254", .windowsCP1254, "Türkçe başlık: İstanbul’da güneşli")
+	]
+
+	private static func document(_ text: String) -> String {
+		"<rss><channel><item><title>\(text)</title><description>\(text) \(text)</description></item></channel></rss>\n"
+	}
+
+	private static func foundationUTF8(_ bytes: [UInt8], encoding: String.Encoding) -> [UInt8]? {
+		String(data: Data(bytes), encoding: encoding).map { Array($0.utf8) }
+	}
+
+	// MARK: - Code pages
+
+	@Test(arguments: corpus.indices)
+	func codePageMatchesFoundation(index: Int) throws {
+		let entry = Self.corpus[index]
+		let encoded = try #require(Self.document(entry.text).data(using: entry.encoding), "can't encode \(entry.name)")
+		let bytes = Array(encoded)
+
+		let native = try #require(XMLEncoding.transcodeNatively(bytes[...], encoding: entry.encoding), "no native path for \(entry.name)")
+		#expect(native == Self.foundationUTF8(bytes, encoding: entry.encoding), "\(entry.name)")
+		#expect(String(decoding: native, as: UTF8.self) == Self.document(entry.text), "\(entry.name)")
+	}
+
+	@Test(arguments: corpus.indices)
+	func declaredDocumentMatchesFoundation(index: Int) throws {
+		let entry = Self.corpus[index]
+		let declaration = "<?xml version=\"1.0\" encoding=\"\(entry.name)\"?>"
+		let encoded = try #require((declaration + Self.document(entry.text)).data(using: entry.encoding))
+		let bytes = Array(encoded)
+		#expect(XMLEncoding.toUTF8(bytes) == Self.foundationUTF8(bytes, encoding: entry.encoding), "\(entry.name)")
+	}
+
+	/// Every high byte of every single-byte code page, not just the ones in the corpus.
+	@Test func singleByteCodePagesMatchFoundationForEveryByte() throws {
+		let encodings: [String.Encoding] = [.isoLatin2, Self.cfEnc(.isoLatinCyrillic), Self.cfEnc(.isoLatin5), Self.cfEnc(.isoLatin9),
+		                                    .windowsCP1250, .windowsCP1251, .windowsCP1253, .windowsCP1254, Self.cfEnc(.KOI8_R)]
+		for encoding in encodings {
+			for byte in UInt8(0x80)...UInt8(0xFF) {
+				let input: [UInt8] = [0x61, byte, 0x62]
+				let expected = Self.foundationUTF8(input, encoding: encoding)
+				let native = XMLEncoding.transcodeNatively(input[...], encoding: encoding)
+				// Nil from the native path just means Foundation takes over.
+				if let native {
+					#expect(native == expected, "\(encoding) byte \(byte)")
+				}
+			}
+		}
+	}
+
+	@Test func truncatedDoubleByteSequenceFallsBack() {
+		let input: [UInt8] = Array("<a>".utf8) + [0x93] // Shift_JIS lead byte with no trail.
+		#expect(XMLEncoding.transcodeNatively(input[...], encoding: .shiftJIS) == nil)
+	}
+
+	@Test func eucJPThreeByteSequenceFallsBackToFoundation() {
+		// JIS X 0212 — 0x8F plus two bytes — isn't in the native table.
+		let input = Array("<?xml version=\"1.0\" encoding=\"euc-jp\"?><a>".utf8) + [0x8F, 0xB0, 0xA1] + Array("</a>".utf8)
+		#expect(XMLEncoding.transcodeNatively(input[...], encoding: .japaneseEUC) == nil)
+		#expect(XMLEncoding.toUTF8(input) == Self.foundationUTF8(input, encoding: .japaneseEUC) ?? input)
+	}
+
+	// MARK: - UTF-16
+
+	@Test(arguments: [false, true])
+	func utf16MatchesFoundation(bigEndian: Bool) throws {
+		let encoding: String.Encoding = bigEndian ? .utf16BigEndian : .utf16LittleEndian
+		let texts = [
+			Self.document("plain ASCII, long enough for several four-unit words"),
+			Self.document("é ü ß — “quotes” € 日本語"),
+			Self.document("emoji 🎉🚀 and 𝄞 outside the BMP"),
+			"a", "ab", "abc", "abcd", "abcde", "é", "🎉",
+			""
+		]
+		for text in texts {
+			let bytes = Array(try #require(text.data(using: encoding)))
+			let native = XMLEncoding.transcodeUTF16(bytes[...], bigEndian: bigEndian)
+			#expect(native == Array(text.utf8), "\(text.debugDescription)")
+			#expect(native == Self.foundationUTF8(bytes, encoding: encoding), "\(text.debugDescription)")
+		}
+	}
+
+	@Test func utf16WithBOMTranscodesNatively() {
+		let text = "<a>café 🎉 数据</a>"
+		let littleEndian: [UInt8] = [0xFF, 0xFE] + Array(text.data(using: .utf16LittleEndian)!)
+		let bigEndian: [UInt8] = [0xFE, 0xFF] + Array(text.data(using: .utf16BigEndian)!)
+		#expect(XMLEncoding.toUTF8(littleEndian) == Array(text.utf8))
+		#expect(XMLEncoding.toUTF8(bigEndian) == Array(text.utf8))
+	}
+
+	@Test func utf16UnpairedSurrogatesAreRejected() {
+		let loneHigh: [UInt8] = [0x61, 0x00, 0x3D, 0xD8, 0x62, 0x00]
+		let loneLow: [UInt8] = [0x61, 0x00, 0x00, 0xDC, 0x62, 0x00]
+		let highAtEnd: [UInt8] = [0x61, 0x00, 0x3D, 0xD8]
+		#expect(XMLEncoding.transcodeUTF16(loneHigh[...], bigEndian: false) == nil)
+		#expect(XMLEncoding.transcodeUTF16(loneLow[...], bigEndian: false) == nil)
+		#expect(XMLEncoding.transcodeUTF16(highAtEnd[...], bigEndian: false) == nil)
+	}
+
+	@Test func utf16OddByteCountIsRejected() {
+		let input: [UInt8] = [0x61, 0x00, 0x62]
+		#expect(XMLEncoding.transcodeUTF16(input[...], bigEndian: false) == nil)
+	}
+}
@@ -17,6 +17,11 @@ let package = Package(
 			swiftSettings: [
 				.enableUpcomingFeature("NonisolatedNonsendingByDefault"),
 				.enableUpcomingFeature("InferIsolatedConformances")
-			])
+			]),
+		.testTarget(
+			name: "RSTreeTests",
+			dependencies: ["RSTree"],
+			swiftSettings: [.swiftLanguageMode(.v6)]
+		)
 	]
 )
@@ -52,6 +52,26 @@ public extension NSOutlineView {
 		}
 		return revealAndSelectNodeAtPath(nodePath)
 	}
+
+	/// Updates rows in place for the changes from a rebuild, instead of
+	/// reloading everything. Moves are applied as a remove plus an insert.
+	func apply(_ changes: TreeChanges, rootNode: Node, withAnimation animation: NSTableView.AnimationOptions = []) {
+		guard !changes.isEmpty else {
+			return
+		}
+
+		beginUpdates()
+		for containerChange in changes.containerChanges {
+			let parent: Node? = containerChange.parent === rootNode ? nil : containerChange.parent
+			if !containerChange.removedIndexes.isEmpty {
+				removeItems(at: containerChange.removedIndexes, inParent: parent, withAnimation: animation)
+			}
+			if !containerChange.insertedIndexes.isEmpty {
+				insertItems(at: containerChange.insertedIndexes, inParent: parent, withAnimation: animation)
+			}
+		}
+		endUpdates()
+	}
 }
 
 #endif
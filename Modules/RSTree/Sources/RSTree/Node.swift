@@ -13,10 +13,18 @@ import Foundation
 	public let representedObject: AnyObject
 	public var canHaveChildNodes = false
 	public var isGroupItem = false
-	public var childNodes = [Node]()
+	public var childNodes = [Node]() {
+		didSet {
+			childNodesByObject = nil
+		}
+	}
 	public let uniqueID: Int
 	private static var incrementingID = 0
 
+	/// Lets `existingOrNewChildNode(with:)` find each child without a scan,
+	/// so rebuilding a big folder isn’t quadratic. Built on first lookup.
+	private var childNodesByObject: [ObjectIdentifier: Node]?
+
 	public var isRoot: Bool {
 		parent == nil
 	}
@@ -87,7 +95,10 @@ import Foundation
 	}
 
 	public func childNodeRepresentingObject(_ obj: AnyObject) -> Node? {
-		findNodeRepresentingObject(obj, recursively: false)
+		if childNodesByObject == nil {
+			childNodesByObject = Dictionary(childNodes.map { (ObjectIdentifier($0.representedObject), $0) }, uniquingKeysWith: { first, _ in first })
+		}
+		return childNodesByObject?[ObjectIdentifier(obj)]
 	}
 
 	public func descendantNodeRepresentingObject(_ obj: AnyObject) -> Node? {
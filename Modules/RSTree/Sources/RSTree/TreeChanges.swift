@@ -0,0 +1,58 @@
+//
+//  TreeChanges.swift
+//  RSTree
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+
+/// What a rebuild changed, container by container — enough to update an
+/// outline view in place instead of reloading it.
+///
+/// Only containers that were in the tree before the rebuild are reported.
+/// The children of a newly inserted node come along with it.
+@MainActor public struct TreeChanges {
+
+	public struct ContainerChange {
+
+		public let parent: Node
+
+		/// Indexes in the old child nodes, including the old positions of moved nodes.
+		public let removedIndexes: IndexSet
+
+		/// Indexes in the new child nodes, including the new positions of moved nodes.
+		public let insertedIndexes: IndexSet
+
+		/// Nodes that are still children of `parent` but at a different index.
+		public let moves: [(from: Int, to: Int)]
+	}
+
+	public private(set) var containerChanges = [ContainerChange]()
+
+	public var isEmpty: Bool {
+		containerChanges.isEmpty
+	}
+
+	mutating func append(parent: Node, oldChildNodes: [Node], newChildNodes: [Node]) {
+		let difference = newChildNodes.difference(from: oldChildNodes) { $0 === $1 }.inferringMoves()
+
+		var removedIndexes = IndexSet()
+		var insertedIndexes = IndexSet()
+		var moves = [(from: Int, to: Int)]()
+
+		for change in difference {
+			switch change {
+			case let .remove(offset, _, _):
+				removedIndexes.insert(offset)
+			case let .insert(offset, _, associatedWith):
+				insertedIndexes.insert(offset)
+				if let associatedWith {
+					moves.append((from: associatedWith, to: offset))
+				}
+			}
+		}
+
+		containerChanges.append(ContainerChange(parent: parent, removedIndexes: removedIndexes, insertedIndexes: insertedIndexes, moves: moves))
+	}
+}
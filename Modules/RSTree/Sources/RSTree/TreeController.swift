@@ -19,6 +19,14 @@ public typealias NodeVisitBlock = (_: Node) -> Void
 	private weak var delegate: TreeControllerDelegate?
 	public let rootNode: Node
 
+	/// Nodes by represented object, in tree order. Built on first lookup
+	/// after a rebuild changes the tree.
+	private var nodesByObject: [ObjectIdentifier: [Node]]?
+
+	/// Containers whose child nodes should be asked for again on the next
+	/// `rebuildDirtyNodes()`.
+	private var dirtyObjects = [ObjectIdentifier: AnyObject]()
+
 	public init(delegate: TreeControllerDelegate, rootNode: Node) {
 		self.delegate = delegate
 		self.rootNode = rootNode
@@ -33,7 +41,38 @@ public typealias NodeVisitBlock = (_: Node) -> Void
 	public func rebuild() -> Bool {
 		// Rebuild and re-sort. Return true if any changes in the entire tree.
 
-		return rebuildChildNodes(node: rootNode)
+		return !rebuildReportingChanges().isEmpty
+	}
+
+	/// Rebuilds the entire tree.
+	public func rebuildReportingChanges() -> TreeChanges {
+		dirtyObjects.removeAll()
+
+		var changes = TreeChanges()
+		rebuildChildNodes(node: rootNode, changes: &changes)
+		didRebuild(changes)
+		return changes
+	}
+
+	/// Marks the node (or nodes) representing `representedObject` as needing
+	/// its child nodes rebuilt — for instance, when a folder’s feeds change.
+	public func markDirty(_ representedObject: AnyObject) {
+		dirtyObjects[ObjectIdentifier(representedObject)] = representedObject
+	}
+
+	/// Rebuilds just the subtrees of nodes marked dirty. A dirty node inside
+	/// another dirty node’s subtree is rebuilt once, with its ancestor.
+	public func rebuildDirtyNodes() -> TreeChanges {
+		let dirtyObjects = self.dirtyObjects.values
+		self.dirtyObjects.removeAll()
+
+		let dirtyNodes = dirtyObjects.flatMap { nodesInTreeRepresentingObject($0) }
+		var changes = TreeChanges()
+		for node in normalizedSelectedNodes(dirtyNodes) {
+			rebuildChildNodes(node: node, changes: &changes)
+		}
+		didRebuild(changes)
+		return changes
 	}
 
 	public func visitNodes(_ visitBlock: NodeVisitBlock) {
@@ -58,7 +97,16 @@ public typealias NodeVisitBlock = (_: Node) -> Void
 	}
 
 	public func nodeInTreeRepresentingObject(_ representedObject: AnyObject) -> Node? {
-		return nodeInArrayRepresentingObject(nodes: [rootNode], representedObject: representedObject, recurse: true)
+		nodesInTreeRepresentingObject(representedObject).first
+	}
+
+	/// Every node representing `representedObject` — there may be more than
+	/// one, as when a feed is in several folders — in tree order.
+	public func nodesInTreeRepresentingObject(_ representedObject: AnyObject) -> [Node] {
+		if nodesByObject == nil {
+			buildNodesByObject()
+		}
+		return nodesByObject?[ObjectIdentifier(representedObject)] ?? [Node]()
 	}
 
 	public func normalizedSelectedNodes(_ nodes: [Node]) -> [Node] {
@@ -85,40 +133,42 @@ private extension TreeController {
 		}
 	}
 
-	func nodeArraysAreEqual(_ nodeArray1: [Node]?, _ nodeArray2: [Node]?) -> Bool {
-		if nodeArray1 == nil && nodeArray2 == nil {
-			return true
-		}
-		if nodeArray1 != nil && nodeArray2 == nil {
-			return false
-		}
-		if nodeArray1 == nil && nodeArray2 != nil {
-			return false
+	func buildNodesByObject() {
+		var nodesByObject = [ObjectIdentifier: [Node]]()
+		visitNode(rootNode) { node in
+			nodesByObject[ObjectIdentifier(node.representedObject), default: [Node]()].append(node)
 		}
+		self.nodesByObject = nodesByObject
+	}
 
-		return nodeArray1! == nodeArray2!
+	func didRebuild(_ changes: TreeChanges) {
+		if !changes.isEmpty {
+			nodesByObject = nil
+		}
 	}
 
-	func rebuildChildNodes(node: Node) -> Bool {
+	/// Changes are recorded only while `reportsChanges` is true. It’s false
+	/// below a newly inserted node, which is reported with its children.
+	func rebuildChildNodes(node: Node, reportsChanges: Bool = true, changes: inout TreeChanges) {
 		if !node.canHaveChildNodes {
-			return false
+			return
 		}
 
-		var childNodesDidChange = false
-
+		let oldChildNodes = node.childNodes
 		let childNodes = delegate?.treeController(treeController: self, childNodesFor: node) ?? [Node]()
 
-		childNodesDidChange = !nodeArraysAreEqual(childNodes, node.childNodes)
-		if childNodesDidChange {
+		var oldChildNodeSet: Set<Node>?
+		if childNodes != oldChildNodes {
 			node.childNodes = childNodes
+			if reportsChanges {
+				changes.append(parent: node, oldChildNodes: oldChildNodes, newChildNodes: childNodes)
+				oldChildNodeSet = Set(oldChildNodes)
+			}
 		}
 
 		for childNode in childNodes {
-			if rebuildChildNodes(node: childNode) {
-				childNodesDidChange = true
-			}
+			let isNew = oldChildNodeSet.map { !$0.contains(childNode) } ?? false
+			rebuildChildNodes(node: childNode, reportsChanges: reportsChanges && !isNew, changes: &changes)
 		}
-
-		return childNodesDidChange
 	}
 }
@@ -0,0 +1,56 @@
+//
+//  SyntheticTree.swift
+//  RSTreeTests
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import RSTree
+
+/// A stand-in for accounts, folders, and feeds.
+@MainActor final class TestItem {
+
+	let name: String
+	var children: [TestItem]?
+
+	init(name: String, children: [TestItem]? = nil) {
+		self.name = name
+		self.children = children
+	}
+
+	/// `containerCount` containers of `leavesPerContainer` leaves each.
+	static func syntheticRoot(containerCount: Int, leavesPerContainer: Int) -> TestItem {
+		let containers = (0..<containerCount).map { containerIndex in
+			TestItem(name: "Container \(containerIndex)", children: (0..<leavesPerContainer).map { TestItem(name: "Leaf \(containerIndex).\($0)") })
+		}
+		return TestItem(name: "Root", children: containers)
+	}
+}
+
+/// Builds child nodes from `TestItem.children`, reusing existing nodes,
+/// the way the app’s tree controller delegates do.
+@MainActor final class TestTreeControllerDelegate: TreeControllerDelegate {
+
+	let root: TestItem
+	private(set) var childNodesRequestCount = 0
+
+	init(root: TestItem) {
+		self.root = root
+	}
+
+	func treeController(treeController: TreeController, childNodesFor node: Node) -> [Node]? {
+		childNodesRequestCount += 1
+
+		let item = node.isRoot ? root : node.representedObject as! TestItem
+		return item.children?.map { child in
+			let childNode = node.existingOrNewChildNode(with: child)
+			childNode.canHaveChildNodes = child.children != nil
+			return childNode
+		}
+	}
+
+	func resetRequestCount() {
+		childNodesRequestCount = 0
+	}
+}
@@ -0,0 +1,53 @@
+//
+//  TreeControllerPerformanceTests.swift
+//  RSTreeTests
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import XCTest
+import RSTree
+
+// Performance tests stay in XCTest — Swift Testing doesn't have a `measure { }` equivalent yet.
+
+/// A 10,000-node sidebar: 100 folders of 100 feeds each.
+@MainActor final class TreeControllerPerformanceTests: XCTestCase {
+
+	private static let containerCount = 100
+	private static let leavesPerContainer = 100
+
+	func testFullRebuildOfUnchangedTree() {
+		let delegate = TestTreeControllerDelegate(root: TestItem.syntheticRoot(containerCount: Self.containerCount, leavesPerContainer: Self.leavesPerContainer))
+		let treeController = TreeController(delegate: delegate)
+
+		measure {
+			XCTAssertTrue(treeController.rebuildReportingChanges().isEmpty)
+		}
+	}
+
+	func testRebuildOfOneDirtyContainer() {
+		let root = TestItem.syntheticRoot(containerCount: Self.containerCount, leavesPerContainer: Self.leavesPerContainer)
+		let delegate = TestTreeControllerDelegate(root: root)
+		let treeController = TreeController(delegate: delegate)
+		let container = root.children![Self.containerCount / 2]
+
+		measure {
+			container.children!.reverse()
+			treeController.markDirty(container)
+			XCTAssertEqual(treeController.rebuildDirtyNodes().containerChanges.count, 1)
+		}
+	}
+
+	func testLookingUpEveryNode() {
+		let root = TestItem.syntheticRoot(containerCount: Self.containerCount, leavesPerContainer: Self.leavesPerContainer)
+		let delegate = TestTreeControllerDelegate(root: root)
+		let treeController = TreeController(delegate: delegate)
+		let leaves = root.children!.flatMap { $0.children! }
+
+		measure {
+			for leaf in leaves {
+				XCTAssertNotNil(treeController.nodeInTreeRepresentingObject(leaf))
+			}
+		}
+	}
+}
@@ -0,0 +1,107 @@
+//
+//  TreeControllerTests.swift
+//  RSTreeTests
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import Testing
+import RSTree
+
+@MainActor @Suite struct TreeControllerTests {
+
+	@Test func rebuildingUnchangedTreeReportsNoChanges() {
+		let delegate = TestTreeControllerDelegate(root: TestItem.syntheticRoot(containerCount: 3, leavesPerContainer: 4))
+		let treeController = TreeController(delegate: delegate)
+
+		#expect(treeController.rebuildReportingChanges().isEmpty)
+		#expect(!treeController.rebuild())
+	}
+
+	@Test func changesAreReportedPerContainer() throws {
+		let root = TestItem.syntheticRoot(containerCount: 3, leavesPerContainer: 4)
+		let delegate = TestTreeControllerDelegate(root: root)
+		let treeController = TreeController(delegate: delegate)
+
+		let container = root.children![1]
+		let removed = container.children!.removeFirst()
+		container.children!.append(TestItem(name: "New"))
+
+		let changes = treeController.rebuildReportingChanges()
+		#expect(changes.containerChanges.count == 1)
+
+		let change = try #require(changes.containerChanges.first)
+		#expect(change.parent.representedObject === container)
+		#expect(change.removedIndexes == IndexSet(integer: 0))
+		#expect(change.insertedIndexes == IndexSet(integer: 3))
+		#expect(change.moves.isEmpty)
+		#expect(treeController.nodeInTreeRepresentingObject(removed) == nil)
+	}
+
+	@Test func reorderingIsReportedAsMoves() throws {
+		let root = TestItem.syntheticRoot(containerCount: 1, leavesPerContainer: 4)
+		let delegate = TestTreeControllerDelegate(root: root)
+		let treeController = TreeController(delegate: delegate)
+
+		let container = root.children![0]
+		container.children!.swapAt(0, 3)
+
+		let change = try #require(treeController.rebuildReportingChanges().containerChanges.first)
+		#expect(change.parent.representedObject === container)
+		#expect(!change.moves.isEmpty)
+		#expect(change.removedIndexes.count == change.moves.count)
+		#expect(change.insertedIndexes.count == change.moves.count)
+	}
+
+	@Test func childrenOfInsertedNodesAreNotReportedSeparately() throws {
+		let root = TestItem.syntheticRoot(containerCount: 2, leavesPerContainer: 2)
+		let delegate = TestTreeControllerDelegate(root: root)
+		let treeController = TreeController(delegate: delegate)
+
+		root.children!.append(TestItem(name: "New Container", children: [TestItem(name: "New Leaf")]))
+
+		let changes = treeController.rebuildReportingChanges()
+		#expect(changes.containerChanges.count == 1)
+		#expect(changes.containerChanges.first?.parent === treeController.rootNode)
+		#expect(changes.containerChanges.first?.insertedIndexes == IndexSet(integer: 2))
+	}
+
+	@Test func rebuildingDirtyNodesOnlyVisitsTheirSubtrees() {
+		let root = TestItem.syntheticRoot(containerCount: 10, leavesPerContainer: 10)
+		let delegate = TestTreeControllerDelegate(root: root)
+		let treeController = TreeController(delegate: delegate)
+
+		let container = root.children![5]
+		let newLeaf = TestItem(name: "New")
+		container.children!.append(newLeaf)
+
+		delegate.resetRequestCount()
+		treeController.markDirty(container)
+		treeController.markDirty(container.children![0]) // A leaf inside a dirty container
+		let changes = treeController.rebuildDirtyNodes()
+
+		#expect(delegate.childNodesRequestCount == 1)
+		#expect(changes.containerChanges.count == 1)
+		#expect(treeController.nodeInTreeRepresentingObject(newLeaf)?.parent?.representedObject === container)
+
+		delegate.resetRequestCount()
+		#expect(treeController.rebuildDirtyNodes().isEmpty)
+		#expect(delegate.childNodesRequestCount == 0)
+	}
+
+	@Test func lookupFindsEveryNodeRepresentingAnObject() {
+		let shared = TestItem(name: "Shared")
+		let root = TestItem(name: "Root", children: [
+			TestItem(name: "A", children: [shared]),
+			TestItem(name: "B", children: [TestItem(name: "Other"), shared])
+		])
+		let delegate = TestTreeControllerDelegate(root: root)
+		let treeController = TreeController(delegate: delegate)
+
+		let nodes = treeController.nodesInTreeRepresentingObject(shared)
+		#expect(nodes.count == 2)
+		#expect(nodes.map { ($0.parent?.representedObject as? TestItem)?.name } == ["A", "B"])
+		#expect(treeController.nodeInTreeRepresentingObject(shared) === nodes.first)
+	}
+}
@@ -0,0 +1,60 @@
+//
+//  DownloadMetrics.swift
+//  RSWeb
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+
+/// Where a download’s time went, from `URLSessionTaskMetrics`.
+///
+/// Times are for the last transaction — the one after any redirects — and
+/// are nil for steps that didn’t happen, such as the DNS lookup and connect
+/// on a reused connection.
+public struct DownloadMetrics: Codable, Sendable {
+
+	public let domainLookupMilliseconds: Double?
+
+	/// Includes the TLS handshake.
+	public let connectMilliseconds: Double?
+
+	public let secureConnectionMilliseconds: Double?
+
+	/// From sending the request to the first byte of the response.
+	public let timeToFirstByteMilliseconds: Double?
+
+	/// From the first byte of the response to the last.
+	public let transferMilliseconds: Double?
+
+	/// The whole task, redirects included.
+	public let totalMilliseconds: Double
+
+	public let redirectCount: Int
+	public let isReusedConnection: Bool
+	public let responseBodyBytes: Int64
+
+	init(_ metrics: URLSessionTaskMetrics) {
+		let transaction = metrics.transactionMetrics.last
+
+		self.domainLookupMilliseconds = Self.milliseconds(transaction?.domainLookupStartDate, transaction?.domainLookupEndDate)
+		self.connectMilliseconds = Self.milliseconds(transaction?.connectStartDate, transaction?.connectEndDate)
+		self.secureConnectionMilliseconds = Self.milliseconds(transaction?.secureConnectionStartDate, transaction?.secureConnectionEndDate)
+		self.timeToFirstByteMilliseconds = Self.milliseconds(transaction?.requestStartDate, transaction?.responseStartDate)
+		self.transferMilliseconds = Self.milliseconds(transaction?.responseStartDate, transaction?.responseEndDate)
+		self.totalMilliseconds = metrics.taskInterval.duration * 1000
+		self.redirectCount = metrics.redirectCount
+		self.isReusedConnection = transaction?.isReusedConnection ?? false
+		self.responseBodyBytes = transaction?.countOfResponseBodyBytesReceived ?? 0
+	}
+}
+
+private extension DownloadMetrics {
+
+	static func milliseconds(_ startDate: Date?, _ endDate: Date?) -> Double? {
+		guard let startDate, let endDate else {
+			return nil
+		}
+		return endDate.timeIntervalSince(startDate) * 1000
+	}
+}
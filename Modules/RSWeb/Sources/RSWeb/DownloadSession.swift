@@ -20,11 +20,24 @@ import RSCore
 	func downloadSession(_ downloadSession: DownloadSession, didSkip url: URL, reason: String)
 	func downloadSession(_ downloadSession: DownloadSession, downloadDidComplete: URL, response: URLResponse?, data: Data, error: NSError?)
 	func downloadSession(_ downloadSession: DownloadSession, shouldContinueAfterReceivingData: Data, url: URL) -> Bool
+	func downloadSession(_ downloadSession: DownloadSession, didStopAfterReceivingData: Data, response: URLResponse?, url: URL)
 	func downloadSession(_ downloadSession: DownloadSession, httpError statusCode: Int, url: URL)
 	func downloadSession(_ downloadSession: DownloadSession, didFollowRedirectFor url: URL, from fromURL: URL, to toURL: URL, statusCode: Int)
+	func downloadSession(_ downloadSession: DownloadSession, didCollect metrics: DownloadMetrics, url: URL)
 	func downloadSessionDidComplete(_ downloadSession: DownloadSession)
 }
 
+public extension DownloadSessionDelegate {
+
+	/// Called when `shouldContinueAfterReceivingData` returns false, with what
+	/// arrived before the task was canceled. `downloadDidComplete` isn’t
+	/// called for a stopped task.
+	func downloadSession(_ downloadSession: DownloadSession, didStopAfterReceivingData: Data, response: URLResponse?, url: URL) {}
+
+	/// Called before `downloadDidComplete`, for tasks that weren’t canceled first.
+	func downloadSession(_ downloadSession: DownloadSession, didCollect metrics: DownloadMetrics, url: URL) {}
+}
+
 struct HTTP4xxResponse {
 	let statusCode: Int
 	let date: Date
@@ -42,6 +55,7 @@ struct HTTP4xxResponse {
 	private var taskIdentifierToInfoDictionary = [Int: DownloadInfo]()
 	private var urlsInSession = Set<URL>()
 	private let delegate: DownloadSessionDelegate
+	private let userAgentStyle: UserAgentStyle
 	private var redirectCache = [URL: URL]()
 	private var queue = [URL]()
 
@@ -61,10 +75,12 @@ struct HTTP4xxResponse {
 	private var http4xxResponses = [URL: HTTP4xxResponse]()
 
 	private static let logger = Logger(subsystem: Logger.nnwSubsystem, category: "DownloadSession")
+	private static let signposter = OSSignposter(subsystem: Logger.nnwSubsystem, category: .pointsOfInterest)
 
-	public init(delegate: DownloadSessionDelegate) {
+	public init(delegate: DownloadSessionDelegate, userAgentStyle: UserAgentStyle = .feed) {
 
 		self.delegate = delegate
+		self.userAgentStyle = userAgentStyle
 
 		super.init()
 
@@ -128,7 +144,7 @@ struct HTTP4xxResponse {
 			addDataTask(url)
 		}
 
-		urlsInSession = filteredURLs
+		urlsInSession.formUnion(filteredURLs)
 		updateProgress()
 	}
 }
@@ -156,6 +172,15 @@ extension DownloadSession: @preconcurrency URLSessionTaskDelegate {
 		}
 	}
 
+	public func urlSession(_ session: URLSession, task: URLSessionTask, didFinishCollecting metrics: URLSessionTaskMetrics) {
+		MainActor.assumeIsolated {
+			guard let info = infoForTask(task) else {
+				return
+			}
+			delegate.downloadSession(self, didCollect: DownloadMetrics(metrics), url: info.url)
+		}
+	}
+
 	private static let redirectStatusCodes = Set([HTTPResponseCode.redirectPermanent, HTTPResponseCode.redirectTemporary, HTTPResponseCode.redirectVeryTemporary, HTTPResponseCode.redirectPermanentPreservingMethod])
 
 	public func urlSession(_ session: URLSession, task: URLSessionTask, willPerformHTTPRedirection response: HTTPURLResponse, newRequest request: URLRequest, completionHandler: @escaping (URLRequest?) -> Void) {
@@ -232,6 +257,7 @@ extension DownloadSession: @preconcurrency URLSessionDataDelegate {
 
 			if !delegate.downloadSession(self, shouldContinueAfterReceivingData: info.data, url: info.url) {
 				dataTask.cancel()
+				delegate.downloadSession(self, didStopAfterReceivingData: info.data, response: info.urlResponse, url: info.url)
 				removeTask(dataTask)
 			}
 		}
@@ -268,6 +294,7 @@ private extension DownloadSession {
 			if let conditionalGetInfo = delegate.downloadSession(self, conditionalGetInfoFor: url) {
 				conditionalGetInfo.addRequestHeadersToURLRequest(&request)
 			}
+			request.setUserAgent(userAgentStyle)
 			request.addSpecialCaseUserAgentIfNeeded()
 			return request
 		}()
@@ -276,6 +303,7 @@ private extension DownloadSession {
 		let task = urlSession.dataTask(with: urlRequest)
 
 		let info = DownloadInfo(url)
+		info.signpostState = Self.signposter.beginInterval("Download", id: Self.signposter.makeSignpostID(), "\(urlToUse.absoluteString, privacy: .public)")
 		taskIdentifierToInfoDictionary[task.taskIdentifier] = info
 
 		tasksPending.insert(task)
@@ -294,6 +322,9 @@ private extension DownloadSession {
 	@MainActor func removeTask(_ task: URLSessionTask) {
 		tasksInProgress.remove(task)
 		tasksPending.remove(task)
+		if let signpostState = infoForTask(task)?.signpostState {
+			Self.signposter.endInterval("Download", signpostState)
+		}
 		taskIdentifierToInfoDictionary[task.taskIdentifier] = nil
 
 		addDataTaskFromQueueIfNecessary()
@@ -541,6 +572,7 @@ private final class DownloadInfo {
 	let url: URL
 	var data = Data()
 	var urlResponse: URLResponse?
+	var signpostState: OSSignpostIntervalState?
 
 	init(_ url: URL) {
 
@@ -15,15 +15,20 @@ public typealias DownloadCallback = @MainActor (DownloadResponse, Error?) -> Swi
 /// Simple downloader, for a one-shot download like an image
 /// or a web page. For a download-feeds session, see DownloadSession.
 /// Caches response for a short time for GET requests. May return cached response.
+/// GET responses are also cached on disk, and revalidated — see HTTPDiskCache.
 @MainActor public final class Downloader {
 	public static let shared = Downloader()
 	private let urlSession: URLSession
 	private var callbacks = [URL: [(callback: DownloadCallback, fromCache: Bool)]]()
-	private let cache = DownloadCache.shared
+	private let cache: DownloadCache
+	private let diskCache: HTTPDiskCache
 
 	nonisolated private static let logger = Logger(subsystem: Logger.nnwSubsystem, category: "Downloader")
 
-	private init() {
+	init(cache: DownloadCache = .shared, diskCache: HTTPDiskCache = .shared) {
+		self.cache = cache
+		self.diskCache = diskCache
+
 		let sessionConfiguration = URLSessionConfiguration.ephemeral
 		sessionConfiguration.requestCachePolicy = .reloadIgnoringLocalCacheData
 		sessionConfiguration.httpShouldSetCookies = false
@@ -102,35 +107,80 @@ public typealias DownloadCallback = @MainActor (DownloadResponse, Error?) -> Swi
 		}
 
 		var urlRequestToUse = urlRequest
-		switch userAgentStyle {
-		case .feed:
-			break // the session's user agent
-		case .specialCaseFeed:
-			urlRequestToUse.setValue(UserAgent.extendedUserAgent, forHTTPHeaderField: HTTPRequestHeader.userAgent)
-		case .browser:
-			urlRequestToUse.setValue(UserAgent.browserUserAgent, forHTTPHeaderField: HTTPRequestHeader.userAgent)
-		}
+		urlRequestToUse.setUserAgent(userAgentStyle)
 		urlRequestToUse.addSpecialCaseUserAgentIfNeeded() // Host requirements win over the requested style.
 
-		let task = urlSession.dataTask(with: urlRequestToUse) { (data, response, error) in
+		// A caller’s own conditional request wants the server’s answer, not ours.
+		let usesDiskCache = isCacheableRequest && urlRequest.value(forHTTPHeaderField: HTTPRequestHeader.ifNoneMatch) == nil && urlRequest.value(forHTTPHeaderField: HTTPRequestHeader.ifModifiedSince) == nil
+		guard usesDiskCache else {
+			startDataTask(urlRequestToUse, url: url, isCacheableRequest: isCacheableRequest, usesDiskCache: false)
+			return
+		}
 
-			// Don’t cache errors — a retry should hit the network.
-			if isCacheableRequest && error == nil {
-				Self.logger.debug("Downloader: caching response for \(url)")
-				self.cache.add(url.absoluteString, data: data, response: response)
+		let request = urlRequestToUse
+		Task { @MainActor in
+			switch await diskCache.lookup(url) {
+			case .fresh(let data, let response):
+				Self.logger.debug("Downloader: returning disk-cached response for \(url)")
+				cache.add(url.absoluteString, data: data, response: response)
+				callAndReleaseCallbacks(url, data, response, returnedFromCache: true)
+			case .stale(let conditionalGetInfo):
+				var conditionalRequest = request
+				conditionalGetInfo.addRequestHeadersToURLRequest(&conditionalRequest)
+				startDataTask(conditionalRequest, url: url, isCacheableRequest: true, usesDiskCache: true, unconditionalRequest: request)
+			case .miss:
+				startDataTask(request, url: url, isCacheableRequest: true, usesDiskCache: true)
 			}
+		}
+	}
+}
+
+private extension Downloader {
 
+	/// `unconditionalRequest` is set when `urlRequest` carries validators from
+	/// the disk cache: it’s the request to make if the 304 comes back after
+	/// the stored response is gone.
+	func startDataTask(_ urlRequest: URLRequest, url: URL, isCacheableRequest: Bool, usesDiskCache: Bool, unconditionalRequest: URLRequest? = nil) {
+		let task = urlSession.dataTask(with: urlRequest) { (data, response, error) in
 			Task { @MainActor in
+				var data = data
+				var response = response
+				var isBareNotModified = false
+
+				if usesDiskCache, error == nil, let httpResponse = response as? HTTPURLResponse {
+					// Stores a reusable response. A 304 becomes the stored response.
+					switch await self.diskCache.update(url, data: data, response: httpResponse) {
+					case .revalidated(let cachedData, let cachedResponse):
+						Self.logger.debug("Downloader: revalidated disk-cached response for \(url)")
+						data = cachedData
+						response = cachedResponse
+					case .notModifiedButMissing:
+						if let unconditionalRequest {
+							Self.logger.debug("Downloader: disk-cached response for \(url) is gone — requesting it again")
+							self.startDataTask(unconditionalRequest, url: url, isCacheableRequest: isCacheableRequest, usesDiskCache: true)
+							return
+						}
+						// The server’s answer to a request without our validators —
+						// passed on, but not worth keeping.
+						isBareNotModified = true
+					case .useResponse:
+						break
+					}
+				}
+
+				// Don’t cache errors — a retry should hit the network.
+				if isCacheableRequest && error == nil && !isBareNotModified {
+					Self.logger.debug("Downloader: caching response for \(url)")
+					self.cache.add(url.absoluteString, data: data, response: response)
+				}
+
 				self.callAndReleaseCallbacks(url, data, response, error)
 			}
 		}
 		task.resume()
 	}
-}
-
-private extension Downloader {
 
-	func callAndReleaseCallbacks(_ url: URL, _ data: Data? = nil, _ response: URLResponse? = nil, _ error: Error? = nil) {
+	func callAndReleaseCallbacks(_ url: URL, _ data: Data? = nil, _ response: URLResponse? = nil, _ error: Error? = nil, returnedFromCache: Bool = false) {
 		assert(Thread.isMainThread)
 
 		guard let callbacksForURL = callbacks[url] else {
@@ -150,7 +200,7 @@ private extension Downloader {
 		}
 
 		for entry in callbacksForURL {
-			let downloadResponse = DownloadResponse(data: data, response: response, returnedFromCache: entry.fromCache)
+			let downloadResponse = DownloadResponse(data: data, response: response, returnedFromCache: returnedFromCache || entry.fromCache)
 			entry.callback(downloadResponse, error)
 		}
 	}
@@ -0,0 +1,177 @@
+//
+//  HTMLHeadDownloader.swift
+//  RSWeb
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import os
+import RSCore
+import RSParser
+
+/// Downloads just the `<head>` of a web page. The transfer is canceled once
+/// `</head>` or `<body>` arrives, or after `maximumHeadLength` bytes.
+///
+/// For favicon, feed-link, and OpenGraph discovery — all of which live in
+/// the head, while the rest of a home page is often a megabyte or more.
+///
+/// Built on `DownloadSession`: each chunk goes through an `HTMLHeadScanner`
+/// in `shouldContinueAfterReceivingData`. Unlike `Downloader`, responses
+/// aren’t cached — the next caller might need the whole page.
+@MainActor public final class HTMLHeadDownloader {
+
+	public static let shared = HTMLHeadDownloader(userAgentStyle: .browser)
+
+	/// Stop here even if the head hasn’t ended. Generous — heads with inline
+	/// styles and scripts can run to a few hundred KB.
+	public static let maximumHeadLength = 512 * 1024
+
+	private let userAgentStyle: UserAgentStyle
+	private lazy var downloadSession = DownloadSession(delegate: self, userAgentStyle: userAgentStyle)
+	private var downloads = [URL: HeadDownload]()
+
+	nonisolated private static let logger = Logger(subsystem: Logger.nnwSubsystem, category: "HTMLHeadDownloader")
+
+	public init(userAgentStyle: UserAgentStyle) {
+		self.userAgentStyle = userAgentStyle
+	}
+
+	/// Downloads `url` through the end of its head.
+	///
+	/// `shouldStopAfterHead` gets the head once it has arrived; return false
+	/// to download the rest of the page after all. The response’s data is the
+	/// head if the download stopped early, otherwise the whole page.
+	public func download(_ url: URL, shouldStopAfterHead: @escaping @MainActor (Data) -> Bool = { _ in true }) async throws -> DownloadResponse {
+
+		// DownloadSession rations openrss.org requests per session, and skips
+		// non-http URLs without a callback. Downloader handles both.
+		if url.isOpenRSSOrgURL || !url.isHTTPOrHTTPSURL() {
+			return try await Downloader.shared.download(url, userAgentStyle: userAgentStyle)
+		}
+
+		return try await withCheckedThrowingContinuation { continuation in
+			if let download = downloads[url] {
+				// Coalesce onto the download in progress, as Downloader does.
+				Self.logger.debug("HTMLHeadDownloader: download in progress for \(url) — adding continuation")
+				download.continuations.append((continuation, true))
+				return
+			}
+
+			downloads[url] = HeadDownload(continuation, shouldStopAfterHead: shouldStopAfterHead)
+			downloadSession.download([url])
+		}
+	}
+}
+
+// MARK: - DownloadSessionDelegate
+
+extension HTMLHeadDownloader: DownloadSessionDelegate {
+
+	public func downloadSession(_ downloadSession: DownloadSession, conditionalGetInfoFor: URL) -> HTTPConditionalGetInfo? {
+		nil
+	}
+
+	public func downloadSession(_ downloadSession: DownloadSession, didReceiveResponse url: URL) {
+	}
+
+	public func downloadSession(_ downloadSession: DownloadSession, didSkip url: URL, reason: String) {
+		Self.logger.debug("HTMLHeadDownloader: skipped \(url) — \(reason)")
+		finish(url, data: nil, response: nil)
+	}
+
+	public func downloadSession(_ downloadSession: DownloadSession, downloadDidComplete url: URL, response: URLResponse?, data: Data, error: NSError?) {
+		if let error {
+			finish(url, error: error)
+		} else {
+			finish(url, data: data, response: response)
+		}
+	}
+
+	public func downloadSession(_ downloadSession: DownloadSession, shouldContinueAfterReceivingData data: Data, url: URL) -> Bool {
+		guard let download = downloads[url], !download.readsWholePage else {
+			return true
+		}
+
+		var headLength = download.scanner.scan(data)
+		if headLength == nil && data.count >= Self.maximumHeadLength {
+			headLength = data.count
+		}
+		guard let headLength else {
+			return true
+		}
+
+		let head = data.prefix(headLength)
+		if download.shouldStopAfterHead(head) {
+			download.head = head
+			return false
+		}
+		download.readsWholePage = true
+		return true
+	}
+
+	public func downloadSession(_ downloadSession: DownloadSession, didStopAfterReceivingData data: Data, response: URLResponse?, url: URL) {
+		let head = downloads[url]?.head ?? data
+		Self.logger.debug("HTMLHeadDownloader: stopped \(url) after \(data.count) bytes — head is \(head.count) bytes")
+		finish(url, data: head, response: response)
+	}
+
+	public func downloadSession(_ downloadSession: DownloadSession, httpError statusCode: Int, url: URL) {
+		// The session cancels the task without calling downloadDidComplete.
+		let response = HTTPURLResponse(url: url, statusCode: statusCode, httpVersion: nil, headerFields: nil)
+		finish(url, data: nil, response: response)
+	}
+
+	public func downloadSession(_ downloadSession: DownloadSession, didFollowRedirectFor url: URL, from fromURL: URL, to toURL: URL, statusCode: Int) {
+	}
+
+	public func downloadSessionDidComplete(_ downloadSession: DownloadSession) {
+		// Tasks the session cancels on its own — the rest of a host’s tasks
+		// after a 429 — end without a callback. Nothing is running now.
+		for url in downloads.keys {
+			finish(url, data: nil, response: nil)
+		}
+	}
+}
+
+// MARK: - Private
+
+private extension HTMLHeadDownloader {
+
+	func finish(_ url: URL, data: Data?, response: URLResponse?) {
+		for (continuation, coalesced) in removeContinuations(url) {
+			continuation.resume(returning: DownloadResponse(data: data, response: response, returnedFromCache: coalesced))
+		}
+	}
+
+	func finish(_ url: URL, error: Error) {
+		for (continuation, _) in removeContinuations(url) {
+			continuation.resume(throwing: error)
+		}
+	}
+
+	func removeContinuations(_ url: URL) -> [HeadDownload.Continuation] {
+		guard let download = downloads.removeValue(forKey: url) else {
+			return []
+		}
+		return download.continuations
+	}
+}
+
+@MainActor private final class HeadDownload {
+
+	typealias Continuation = (continuation: CheckedContinuation<DownloadResponse, Error>, coalesced: Bool)
+
+	var continuations: [Continuation]
+	let shouldStopAfterHead: @MainActor (Data) -> Bool
+	var scanner = HTMLHeadScanner()
+	var head: Data?
+
+	/// Set when `shouldStopAfterHead` said no.
+	var readsWholePage = false
+
+	init(_ continuation: CheckedContinuation<DownloadResponse, Error>, shouldStopAfterHead: @escaping @MainActor (Data) -> Bool) {
+		self.continuations = [(continuation, false)]
+		self.shouldStopAfterHead = shouldStopAfterHead
+	}
+}
@@ -0,0 +1,325 @@
+//
+//  HTTPDiskCache.swift
+//  RSWeb
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import os
+import RSCore
+
+/// Persistent response cache for `Downloader`, so the home pages, favicons,
+/// and avatars we fetched yesterday aren’t downloaded again today.
+///
+/// Keyed by URL. A 200 response is stored when it can be reused: it has a
+/// validator (ETag or Last-Modified) or a Cache-Control max-age, and isn’t
+/// marked `no-store`. A stored response is served without a request while
+/// its max-age lasts (capped at `maximumFreshness`). After that it’s
+/// revalidated with a conditional GET, and a 304 gets the stored body.
+///
+/// One file per URL, in the caches folder. When the total passes
+/// `maximumSize`, the least recently used files are deleted.
+public final actor HTTPDiskCache {
+
+	@MainActor public static let shared = HTTPDiskCache(folder: AppConfig.cacheSubfolder(named: "HTTPCache"))
+
+	public nonisolated let folder: URL
+	public private(set) var statistics = HTTPDiskCacheStatistics()
+
+	/// Total size of the cache folder before eviction starts.
+	static let defaultMaximumSize = 64 * 1024 * 1024
+
+	/// Larger responses aren’t stored — they’d push out many small ones.
+	static let maximumEntrySize = 4 * 1024 * 1024
+
+	/// Sites sometimes send a max-age of a year by mistake.
+	static let maximumFreshness: TimeInterval = 60 * 60 * 24
+
+	private let maximumSize: Int
+	private var index: [String: IndexEntry]? // Loaded on first use.
+	private var totalSize = 0
+
+	private static let logger = Logger(subsystem: Logger.nnwSubsystem, category: "HTTPDiskCache")
+
+	private struct IndexEntry {
+		var size: Int
+		var lastUsed: Date
+	}
+
+	init(folder: URL, maximumSize: Int = defaultMaximumSize) {
+		self.folder = folder
+		self.maximumSize = maximumSize
+
+		NotificationCenter.default.addObserver(self, selector: #selector(handleAppDidGoToBackground(_:)), name: .appDidGoToBackground, object: nil)
+	}
+
+	@objc nonisolated func handleAppDidGoToBackground(_ notification: Notification) {
+		Task {
+			await logStatistics()
+		}
+	}
+
+	public enum Lookup: Sendable {
+		/// Use this response — no request needed.
+		case fresh(data: Data, response: HTTPURLResponse)
+		/// Make a conditional request with these validators.
+		case stale(HTTPConditionalGetInfo)
+		case miss
+	}
+
+	/// Call before requesting `url`.
+	public func lookup(_ url: URL) -> Lookup {
+		guard let entry = readEntry(url) else {
+			return .miss
+		}
+		if entry.isFresh {
+			statistics.freshHits += 1
+			statistics.bytesSaved += entry.data.count
+			return .fresh(data: entry.data, response: entry.httpURLResponse)
+		}
+		if let conditionalGetInfo = entry.conditionalGetInfo {
+			return .stale(conditionalGetInfo)
+		}
+		return .miss
+	}
+
+	public enum Update: Sendable {
+		/// A 304 — use the stored response in its place.
+		case revalidated(data: Data, response: HTTPURLResponse)
+		/// A 304, but the stored response is gone — evicted or removed while
+		/// the request was in flight. There’s no body to go with it, so the
+		/// request has to be made again without validators.
+		case notModifiedButMissing
+		/// Use the response as is.
+		case useResponse
+	}
+
+	/// Call with the response to a request for `url`. Stores a reusable 200.
+	@discardableResult
+	public func update(_ url: URL, data: Data?, response: HTTPURLResponse) -> Update {
+		if response.statusCode == HTTPResponseCode.notModified {
+			guard var entry = readEntry(url) else {
+				Self.logger.info("HTTPDiskCache: 304 for \(url, privacy: .public), but no stored response")
+				return .notModifiedButMissing
+			}
+			entry.revalidate(with: response)
+			writeEntry(entry, for: url)
+			statistics.revalidatedHits += 1
+			statistics.bytesSaved += entry.data.count
+			return .revalidated(data: entry.data, response: entry.httpURLResponse)
+		}
+
+		statistics.misses += 1
+		if let data, let entry = HTTPDiskCacheEntry(data: data, response: response) {
+			writeEntry(entry, for: url)
+		} else if response.statusIsOK {
+			removeEntry(url) // Replaced by something we don’t store.
+		}
+		return .useResponse
+	}
+
+	public func removeAll() {
+		try? FileManager.default.removeItem(at: folder)
+		try? FileManager.default.createDirectory(at: folder, withIntermediateDirectories: true)
+		index = [:]
+		totalSize = 0
+	}
+}
+
+/// Cache effectiveness since launch.
+public struct HTTPDiskCacheStatistics: Equatable, Sendable {
+
+	/// Served from disk without a request.
+	public var freshHits = 0
+
+	/// Revalidated — the server answered 304 Not Modified.
+	public var revalidatedHits = 0
+
+	/// Full downloads.
+	public var misses = 0
+
+	/// Body bytes not downloaded thanks to hits.
+	public var bytesSaved = 0
+
+	public var requests: Int {
+		freshHits + revalidatedHits + misses
+	}
+
+	public var hitRate: Double {
+		requests == 0 ? 0 : Double(freshHits + revalidatedHits) / Double(requests)
+	}
+}
+
+// MARK: - Private
+
+private extension HTTPDiskCache {
+
+	func fileURL(_ key: String) -> URL {
+		folder.appendingPathComponent(key, isDirectory: false)
+	}
+
+	func readEntry(_ url: URL) -> HTTPDiskCacheEntry? {
+		let key = url.absoluteString.md5String
+		loadIndexIfNeeded()
+		guard index?[key] != nil else {
+			return nil
+		}
+
+		let fileURL = fileURL(key)
+		guard let data = try? Data(contentsOf: fileURL), let entry = try? PropertyListDecoder().decode(HTTPDiskCacheEntry.self, from: data) else {
+			Self.logger.error("HTTPDiskCache: could not read entry for \(url, privacy: .public)")
+			removeEntry(url)
+			return nil
+		}
+
+		let now = Date()
+		index?[key]?.lastUsed = now
+		try? FileManager.default.setAttributes([.modificationDate: now], ofItemAtPath: fileURL.path)
+		return entry
+	}
+
+	func writeEntry(_ entry: HTTPDiskCacheEntry, for url: URL) {
+		let key = url.absoluteString.md5String
+		loadIndexIfNeeded()
+
+		let encoder = PropertyListEncoder()
+		encoder.outputFormat = .binary
+		do {
+			let data = try encoder.encode(entry)
+			try data.write(to: fileURL(key), options: .atomic)
+			totalSize += data.count - (index?[key]?.size ?? 0)
+			index?[key] = IndexEntry(size: data.count, lastUsed: Date())
+		} catch {
+			Self.logger.error("HTTPDiskCache: could not write entry for \(url, privacy: .public): \(error.localizedDescription)")
+			return
+		}
+
+		evictIfNeeded()
+	}
+
+	func removeEntry(_ url: URL) {
+		let key = url.absoluteString.md5String
+		try? FileManager.default.removeItem(at: fileURL(key))
+		if let removed = index?.removeValue(forKey: key) {
+			totalSize -= removed.size
+		}
+	}
+
+	/// The index is the folder listing — file sizes, and modification dates
+	/// as last-used dates — so there’s nothing extra to keep consistent.
+	func loadIndexIfNeeded() {
+		guard index == nil else {
+			return
+		}
+
+		var index = [String: IndexEntry]()
+		var totalSize = 0
+		let keys: [URLResourceKey] = [.fileSizeKey, .contentModificationDateKey]
+		let fileURLs = (try? FileManager.default.contentsOfDirectory(at: folder, includingPropertiesForKeys: keys)) ?? []
+		for fileURL in fileURLs {
+			guard let values = try? fileURL.resourceValues(forKeys: Set(keys)), let size = values.fileSize else {
+				continue
+			}
+			index[fileURL.lastPathComponent] = IndexEntry(size: size, lastUsed: values.contentModificationDate ?? .distantPast)
+			totalSize += size
+		}
+
+		self.index = index
+		self.totalSize = totalSize
+	}
+
+	/// Deletes least recently used files down to 90% of `maximumSize`, so
+	/// eviction doesn’t run on every write once the cache is full.
+	func evictIfNeeded() {
+		guard totalSize > maximumSize, let index else {
+			return
+		}
+
+		let targetSize = maximumSize / 10 * 9
+		var evictedCount = 0
+		for (key, entry) in index.sorted(by: { $0.value.lastUsed < $1.value.lastUsed }) {
+			if totalSize <= targetSize {
+				break
+			}
+			try? FileManager.default.removeItem(at: fileURL(key))
+			self.index?[key] = nil
+			totalSize -= entry.size
+			evictedCount += 1
+		}
+
+		Self.logger.info("HTTPDiskCache: evicted \(evictedCount) entries")
+	}
+
+	func logStatistics() {
+		let statistics = statistics
+		guard statistics.requests > 0 else {
+			return
+		}
+		Self.logger.info("HTTPDiskCache: \(statistics.requests) requests, hit rate \(statistics.hitRate * 100, format: .fixed(precision: 1))% (\(statistics.freshHits) fresh, \(statistics.revalidatedHits) revalidated), \(statistics.bytesSaved) bytes saved, \(self.totalSize) bytes on disk")
+	}
+}
+
+// MARK: - HTTPDiskCacheEntry
+
+struct HTTPDiskCacheEntry: Codable, Sendable {
+
+	let url: URL // After redirects
+	let statusCode: Int
+	let headerFields: [String: String]
+	let data: Data
+	var conditionalGetInfo: HTTPConditionalGetInfo?
+	var cacheControlInfo: CacheControlInfo?
+
+	var isFresh: Bool {
+		guard let cacheControlInfo else {
+			return false
+		}
+		return !cacheControlInfo.canResume(maxMaxAge: HTTPDiskCache.maximumFreshness)
+	}
+
+	var httpURLResponse: HTTPURLResponse {
+		HTTPURLResponse(url: url, statusCode: statusCode, httpVersion: "HTTP/1.1", headerFields: headerFields)!
+	}
+
+	/// Nil if `response` isn’t worth storing.
+	init?(data: Data, response: HTTPURLResponse) {
+		guard response.statusCode == HTTPResponseCode.OK, data.count <= HTTPDiskCache.maximumEntrySize, let url = response.url else {
+			return nil
+		}
+		if let cacheControl = response.valueForHTTPHeaderField(HTTPResponseHeader.cacheControl), cacheControl.localizedCaseInsensitiveContains("no-store") {
+			return nil
+		}
+
+		let conditionalGetInfo = HTTPConditionalGetInfo(urlResponse: response)
+		let cacheControlInfo = CacheControlInfo(urlResponse: response)
+		guard conditionalGetInfo != nil || cacheControlInfo != nil else {
+			return nil
+		}
+
+		self.url = url
+		self.statusCode = response.statusCode
+		self.headerFields = Self.headerFields(response)
+		self.data = data
+		self.conditionalGetInfo = conditionalGetInfo
+		self.cacheControlInfo = cacheControlInfo
+	}
+
+	/// A 304 restarts the max-age clock, and may carry new validators.
+	mutating func revalidate(with response: HTTPURLResponse) {
+		cacheControlInfo = CacheControlInfo(urlResponse: response)
+		if let updatedConditionalGetInfo = HTTPConditionalGetInfo(urlResponse: response) {
+			conditionalGetInfo = updatedConditionalGetInfo
+		}
+	}
+
+	static func headerFields(_ response: HTTPURLResponse) -> [String: String] {
+		var headerFields = [String: String]()
+		for (key, value) in response.allHeaderFields {
+			if let key = key as? String, let value = value as? String {
+				headerFields[key] = value
+			}
+		}
+		return headerFields
+	}
+}
@@ -44,3 +44,19 @@ nonisolated public struct UserAgent {
 		return [HTTPRequestHeader.userAgent: userAgent]
 	}
 }
+
+extension URLRequest {
+
+	/// Sets the User-Agent header for `style`. `.feed` leaves the session’s
+	/// user agent in place.
+	@MainActor mutating func setUserAgent(_ style: UserAgentStyle) {
+		switch style {
+		case .feed:
+			break // the session's user agent
+		case .specialCaseFeed:
+			setValue(UserAgent.extendedUserAgent, forHTTPHeaderField: HTTPRequestHeader.userAgent)
+		case .browser:
+			setValue(UserAgent.browserUserAgent, forHTTPHeaderField: HTTPRequestHeader.userAgent)
+		}
+	}
+}
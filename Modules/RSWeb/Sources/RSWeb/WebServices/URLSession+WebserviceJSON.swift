@@ -7,9 +7,14 @@
 //
 
 import Foundation
+import os
+import RSCore
 
 nonisolated extension URLSession {
 
+	private static let jsonLogger = Logger(subsystem: Logger.nnwSubsystem, category: "WebserviceJSON")
+	private static let jsonSignposter = OSSignposter(subsystem: Logger.nnwSubsystem, category: .pointsOfInterest)
+
 	/// Send an HTTP GET and return JSON object(s).
 	public func send<R: Decodable & Sendable>(request: URLRequest, resultType: R.Type, dateDecoding: JSONDecoder.DateDecodingStrategy = .iso8601, keyDecoding: JSONDecoder.KeyDecodingStrategy = .useDefaultKeys) async throws -> (HTTPURLResponse, R?) {
 
@@ -51,6 +56,17 @@ nonisolated extension URLSession {
 	@concurrent
 	private static func decode<R: Decodable & Sendable>(_ type: R.Type, from data: Data, dateDecoding: JSONDecoder.DateDecodingStrategy, keyDecoding: JSONDecoder.KeyDecodingStrategy) async throws -> R {
 		assert(!Thread.isMainThread, "JSON decoding should not happen on the main thread.")
+
+		// Sync pages can be megabytes of article bodies. The signpost and
+		// log line give the decode time for each page.
+		let signpostState = jsonSignposter.beginInterval("Decode JSON", id: jsonSignposter.makeSignpostID(), "\(String(describing: R.self), privacy: .public)")
+		let startTime = Date()
+		defer {
+			jsonSignposter.endInterval("Decode JSON", signpostState)
+			let milliseconds = Date().timeIntervalSince(startTime) * 1000
+			jsonLogger.debug("WebserviceJSON: decoded \(String(describing: R.self), privacy: .public) — \(data.count) bytes in \(milliseconds, format: .fixed(precision: 1), privacy: .public) ms")
+		}
+
 		let decoder = JSONDecoder()
 		decoder.dateDecodingStrategy = dateDecoding
 		decoder.keyDecodingStrategy = keyDecoding
@@ -0,0 +1,100 @@
+//
+//  HTMLHeadDownloaderTests.swift
+//  RSWebTests
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Testing
+import Foundation
+@testable import RSWeb
+
+@Suite(.serialized) @MainActor struct HTMLHeadDownloaderTests {
+
+	/// A home page with a small head and a 2 MB body.
+	static let head = """
+	<!DOCTYPE html>
+	<html><head><title>Home</title>
+	<link rel="icon" href="/favicon.ico">
+	<link rel="alternate" type="application/rss+xml" href="/feed.xml">
+	<script>if (a </head> b) {}</script>
+
+	"""
+	static let page: Data = {
+		let paragraph = "<p>Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor.</p>\n"
+		let body = String(repeating: paragraph, count: 2 * 1024 * 1024 / paragraph.utf8.count)
+		return Data((head + "</head>\n<body>\n" + body + "</body></html>\n").utf8)
+	}()
+
+	@Test func stopsAfterHead() async throws {
+		let server = try await LocalHTTPServer(bodies: ["/": Self.page])
+		let downloader = HTMLHeadDownloader(userAgentStyle: .feed)
+
+		let downloadResponse = try await downloader.download(server.url("/"))
+
+		#expect(downloadResponse.response?.statusIsOK == true)
+		#expect(downloadResponse.data == Data(Self.head.utf8))
+
+		// Give the server time to notice the client went away.
+		try await Task.sleep(for: .milliseconds(100))
+		#expect(server.bytesSent < Self.page.count / 4)
+	}
+
+	@Test func fullDownloadSendsWholePage() async throws {
+		// The baseline for the test above.
+		let server = try await LocalHTTPServer(bodies: ["/": Self.page])
+
+		let downloadResponse = try await Downloader.shared.download(server.url("/"))
+
+		#expect(downloadResponse.data == Self.page)
+		try await Task.sleep(for: .milliseconds(100))
+		#expect(server.bytesSent == Self.page.count)
+	}
+
+	@Test func readsWholePageWhenHeadIsNotEnough() async throws {
+		let server = try await LocalHTTPServer(bodies: ["/": Self.page])
+		let downloader = HTMLHeadDownloader(userAgentStyle: .feed)
+
+		let downloadResponse = try await downloader.download(server.url("/")) { head in
+			#expect(head == Data(Self.head.utf8))
+			return false
+		}
+
+		#expect(downloadResponse.data == Self.page)
+	}
+
+	@Test func stopsAtMaximumHeadLength() async throws {
+		let text = Data(String(repeating: "No markup here. ", count: 2 * 1024 * 1024 / 16).utf8)
+		let server = try await LocalHTTPServer(bodies: ["/text": text])
+		let downloader = HTMLHeadDownloader(userAgentStyle: .feed)
+
+		let data = try #require(try await downloader.download(server.url("/text")).data)
+
+		#expect(data.count >= HTMLHeadDownloader.maximumHeadLength)
+		#expect(data.count < text.count)
+		#expect(data == text.prefix(data.count))
+	}
+
+	@Test func httpErrorReturnsStatusCode() async throws {
+		let server = try await LocalHTTPServer(bodies: [:])
+		let downloader = HTMLHeadDownloader(userAgentStyle: .feed)
+
+		let downloadResponse = try await downloader.download(server.url("/missing"))
+
+		#expect(downloadResponse.response?.forcedStatusCode == 404)
+		#expect(downloadResponse.data == nil)
+	}
+
+	@Test func concurrentDownloadsOfOneURLAreCoalesced() async throws {
+		let server = try await LocalHTTPServer(bodies: ["/": Self.page])
+		let downloader = HTMLHeadDownloader(userAgentStyle: .feed)
+		let url = server.url("/")
+
+		async let first = downloader.download(url)
+		async let second = downloader.download(url)
+		let responses = try await [first, second]
+
+		#expect(responses.map(\.data) == [Data(Self.head.utf8), Data(Self.head.utf8)])
+		#expect(responses.map(\.returnedFromCache).sorted { !$0 && $1 } == [false, true])
+	}
+}
@@ -0,0 +1,213 @@
+//
+//  HTTPDiskCacheTests.swift
+//  RSWebTests
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Testing
+import Foundation
+@testable import RSWeb
+
+@Suite final class HTTPDiskCacheTests {
+
+	let url = URL(string: "https://example.com/favicon.ico")!
+	private var folders = [URL]()
+
+	deinit {
+		for folder in folders {
+			try? FileManager.default.removeItem(at: folder)
+		}
+	}
+
+	@Test func freshResponseIsServedWithoutRequest() async {
+		let cache = makeCache()
+		let body = Data("icon".utf8)
+
+		#expect(isMiss(await cache.lookup(url)))
+		#expect(isUseResponse(await cache.update(url, data: body, response: response(200, ["Cache-Control": "max-age=3600"]))))
+
+		guard case .fresh(let data, let cachedResponse) = await cache.lookup(url) else {
+			Issue.record("Expected a fresh hit")
+			return
+		}
+		#expect(data == body)
+		#expect(cachedResponse.statusCode == 200)
+		#expect(cachedResponse.url == url)
+	}
+
+	@Test func staleResponseIsRevalidated() async throws {
+		let cache = makeCache()
+		let body = Data("<html></html>".utf8)
+		_ = await cache.update(url, data: body, response: response(200, ["ETag": "\"abc\"", "Last-Modified": "Sat, 17 Oct 2026 10:00:00 GMT"]))
+
+		guard case .stale(let conditionalGetInfo) = await cache.lookup(url) else {
+			Issue.record("Expected a stale entry")
+			return
+		}
+		#expect(conditionalGetInfo.etag == "\"abc\"")
+
+		guard case .revalidated(let data, let revalidatedResponse) = await cache.update(url, data: Data(), response: response(304, ["ETag": "\"abc\""])) else {
+			Issue.record("Expected a revalidated response")
+			return
+		}
+		#expect(data == body)
+		#expect(revalidatedResponse.statusCode == 200)
+
+		let statistics = await cache.statistics
+		#expect(statistics.revalidatedHits == 1)
+		#expect(statistics.misses == 1)
+		#expect(statistics.bytesSaved == body.count)
+		#expect(statistics.hitRate == 0.5)
+	}
+
+	@Test func notModifiedAfterRemoveAllHasNoStoredResponse() async {
+		let cache = makeCache()
+		_ = await cache.update(url, data: Data("<html></html>".utf8), response: response(200, ["ETag": "\"abc\""]))
+		guard case .stale = await cache.lookup(url) else {
+			Issue.record("Expected a stale entry")
+			return
+		}
+
+		// Cleared while the conditional request is in flight.
+		await cache.removeAll()
+
+		guard case .notModifiedButMissing = await cache.update(url, data: Data(), response: response(304, ["ETag": "\"abc\""])) else {
+			Issue.record("Expected a 304 without a stored response")
+			return
+		}
+		#expect(isMiss(await cache.lookup(url)))
+		#expect(await cache.statistics.revalidatedHits == 0)
+	}
+
+	@Test func notModifiedAfterEvictionHasNoStoredResponse() async throws {
+		let cache = makeCache(maximumSize: 20 * 1024)
+		let body = Data(repeating: 0x41, count: 12 * 1024)
+		_ = await cache.update(url, data: body, response: response(200, ["ETag": "\"abc\""]))
+		guard case .stale = await cache.lookup(url) else {
+			Issue.record("Expected a stale entry")
+			return
+		}
+
+		// Pushed out while the conditional request is in flight.
+		try await Task.sleep(for: .milliseconds(10))
+		let other = URL(string: "https://example.com/other")!
+		_ = await cache.update(other, data: body, response: response(200, ["Cache-Control": "max-age=3600"], url: other))
+
+		guard case .notModifiedButMissing = await cache.update(url, data: Data(), response: response(304, ["ETag": "\"abc\""])) else {
+			Issue.record("Expected a 304 without a stored response")
+			return
+		}
+	}
+
+	@Test @MainActor func downloaderRequestsAgainWhenStoredResponseIsGoneBefore304() async throws {
+		let cache = makeCache()
+		let body = Data("<html></html>".utf8)
+		let etag = "\"v1\""
+
+		// Holds the conditional request until the stored response is gone,
+		// so its 304 arrives after.
+		let server = try await LocalHTTPServer(bodies: ["/": body], etag: etag) { ifNoneMatch in
+			guard ifNoneMatch != nil else {
+				return
+			}
+			let removed = DispatchSemaphore(value: 0)
+			Task {
+				await cache.removeAll()
+				removed.signal()
+			}
+			removed.wait()
+		}
+		let memoryCache = DownloadCache()
+		let downloader = Downloader(cache: memoryCache, diskCache: cache)
+		let url = server.url("/")
+
+		_ = try await downloader.download(url)
+		memoryCache[url.absoluteString] = nil
+		let downloadResponse = try await downloader.download(url)
+
+		#expect((downloadResponse.response as? HTTPURLResponse)?.statusCode == 200)
+		#expect(downloadResponse.data == body)
+		#expect(server.ifNoneMatchHeaders == [nil, etag, nil])
+		#expect((memoryCache[url.absoluteString]?.response as? HTTPURLResponse)?.statusCode == 200)
+		guard case .stale = await cache.lookup(url) else {
+			Issue.record("Expected the response to be stored again")
+			return
+		}
+	}
+
+	@Test func unreusableResponsesAreNotStored() async {
+		let cache = makeCache()
+		_ = await cache.update(url, data: Data("a".utf8), response: response(200, [:]))
+		#expect(isMiss(await cache.lookup(url)))
+
+		_ = await cache.update(url, data: Data("a".utf8), response: response(200, ["ETag": "\"a\"", "Cache-Control": "no-store"]))
+		#expect(isMiss(await cache.lookup(url)))
+
+		_ = await cache.update(url, data: Data("a".utf8), response: response(404, ["ETag": "\"a\""]))
+		#expect(isMiss(await cache.lookup(url)))
+	}
+
+	@Test func entriesPersistAcrossInstances() async {
+		let folder = makeFolder()
+		_ = await HTTPDiskCache(folder: folder).update(url, data: Data("icon".utf8), response: response(200, ["Cache-Control": "max-age=3600"]))
+
+		guard case .fresh(let data, _) = await HTTPDiskCache(folder: folder).lookup(url) else {
+			Issue.record("Expected a fresh hit")
+			return
+		}
+		#expect(data == Data("icon".utf8))
+	}
+
+	@Test func leastRecentlyUsedEntriesAreEvicted() async throws {
+		let cache = makeCache(maximumSize: 40 * 1024)
+		let body = Data(repeating: 0x41, count: 10 * 1024)
+		let urls = (0..<3).map { URL(string: "https://example.com/\($0)")! }
+		let cacheControl = ["Cache-Control": "max-age=3600"]
+
+		for url in urls {
+			_ = await cache.update(url, data: body, response: response(200, cacheControl, url: url))
+			try await Task.sleep(for: .milliseconds(10))
+		}
+		_ = await cache.lookup(urls[0]) // Now more recently used than urls[1].
+
+		let fourth = URL(string: "https://example.com/3")!
+		_ = await cache.update(fourth, data: body, response: response(200, cacheControl, url: fourth))
+
+		#expect(!isMiss(await cache.lookup(urls[0])))
+		#expect(isMiss(await cache.lookup(urls[1])))
+		#expect(!isMiss(await cache.lookup(fourth)))
+	}
+}
+
+private extension HTTPDiskCacheTests {
+
+	func makeFolder() -> URL {
+		let folder = FileManager.default.temporaryDirectory.appendingPathComponent("HTTPDiskCacheTests-\(UUID().uuidString)", isDirectory: true)
+		try! FileManager.default.createDirectory(at: folder, withIntermediateDirectories: true)
+		folders.append(folder)
+		return folder
+	}
+
+	func makeCache(maximumSize: Int = HTTPDiskCache.defaultMaximumSize) -> HTTPDiskCache {
+		HTTPDiskCache(folder: makeFolder(), maximumSize: maximumSize)
+	}
+
+	func response(_ statusCode: Int, _ headerFields: [String: String], url: URL? = nil) -> HTTPURLResponse {
+		HTTPURLResponse(url: url ?? self.url, statusCode: statusCode, httpVersion: "HTTP/1.1", headerFields: headerFields)!
+	}
+
+	func isMiss(_ lookup: HTTPDiskCache.Lookup) -> Bool {
+		if case .miss = lookup {
+			return true
+		}
+		return false
+	}
+
+	func isUseResponse(_ update: HTTPDiskCache.Update) -> Bool {
+		if case .useResponse = update {
+			return true
+		}
+		return false
+	}
+}
@@ -0,0 +1,160 @@
+//
+//  LocalHTTPServer.swift
+//  RSWebTests
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import Network
+import os
+
+/// Minimal HTTP/1.1 server on 127.0.0.1, standing in for a web server in
+/// download tests. Serves fixed bodies by path, in paced chunks — like a
+/// real network, so a client that cancels early stops the transfer early —
+/// and counts the body bytes it sends. Given an `etag`, it sends it with
+/// each body and answers a matching If-None-Match with a 304.
+final class LocalHTTPServer: @unchecked Sendable { // Mutable state is behind the lock.
+
+	let baseURL: URL
+
+	/// Body bytes sent, across all requests.
+	var bytesSent: Int {
+		state.withLock { $0.bytesSent }
+	}
+
+	/// Each request’s If-None-Match header, in order.
+	var ifNoneMatchHeaders: [String?] {
+		state.withLock { $0.ifNoneMatchHeaders }
+	}
+
+	private let listener: NWListener
+	private let queue: DispatchQueue
+	private let bodies: [String: Data]
+	private let chunkSize: Int
+	private let chunkInterval: DispatchTimeInterval
+	private let etag: String?
+	private let willRespond: (@Sendable (_ ifNoneMatch: String?) -> Void)?
+	private let state = OSAllocatedUnfairLock(initialState: State())
+
+	private struct State {
+		var bytesSent = 0
+		var ifNoneMatchHeaders = [String?]()
+	}
+
+	/// `willRespond` runs on the server’s queue after each request is read,
+	/// before the response is sent.
+	init(bodies: [String: Data], etag: String? = nil, chunkSize: Int = 16 * 1024, chunkInterval: DispatchTimeInterval = .milliseconds(5), willRespond: (@Sendable (_ ifNoneMatch: String?) -> Void)? = nil) async throws {
+		self.bodies = bodies
+		self.etag = etag
+		self.chunkSize = chunkSize
+		self.chunkInterval = chunkInterval
+		self.willRespond = willRespond
+		let queue = DispatchQueue(label: "LocalHTTPServer")
+		self.queue = queue
+
+		let parameters = NWParameters.tcp
+		parameters.requiredLocalEndpoint = NWEndpoint.hostPort(host: .ipv4(.loopback), port: .any)
+		let listener = try NWListener(using: parameters)
+		self.listener = listener
+
+		let port: NWEndpoint.Port = try await withCheckedThrowingContinuation { continuation in
+			listener.stateUpdateHandler = { state in
+				switch state {
+				case .ready:
+					listener.stateUpdateHandler = nil
+					continuation.resume(returning: listener.port!)
+				case .failed(let error):
+					listener.stateUpdateHandler = nil
+					continuation.resume(throwing: error)
+				default:
+					break
+				}
+			}
+			listener.start(queue: queue)
+		}
+		baseURL = URL(string: "http://127.0.0.1:\(port.rawValue)")!
+
+		listener.newConnectionHandler = { [weak self] connection in
+			self?.handle(connection)
+		}
+	}
+
+	deinit {
+		listener.cancel()
+	}
+
+	func url(_ path: String) -> URL {
+		baseURL.appending(path: path)
+	}
+}
+
+private extension LocalHTTPServer {
+
+	func handle(_ connection: NWConnection) {
+		connection.start(queue: queue)
+		connection.receive(minimumIncompleteLength: 1, maximumLength: 64 * 1024) { [weak self] data, _, _, error in
+			guard let self, let data, error == nil else {
+				connection.cancel()
+				return
+			}
+
+			// "GET /path HTTP/1.1", then headers — only If-None-Match matters here.
+			let lines = String(decoding: data, as: UTF8.self).components(separatedBy: "\r\n")
+			let parts = lines[0].split(separator: " ")
+			let path = parts.count > 1 ? String(parts[1]) : "/"
+			let ifNoneMatch = lines.dropFirst().first { $0.lowercased().hasPrefix("if-none-match:") }.map {
+				$0.dropFirst("if-none-match:".count).trimmingCharacters(in: .whitespaces)
+			}
+			state.withLock { $0.ifNoneMatchHeaders.append(ifNoneMatch) }
+			willRespond?(ifNoneMatch)
+
+			guard let body = bodies[path] else {
+				let header = "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n"
+				connection.send(content: Data(header.utf8), isComplete: true, completion: .contentProcessed { _ in
+					connection.cancel()
+				})
+				return
+			}
+
+			if let etag, ifNoneMatch == etag {
+				let header = "HTTP/1.1 304 Not Modified\r\nETag: \(etag)\r\nConnection: close\r\n\r\n"
+				connection.send(content: Data(header.utf8), isComplete: true, completion: .contentProcessed { _ in
+					connection.cancel()
+				})
+				return
+			}
+
+			let etagHeader = etag.map { "ETag: \($0)\r\n" } ?? ""
+			let header = "HTTP/1.1 200 OK\r\nContent-Type: text/html; charset=utf-8\r\n\(etagHeader)Content-Length: \(body.count)\r\nConnection: close\r\n\r\n"
+			connection.send(content: Data(header.utf8), completion: .contentProcessed { [weak self] error in
+				guard let self, error == nil else {
+					connection.cancel()
+					return
+				}
+				send(body, from: 0, on: connection)
+			})
+		}
+	}
+
+	func send(_ body: Data, from offset: Int, on connection: NWConnection) {
+		guard offset < body.count else {
+			connection.send(content: nil, isComplete: true, completion: .contentProcessed { _ in
+				connection.cancel()
+			})
+			return
+		}
+
+		let chunk = body[offset..<min(offset + chunkSize, body.count)]
+		connection.send(content: chunk, completion: .contentProcessed { [weak self] error in
+			guard let self, error == nil else {
+				connection.cancel() // The client went away.
+				return
+			}
+			state.withLock { $0.bytesSent += chunk.count }
+			queue.asyncAfter(deadline: .now() + chunkInterval) { [weak self] in
+				self?.send(body, from: offset + chunk.count, on: connection)
+			}
+		})
+	}
+}
@@ -0,0 +1,51 @@
+// swift-tools-version:6.2
+import PackageDescription
+
+// Foundation-only, so the benchmark builds and runs with swift-corelibs on
+// Linux as well as on Apple platforms:
+//
+//     swift run -c release refresh-benchmark churn notModified --report /tmp/refresh.jsonl
+//
+// The library is static: on Linux, CAllocationCounter counts allocations by
+// defining malloc and free, which only take the place of glibc’s when
+// they’re linked into the executable.
+let package = Package(
+	name: "RefreshBenchmark",
+	platforms: [.macOS(.v15), .iOS(.v17)],
+	products: [
+		.library(
+			name: "RefreshBenchmark",
+			type: .static,
+			targets: ["RefreshBenchmark"]),
+		.executable(
+			name: "refresh-benchmark",
+			targets: ["RefreshBenchmarkRunner"])
+	],
+	dependencies: [
+	],
+	targets: [
+		.target(
+			name: "RefreshBenchmark",
+			dependencies: ["CAllocationCounter"],
+			swiftSettings: [
+				.enableUpcomingFeature("NonisolatedNonsendingByDefault"),
+				.enableUpcomingFeature("InferIsolatedConformances")
+			]
+		),
+		.target(
+			name: "CAllocationCounter",
+			dependencies: []
+		),
+		.executableTarget(
+			name: "RefreshBenchmarkRunner",
+			dependencies: ["RefreshBenchmark"],
+			swiftSettings: [
+				.enableUpcomingFeature("NonisolatedNonsendingByDefault"),
+				.enableUpcomingFeature("InferIsolatedConformances")
+			]
+		),
+		.testTarget(
+			name: "RefreshBenchmarkTests",
+			dependencies: ["RefreshBenchmark"])
+	]
+)
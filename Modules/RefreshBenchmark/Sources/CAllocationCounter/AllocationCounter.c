@@ -0,0 +1,177 @@
+//
+//  AllocationCounter.c
+//  CAllocationCounter
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+#include "AllocationCounter.h"
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+static atomic_bool isCounting = false;
+static atomic_uint_fast64_t allocationCount = 0;
+static atomic_uint_fast64_t allocatedByteCount = 0;
+static atomic_uint_fast64_t freeCount = 0;
+
+static inline void countAllocation(size_t size) {
+	if (atomic_load_explicit(&isCounting, memory_order_relaxed)) {
+		atomic_fetch_add_explicit(&allocationCount, 1, memory_order_relaxed);
+		atomic_fetch_add_explicit(&allocatedByteCount, size, memory_order_relaxed);
+	}
+}
+
+static inline void countFree(void) {
+	if (atomic_load_explicit(&isCounting, memory_order_relaxed)) {
+		atomic_fetch_add_explicit(&freeCount, 1, memory_order_relaxed);
+	}
+}
+
+#if defined(__APPLE__)
+
+// libmalloc calls `malloc_logger`, when set, for every allocation and free
+// in the default zones — it’s how MallocStackLogging works. The declarations
+// match libmalloc’s stack_logging.h, which isn’t public.
+
+typedef void (malloc_logger_t)(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3, uintptr_t result, uint32_t numberOfHotFramesToSkip);
+extern malloc_logger_t *malloc_logger;
+
+enum {
+	MallocLogTypeAllocate = 2,
+	MallocLogTypeDeallocate = 4,
+	MallocLogTypeHasZone = 8
+};
+
+static malloc_logger_t *previousMallocLogger = NULL;
+
+static void countingMallocLogger(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3, uintptr_t result, uint32_t numberOfHotFramesToSkip) {
+	bool allocates = (type & MallocLogTypeAllocate) != 0;
+	bool deallocates = (type & MallocLogTypeDeallocate) != 0;
+	if (allocates && deallocates) {
+		countAllocation((size_t)arg3); // realloc: zone, old pointer, size
+	} else if (allocates) {
+		countAllocation((size_t)((type & MallocLogTypeHasZone) ? arg2 : arg1));
+	} else if (deallocates) {
+		countFree();
+	}
+
+	if (previousMallocLogger != NULL) {
+		previousMallocLogger(type, arg1, arg2, arg3, result, numberOfHotFramesToSkip + 1);
+	}
+}
+
+bool AllocationCounterIsSupported(void) {
+	return true;
+}
+
+static void installCounter(void) {
+	if (malloc_logger != countingMallocLogger) {
+		previousMallocLogger = malloc_logger;
+		malloc_logger = countingMallocLogger;
+	}
+}
+
+static void removeCounter(void) {
+	if (malloc_logger == countingMallocLogger) {
+		malloc_logger = previousMallocLogger;
+		previousMallocLogger = NULL;
+	}
+}
+
+#elif defined(__linux__) && defined(__GLIBC__)
+
+// Defined in the executable, these take the place of glibc’s for the whole
+// process, and forward to glibc’s own implementations.
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *pointer, size_t size);
+extern void *__libc_memalign(size_t alignment, size_t size);
+extern void __libc_free(void *pointer);
+
+void *malloc(size_t size) {
+	countAllocation(size);
+	return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size) {
+	countAllocation(count * size);
+	return __libc_calloc(count, size);
+}
+
+void *realloc(void *pointer, size_t size) {
+	countAllocation(size);
+	return __libc_realloc(pointer, size);
+}
+
+void *aligned_alloc(size_t alignment, size_t size) {
+	countAllocation(size);
+	return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void **pointer, size_t alignment, size_t size) {
+	if (alignment % sizeof(void *) != 0 || (alignment & (alignment - 1)) != 0) {
+		return 22; // EINVAL
+	}
+	countAllocation(size);
+	void *allocated = __libc_memalign(alignment, size);
+	if (allocated == NULL) {
+		return 12; // ENOMEM
+	}
+	*pointer = allocated;
+	return 0;
+}
+
+void free(void *pointer) {
+	if (pointer != NULL) {
+		countFree();
+	}
+	__libc_free(pointer);
+}
+
+bool AllocationCounterIsSupported(void) {
+	return true;
+}
+
+static void installCounter(void) {
+}
+
+static void removeCounter(void) {
+}
+
+#else
+
+bool AllocationCounterIsSupported(void) {
+	return false;
+}
+
+static void installCounter(void) {
+}
+
+static void removeCounter(void) {
+}
+
+#endif
+
+void AllocationCounterStart(void) {
+	atomic_store_explicit(&isCounting, false, memory_order_relaxed);
+	atomic_store_explicit(&allocationCount, 0, memory_order_relaxed);
+	atomic_store_explicit(&allocatedByteCount, 0, memory_order_relaxed);
+	atomic_store_explicit(&freeCount, 0, memory_order_relaxed);
+	installCounter();
+	atomic_store_explicit(&isCounting, true, memory_order_release);
+}
+
+void AllocationCounterStop(void) {
+	atomic_store_explicit(&isCounting, false, memory_order_release);
+	removeCounter();
+}
+
+AllocationCounts AllocationCounterRead(void) {
+	AllocationCounts counts;
+	counts.allocations = atomic_load_explicit(&allocationCount, memory_order_relaxed);
+	counts.allocatedBytes = atomic_load_explicit(&allocatedByteCount, memory_order_relaxed);
+	counts.frees = atomic_load_explicit(&freeCount, memory_order_relaxed);
+	return counts;
+}
@@ -0,0 +1,30 @@
+//
+//  AllocationCounter.h
+//  CAllocationCounter
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/// Process-wide malloc counts since the last `AllocationCounterStart`.
+typedef struct {
+	uint64_t allocations; // malloc, calloc, realloc, and aligned allocations
+	uint64_t allocatedBytes;
+	uint64_t frees;
+} AllocationCounts;
+
+/// True on Darwin (via `malloc_logger`) and on Linux with glibc (by
+/// interposing malloc). Elsewhere the counts stay zero.
+bool AllocationCounterIsSupported(void);
+
+/// Resets the counts and starts counting.
+void AllocationCounterStart(void);
+
+/// Stops counting. The counts are kept until the next start.
+void AllocationCounterStop(void);
+
+AllocationCounts AllocationCounterRead(void);
@@ -0,0 +1,358 @@
+//
+//  FeedServer.swift
+//  RefreshBenchmark
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import Synchronization
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#endif
+
+/// How `FeedServer` responds, beyond serving the current documents.
+public struct FeedServerResponseProfile: Sendable {
+
+	/// Wait before the response header — time to first byte.
+	public var latency = Duration.zero
+
+	/// Body bytes per second, sent in 16 KB chunks. Nil sends the body at once.
+	public var bytesPerSecond: Int?
+
+	/// Send ETags, and answer a matching If-None-Match with 304 Not Modified.
+	public var supportsConditionalGet = true
+
+	/// Fraction of feeds answering 429 Too Many Requests, with a Retry-After.
+	///
+	/// `DownloadSession` tracks 429s by host, and a `FeedServer`’s sites are
+	/// all on 127.0.0.1 — so the first 429 skips the rest of the refresh. This
+	/// measures that path, not a mix of rate-limited and healthy hosts.
+	public var tooManyRequestsRate = 0.0
+
+	public init() {
+	}
+}
+
+/// HTTP/1.1 stand-in for feed hosts, on 127.0.0.1, for the refresh benchmark.
+///
+/// It listens on several ports, one per simulated site, with feeds spread
+/// across them. Documents can be replaced between refreshes, and their
+/// ETags change with them.
+///
+/// Plain BSD sockets, with a thread per connection, so it runs wherever
+/// Foundation does. It’s one connection per request (`Connection: close`).
+public final class FeedServer: Sendable {
+
+	public struct Counts: Sendable, Codable {
+		public var requests = 0
+		public var ok = 0
+		public var notModified = 0
+		public var tooManyRequests = 0
+		public var bodyBytesSent = 0
+	}
+
+	public let profile: FeedServerResponseProfile
+
+	public var counts: Counts {
+		state.withLock { $0.counts }
+	}
+
+	private struct Document {
+		let data: Data
+		let etag: String
+	}
+
+	private struct State {
+		var documents = [String: Document]()
+		var counts = Counts()
+	}
+
+	private let listeners: [Listener]
+	private let state = Mutex(State())
+	private static let chunkSize = 16 * 1024
+
+	public init(siteCount: Int = 8, profile: FeedServerResponseProfile = FeedServerResponseProfile()) throws {
+		precondition(siteCount > 0)
+		self.profile = profile
+		self.listeners = try (0..<siteCount).map { _ in try Listener() }
+
+		for listener in listeners {
+			listener.start { [weak self] connection in
+				guard let self else {
+					close(connection)
+					return
+				}
+				handle(connection)
+			}
+		}
+	}
+
+	deinit {
+		for listener in listeners {
+			listener.stop()
+		}
+	}
+
+	/// The URL for a feed: on site `feedIndex % siteCount`.
+	public func url(_ path: String, feedIndex: Int) -> URL {
+		URL(string: "http://127.0.0.1:\(listeners[feedIndex % listeners.count].port)\(path)")!
+	}
+
+	/// Replace what’s served. Documents whose bytes didn’t change keep their ETags.
+	public func setDocuments(_ documents: [String: Data]) {
+		let documents = documents.mapValues { Document(data: $0, etag: "\"\(String($0.fnv1aHash, radix: 16))\"") }
+		state.withLock { $0.documents = documents }
+	}
+
+	public func resetCounts() {
+		state.withLock { $0.counts = Counts() }
+	}
+}
+
+private extension FeedServer {
+
+	struct Request {
+		let path: String
+		let ifNoneMatch: String?
+
+		/// Parses the request line and the one header that matters here.
+		init(_ data: Data) {
+			let lines = String(decoding: data, as: UTF8.self).components(separatedBy: "\r\n")
+			let requestLineParts = lines.first?.split(separator: " ") ?? []
+			self.path = requestLineParts.count > 1 ? String(requestLineParts[1]) : "/"
+
+			var ifNoneMatch: String?
+			for line in lines.dropFirst() {
+				guard let colon = line.firstIndex(of: ":") else {
+					continue
+				}
+				if line[..<colon].caseInsensitiveCompare("If-None-Match") == .orderedSame {
+					ifNoneMatch = line[line.index(after: colon)...].trimmingCharacters(in: .whitespaces)
+				}
+			}
+			self.ifNoneMatch = ifNoneMatch
+		}
+	}
+
+	func handle(_ connection: Int32) {
+		let thread = Thread { [weak self] in
+			defer {
+				close(connection)
+			}
+			#if canImport(Darwin)
+			var noSIGPIPE: Int32 = 1
+			setsockopt(connection, SOL_SOCKET, SO_NOSIGPIPE, &noSIGPIPE, socklen_t(MemoryLayout<Int32>.size))
+			#endif
+			guard let requestData = Self.receiveRequest(connection) else {
+				return
+			}
+			self?.respond(to: Request(requestData), on: connection)
+		}
+		thread.start()
+	}
+
+	func respond(to request: Request, on connection: Int32) {
+		if profile.latency > .zero {
+			Thread.sleep(forTimeInterval: profile.latency.timeInterval)
+		}
+
+		let document = state.withLock { state in
+			state.counts.requests += 1
+			return state.documents[request.path]
+		}
+		guard let document else {
+			sendHeaderOnly("404 Not Found", on: connection)
+			return
+		}
+
+		if tooManyRequests(request.path) {
+			state.withLock { $0.counts.tooManyRequests += 1 }
+			sendHeaderOnly("429 Too Many Requests", extraHeaders: "Retry-After: 60\r\n", on: connection)
+			return
+		}
+
+		if profile.supportsConditionalGet && request.ifNoneMatch == document.etag {
+			state.withLock { $0.counts.notModified += 1 }
+			sendHeaderOnly("304 Not Modified", extraHeaders: "ETag: \(document.etag)\r\n", on: connection)
+			return
+		}
+
+		state.withLock { $0.counts.ok += 1 }
+		let etagHeader = profile.supportsConditionalGet ? "ETag: \(document.etag)\r\n" : ""
+		let header = "HTTP/1.1 200 OK\r\nContent-Type: application/rss+xml\r\nContent-Length: \(document.data.count)\r\n\(etagHeader)Connection: close\r\n\r\n"
+		guard Self.sendAll(Data(header.utf8), on: connection) else {
+			return
+		}
+		sendBody(document.data, on: connection)
+	}
+
+	func sendHeaderOnly(_ status: String, extraHeaders: String = "", on connection: Int32) {
+		let header = "HTTP/1.1 \(status)\r\n\(extraHeaders)Content-Length: 0\r\nConnection: close\r\n\r\n"
+		_ = Self.sendAll(Data(header.utf8), on: connection)
+	}
+
+	func sendBody(_ body: Data, on connection: Int32) {
+		let chunkSize = profile.bytesPerSecond == nil ? body.count : Self.chunkSize
+		var offset = 0
+		while offset < body.count {
+			let chunk = body[offset..<min(offset + chunkSize, body.count)]
+			guard Self.sendAll(chunk, on: connection) else {
+				return // The client went away.
+			}
+			state.withLock { $0.counts.bodyBytesSent += chunk.count }
+			offset += chunk.count
+
+			if let bytesPerSecond = profile.bytesPerSecond {
+				Thread.sleep(forTimeInterval: Double(chunk.count) / Double(bytesPerSecond))
+			}
+		}
+	}
+
+	/// The same feeds every time, picked by a hash of the path.
+	func tooManyRequests(_ path: String) -> Bool {
+		guard profile.tooManyRequestsRate > 0 else {
+			return false
+		}
+		let bucket = Data(path.utf8).fnv1aHash % 1000
+		return Double(bucket) < profile.tooManyRequestsRate * 1000
+	}
+
+	/// Reads up to the end of the request header. Nil if the client closed first.
+	static func receiveRequest(_ connection: Int32) -> Data? {
+		let headerEnd = Data("\r\n\r\n".utf8)
+		var request = Data()
+		var buffer = [UInt8](repeating: 0, count: 4096)
+		while request.count < 64 * 1024 {
+			let count = buffer.withUnsafeMutableBytes { recv(connection, $0.baseAddress, $0.count, 0) }
+			guard count > 0 else {
+				return nil
+			}
+			request.append(contentsOf: buffer[..<count])
+			if request.range(of: headerEnd) != nil {
+				break
+			}
+		}
+		return request
+	}
+
+	static func sendAll(_ data: Data, on connection: Int32) -> Bool {
+		data.withUnsafeBytes { buffer in
+			guard let baseAddress = buffer.baseAddress else {
+				return true
+			}
+			var offset = 0
+			while offset < buffer.count {
+				let sent = send(connection, baseAddress + offset, buffer.count - offset, sendFlags)
+				if sent < 0 && errno == EINTR {
+					continue
+				}
+				guard sent > 0 else {
+					return false
+				}
+				offset += sent
+			}
+			return true
+		}
+	}
+}
+
+#if canImport(Darwin)
+private let sendFlags: Int32 = 0 // SO_NOSIGPIPE is set on each connection instead.
+#else
+private let sendFlags = Int32(MSG_NOSIGNAL)
+#endif
+
+/// A socket listening on 127.0.0.1, on a port picked by the system, with a
+/// thread accepting connections until `stop`.
+private final class Listener: Sendable {
+
+	let port: UInt16
+	private let descriptor: Int32
+	private let isStopped = Atomic(false)
+
+	init() throws {
+		#if canImport(Darwin)
+		let descriptor = socket(AF_INET, SOCK_STREAM, 0)
+		#else
+		let descriptor = socket(AF_INET, Int32(SOCK_STREAM.rawValue), 0)
+		#endif
+		guard descriptor >= 0 else {
+			throw POSIXError.current
+		}
+
+		var address = sockaddr_in()
+		#if canImport(Darwin)
+		address.sin_len = UInt8(MemoryLayout<sockaddr_in>.size)
+		#endif
+		address.sin_family = sa_family_t(AF_INET)
+		address.sin_port = 0
+		address.sin_addr.s_addr = in_addr_t(0x7f00_0001).bigEndian // 127.0.0.1
+		var length = socklen_t(MemoryLayout<sockaddr_in>.size)
+
+		let isListening = withUnsafeMutablePointer(to: &address) { pointer in
+			pointer.withMemoryRebound(to: sockaddr.self, capacity: 1) { address in
+				bind(descriptor, address, length) == 0 && listen(descriptor, 128) == 0 && getsockname(descriptor, address, &length) == 0
+			}
+		}
+		guard isListening else {
+			let error = POSIXError.current
+			close(descriptor)
+			throw error
+		}
+
+		self.descriptor = descriptor
+		self.port = UInt16(bigEndian: address.sin_port)
+	}
+
+	func start(_ handler: @escaping @Sendable (_ connection: Int32) -> Void) {
+		let thread = Thread { [self] in
+			acceptConnections(handler)
+		}
+		thread.start()
+	}
+
+	/// The accepting thread notices within its poll timeout, and closes the socket.
+	func stop() {
+		isStopped.store(true, ordering: .relaxed)
+	}
+
+	private func acceptConnections(_ handler: (_ connection: Int32) -> Void) {
+		var pollDescriptor = pollfd(fd: descriptor, events: Int16(POLLIN), revents: 0)
+		while !isStopped.load(ordering: .relaxed) {
+			guard poll(&pollDescriptor, 1, 100) > 0 else {
+				continue
+			}
+			let connection = accept(descriptor, nil, nil)
+			if connection >= 0 {
+				handler(connection)
+			}
+		}
+		close(descriptor)
+	}
+}
+
+private extension POSIXError {
+
+	static var current: POSIXError {
+		POSIXError(POSIXErrorCode(rawValue: errno) ?? .EIO)
+	}
+}
+
+private extension Data {
+
+	/// 64-bit FNV-1a — stable across runs and platforms, unlike `hashValue`.
+	var fnv1aHash: UInt64 {
+		reduce(0xcbf2_9ce4_8422_2325) { ($0 ^ UInt64($1)) &* 0x0000_0100_0000_01b3 }
+	}
+}
+
+private extension Duration {
+
+	var timeInterval: TimeInterval {
+		let (seconds, attoseconds) = components
+		return TimeInterval(seconds) + TimeInterval(attoseconds) / 1e18
+	}
+}
@@ -0,0 +1,144 @@
+//
+//  RefreshBenchmarkScenario.swift
+//  RefreshBenchmark
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+
+/// A refresh to measure: the feeds, how the server answers, and how many
+/// refreshes run unmeasured first. Shared by the `refresh-benchmark` runner
+/// and the Account module’s end-to-end benchmark, so their numbers line up.
+public struct RefreshBenchmarkScenario: Sendable {
+
+	public let name: String
+	public var feeds = SyntheticFeedsProfile()
+	public var server = FeedServerResponseProfile()
+	public var warmUpRounds = 1
+
+	public init(_ name: String) {
+		self.name = name
+	}
+
+	public static let all: [RefreshBenchmarkScenario] = [
+		.initial,
+		.churn,
+		.notModified,
+		.unchangedContent,
+		.mixed,
+		.slowServer,
+		.tooManyRequests,
+		.largeFeeds,
+		.shiftJIS,
+		.utf16Atom
+	]
+
+	public static func named(_ name: String) -> RefreshBenchmarkScenario? {
+		all.first { $0.name == name }
+	}
+
+	/// Subscribing to everything at once: every item is new.
+	public static var initial: RefreshBenchmarkScenario {
+		var scenario = RefreshBenchmarkScenario("initial")
+		scenario.warmUpRounds = 0
+		return scenario
+	}
+
+	/// The everyday refresh: every feed changed, a fifth of each feed’s items are new.
+	public static var churn: RefreshBenchmarkScenario {
+		RefreshBenchmarkScenario("churn")
+	}
+
+	/// Nothing changed, and the server knows it: all 304s.
+	public static var notModified: RefreshBenchmarkScenario {
+		var scenario = RefreshBenchmarkScenario("notModified")
+		scenario.feeds.changingFeedRate = 0
+		return scenario
+	}
+
+	/// Nothing changed, but there are no ETags: full downloads, skipped by the content hash.
+	public static var unchangedContent: RefreshBenchmarkScenario {
+		var scenario = RefreshBenchmarkScenario("unchangedContent")
+		scenario.feeds.changingFeedRate = 0
+		scenario.server.supportsConditionalGet = false
+		return scenario
+	}
+
+	/// A quarter of the feeds changed; the rest answer 304.
+	public static var mixed: RefreshBenchmarkScenario {
+		var scenario = RefreshBenchmarkScenario("mixed")
+		scenario.feeds.changingFeedRate = 0.25
+		return scenario
+	}
+
+	/// Slow sites: time to first byte and a throttled body.
+	public static var slowServer: RefreshBenchmarkScenario {
+		var scenario = RefreshBenchmarkScenario("slowServer")
+		scenario.feeds.feedCount = 40
+		scenario.server.latency = .milliseconds(150)
+		scenario.server.bytesPerSecond = 256 * 1024
+		return scenario
+	}
+
+	/// Rate limiting: some feeds answer 429 with a Retry-After.
+	public static var tooManyRequests: RefreshBenchmarkScenario {
+		var scenario = RefreshBenchmarkScenario("tooManyRequests")
+		scenario.server.tooManyRequestsRate = 0.1
+		scenario.warmUpRounds = 0
+		return scenario
+	}
+
+	/// A few very large feeds — the full-archive kind.
+	public static var largeFeeds: RefreshBenchmarkScenario {
+		var scenario = RefreshBenchmarkScenario("largeFeeds")
+		scenario.feeds.feedCount = 10
+		scenario.feeds.itemsPerFeed = 250
+		scenario.feeds.bodyLength = 8_000
+		return scenario
+	}
+
+	public static var shiftJIS: RefreshBenchmarkScenario {
+		var scenario = RefreshBenchmarkScenario("shiftJIS")
+		scenario.feeds.encoding = .shiftJIS
+		return scenario
+	}
+
+	public static var utf16Atom: RefreshBenchmarkScenario {
+		var scenario = RefreshBenchmarkScenario("utf16Atom")
+		scenario.feeds.format = .atom
+		scenario.feeds.encoding = .utf16
+		return scenario
+	}
+}
+
+/// Appends reports as JSON lines, so runs can be compared from the command line.
+public enum RefreshBenchmarkReportFile {
+
+	/// Where both the runner and the Account benchmark write reports, when set.
+	public static let pathEnvironmentKey = "REFRESH_BENCHMARK_REPORT_PATH"
+
+	public static var pathFromEnvironment: String? {
+		guard let path = ProcessInfo.processInfo.environment[pathEnvironmentKey], !path.isEmpty else {
+			return nil
+		}
+		return path
+	}
+
+	public static func append(_ report: some Encodable, to path: String) throws {
+		let encoder = JSONEncoder()
+		encoder.outputFormatting = .sortedKeys
+		var line = try encoder.encode(report)
+		line.append(UInt8(ascii: "\n"))
+
+		if !FileManager.default.fileExists(atPath: path) {
+			FileManager.default.createFile(atPath: path, contents: nil)
+		}
+		let fileHandle = try FileHandle(forWritingTo: URL(fileURLWithPath: path))
+		defer {
+			try? fileHandle.close()
+		}
+		try fileHandle.seekToEnd()
+		try fileHandle.write(contentsOf: line)
+	}
+}
@@ -0,0 +1,177 @@
+//
+//  ResourceUsage.swift
+//  RefreshBenchmark
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import CAllocationCounter
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#endif
+
+/// User plus system CPU time for the whole process, in seconds.
+public func processCPUSeconds() -> Double {
+	var usage = rusage()
+	getrusage(RUSAGE_SELF, &usage)
+	return usage.ru_utime.seconds + usage.ru_stime.seconds
+}
+
+/// Peak memory growth over a baseline.
+///
+/// The footprint is what the system charges the process for: the physical
+/// footprint on Darwin (what Xcode’s memory gauge shows), resident size on
+/// Linux. The heap is malloc’s bytes in use, on Darwin only.
+///
+/// On Darwin the peaks are sampled, so a short spike between samples can be
+/// missed. On Linux the peak is the kernel’s high-water mark (VmHWM), reset
+/// when the sampler is made, so nothing is missed between samples.
+public struct ResourceSampler: Sendable {
+
+	private let baselineFootprint: Int64
+	private let baselineHeap = Self.heapInUse()
+	private var peakFootprint: Int64 = 0
+	private var peakHeap: Int64 = 0
+
+	public init() {
+		#if !canImport(Darwin)
+		Self.resetPeakResidentSize()
+		#endif
+		baselineFootprint = Self.footprint()
+	}
+
+	public var peakFootprintGrowth: Int64 {
+		max(0, peakFootprint - baselineFootprint)
+	}
+
+	public var peakHeapGrowth: Int64? {
+		baselineHeap.map { max(0, peakHeap - $0) }
+	}
+
+	public mutating func sample() {
+		#if canImport(Darwin)
+		peakFootprint = max(peakFootprint, Self.footprint())
+		#else
+		peakFootprint = max(peakFootprint, Self.peakResidentSize())
+		#endif
+		peakHeap = max(peakHeap, Self.heapInUse() ?? 0)
+	}
+
+	public static func footprint() -> Int64 {
+		#if canImport(Darwin)
+		var info = rusage_info_v4()
+		let result = withUnsafeMutablePointer(to: &info) {
+			$0.withMemoryRebound(to: rusage_info_t?.self, capacity: 1) {
+				proc_pid_rusage(getpid(), RUSAGE_INFO_V4, $0)
+			}
+		}
+		return result == 0 ? Int64(info.ri_phys_footprint) : 0
+		#else
+		return statusValue("VmRSS") ?? 0
+		#endif
+	}
+
+	public static func heapInUse() -> Int64? {
+		#if canImport(Darwin)
+		var statistics = malloc_statistics_t()
+		malloc_zone_statistics(nil, &statistics)
+		return Int64(statistics.size_in_use)
+		#else
+		return nil
+		#endif
+	}
+}
+
+/// Allocations made while counting, across every thread in the process.
+public struct AllocationCount: Sendable, Codable {
+
+	public var allocations = 0
+	public var allocatedBytes = 0
+	public var frees = 0
+
+	public init() {
+	}
+}
+
+/// Counts malloc calls — with `malloc_logger` on Darwin, and by standing in
+/// for glibc’s malloc on Linux. Counting is process-wide, so only one
+/// measurement can run at a time.
+public enum AllocationCounter {
+
+	public static var isSupported: Bool {
+		AllocationCounterIsSupported()
+	}
+
+	/// Counts the allocations made while `body` runs. Nil where counting isn’t supported.
+	public static func measure<T>(_ body: () async throws -> T) async rethrows -> (T, AllocationCount?) {
+		guard isSupported else {
+			return (try await body(), nil)
+		}
+		AllocationCounterStart()
+		defer {
+			AllocationCounterStop()
+		}
+		let result = try await body()
+		AllocationCounterStop()
+
+		let counts = AllocationCounterRead()
+		var count = AllocationCount()
+		count.allocations = Int(counts.allocations)
+		count.allocatedBytes = Int(counts.allocatedBytes)
+		count.frees = Int(counts.frees)
+		return (result, count)
+	}
+}
+
+#if !canImport(Darwin)
+private extension ResourceSampler {
+
+	/// The process’s peak resident size. VmHWM, or — where /proc/self/status
+	/// can’t be read — getrusage’s ru_maxrss, which is the same number in
+	/// kilobytes but can’t be reset.
+	static func peakResidentSize() -> Int64 {
+		if let peak = statusValue("VmHWM") {
+			return peak
+		}
+		var usage = rusage()
+		getrusage(RUSAGE_SELF, &usage)
+		return Int64(usage.ru_maxrss) * 1024
+	}
+
+	/// Writing 5 to clear_refs resets VmHWM to the current resident size.
+	/// If it can’t be written, the peak is the process’s lifetime peak.
+	static func resetPeakResidentSize() {
+		guard let file = fopen("/proc/self/clear_refs", "w") else {
+			return
+		}
+		fputs("5", file)
+		fclose(file)
+	}
+
+	/// A kB value from /proc/self/status — “VmHWM:    12345 kB” — in bytes.
+	static func statusValue(_ name: String) -> Int64? {
+		guard let status = try? String(contentsOfFile: "/proc/self/status", encoding: .utf8) else {
+			return nil
+		}
+		let prefix = name + ":"
+		for line in status.split(separator: "\n") where line.hasPrefix(prefix) {
+			let fields = line.dropFirst(prefix.count).split { $0 == " " || $0 == "\t" }
+			guard let kilobytes = fields.first.flatMap({ Int64($0) }) else {
+				return nil
+			}
+			return kilobytes * 1024
+		}
+		return nil
+	}
+}
+#endif
+
+private extension timeval {
+
+	var seconds: Double {
+		Double(tv_sec) + Double(tv_usec) / 1_000_000
+	}
+}
@@ -0,0 +1,232 @@
+//
+//  SyntheticFeeds.swift
+//  RefreshBenchmark
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+
+/// The shape of a synthetic subscription list for the refresh benchmark.
+public struct SyntheticFeedsProfile: Sendable {
+
+	public enum Format: Sendable {
+		case rss
+		case atom
+	}
+
+	public enum Encoding: Sendable {
+		case utf8
+		case utf16
+		case isoLatin1
+		case shiftJIS
+
+		public var stringEncoding: String.Encoding {
+			switch self {
+			case .utf8:
+				return .utf8
+			case .utf16:
+				return .utf16LittleEndian
+			case .isoLatin1:
+				return .isoLatin1
+			case .shiftJIS:
+				return .shiftJIS
+			}
+		}
+
+		/// The name in the XML declaration. UTF-16 is announced by its BOM.
+		public var xmlName: String {
+			switch self {
+			case .utf8:
+				return "utf-8"
+			case .utf16:
+				return "utf-16"
+			case .isoLatin1:
+				return "iso-8859-1"
+			case .shiftJIS:
+				return "shift_jis"
+			}
+		}
+	}
+
+	public var feedCount = 100
+	public var itemsPerFeed = 25
+
+	/// Fraction of feeds that change from one round to the next.
+	/// The rest serve the same bytes, so they get 304s (with `FeedServer`’s
+	/// ETags) or hit the unchanged-content check.
+	public var changingFeedRate = 1.0
+
+	/// Fraction of a changing feed’s items replaced by new items each round.
+	public var churnRate = 0.2
+
+	/// Approximate length of each item’s HTML body, in characters.
+	public var bodyLength = 2_000
+
+	public var format = Format.rss
+	public var encoding = Encoding.utf8
+
+	public init() {
+	}
+}
+
+/// Deterministic feed documents for the refresh benchmark.
+///
+/// Each feed is a window over an endless list of items. Every round, a
+/// changing feed slides its window forward by `churnRate × itemsPerFeed`
+/// items: that many new items at the top, that many gone off the bottom.
+/// The same profile and round always produce the same bytes.
+public struct SyntheticFeeds: Sendable {
+
+	public let profile: SyntheticFeedsProfile
+
+	private let referenceDate: Date
+
+	public init(_ profile: SyntheticFeedsProfile, referenceDate: Date = Date()) {
+		self.profile = profile
+		self.referenceDate = referenceDate
+	}
+
+	public var feedIndices: Range<Int> {
+		0..<profile.feedCount
+	}
+
+	public func path(_ feedIndex: Int) -> String {
+		"/feeds/\(feedIndex).xml"
+	}
+
+	/// Every feed’s document for `round`, by path.
+	public func documents(round: Int) -> [String: Data] {
+		var documents = [String: Data](minimumCapacity: profile.feedCount)
+		for feedIndex in feedIndices {
+			documents[path(feedIndex)] = document(feedIndex, round: round)
+		}
+		return documents
+	}
+
+	public func document(_ feedIndex: Int, round: Int) -> Data {
+		let firstItemIndex = firstItemIndex(feedIndex, round: round)
+		let itemIndices = (firstItemIndex..<firstItemIndex + profile.itemsPerFeed).reversed()
+
+		var xml: String
+		switch profile.format {
+		case .rss:
+			xml = "<?xml version=\"1.0\" encoding=\"\(profile.encoding.xmlName)\"?>\n<rss version=\"2.0\"><channel><title>\(feedTitle(feedIndex))</title><link>https://example.com/\(feedIndex)/</link><description>Synthetic feed \(feedIndex)</description>\n"
+			for itemIndex in itemIndices {
+				xml += rssItem(feedIndex, itemIndex)
+			}
+			xml += "</channel></rss>\n"
+		case .atom:
+			xml = "<?xml version=\"1.0\" encoding=\"\(profile.encoding.xmlName)\"?>\n<feed xmlns=\"http://www.w3.org/2005/Atom\"><title>\(feedTitle(feedIndex))</title><link href=\"https://example.com/\(feedIndex)/\"/><id>https://example.com/\(feedIndex)/</id><updated>\(atomDate(itemIndices.first ?? 0))</updated>\n"
+			for itemIndex in itemIndices {
+				xml += atomEntry(feedIndex, itemIndex)
+			}
+			xml += "</feed>\n"
+		}
+
+		guard var data = xml.data(using: profile.encoding.stringEncoding, allowLossyConversion: true) else {
+			preconditionFailure("SyntheticFeeds: could not encode feed \(feedIndex) as \(profile.encoding)")
+		}
+		if profile.encoding == .utf16 {
+			data.insert(contentsOf: [0xFF, 0xFE], at: 0)
+		}
+		return data
+	}
+}
+
+private extension SyntheticFeeds {
+
+	/// Changing feeds are spread evenly through the list.
+	func isChanging(_ feedIndex: Int) -> Bool {
+		let changingFeedCount = Int((Double(profile.feedCount) * profile.changingFeedRate).rounded())
+		return (feedIndex * changingFeedCount) % profile.feedCount < changingFeedCount
+	}
+
+	func firstItemIndex(_ feedIndex: Int, round: Int) -> Int {
+		guard isChanging(feedIndex) else {
+			return 0
+		}
+		let itemsReplacedPerRound = Int((Double(profile.itemsPerFeed) * profile.churnRate).rounded())
+		return round * itemsReplacedPerRound
+	}
+
+	func feedTitle(_ feedIndex: Int) -> String {
+		"\(words(seed: feedIndex, count: 3)) \(feedIndex)"
+	}
+
+	func rssItem(_ feedIndex: Int, _ itemIndex: Int) -> String {
+		let link = "https://example.com/\(feedIndex)/\(itemIndex)"
+		return "<item><title>\(itemTitle(feedIndex, itemIndex))</title><link>\(link)</link><guid>\(link)</guid><pubDate>\(rssDate(itemIndex))</pubDate><description><![CDATA[\(body(feedIndex, itemIndex))]]></description></item>\n"
+	}
+
+	func atomEntry(_ feedIndex: Int, _ itemIndex: Int) -> String {
+		let link = "https://example.com/\(feedIndex)/\(itemIndex)"
+		return "<entry><title>\(itemTitle(feedIndex, itemIndex))</title><link href=\"\(link)\"/><id>\(link)</id><updated>\(atomDate(itemIndex))</updated><content type=\"html\"><![CDATA[\(body(feedIndex, itemIndex))]]></content></entry>\n"
+	}
+
+	func itemTitle(_ feedIndex: Int, _ itemIndex: Int) -> String {
+		words(seed: feedIndex &* 7919 &+ itemIndex, count: 6)
+	}
+
+	func body(_ feedIndex: Int, _ itemIndex: Int) -> String {
+		var body = ""
+		var paragraph = 0
+		while body.count < profile.bodyLength {
+			body += "<p>\(words(seed: feedIndex &* 104729 &+ itemIndex &* 31 &+ paragraph, count: 40))</p>\n"
+			paragraph += 1
+		}
+		return body
+	}
+
+	/// Ten minutes apart, starting a day before the reference date — recent
+	/// enough that new articles arrive unread.
+	func itemDate(_ itemIndex: Int) -> Date {
+		referenceDate.addingTimeInterval(-86_400 + TimeInterval(itemIndex) * 600)
+	}
+
+	func rssDate(_ itemIndex: Int) -> String {
+		Self.rssDateFormatter.string(from: itemDate(itemIndex))
+	}
+
+	func atomDate(_ itemIndex: Int) -> String {
+		Self.atomDateFormatter.string(from: itemDate(itemIndex))
+	}
+
+	static let rssDateFormatter: DateFormatter = {
+		let formatter = DateFormatter()
+		formatter.locale = Locale(identifier: "en_US_POSIX")
+		formatter.timeZone = TimeZone(secondsFromGMT: 0)
+		formatter.dateFormat = "EEE, dd MMM yyyy HH:mm:ss 'GMT'"
+		return formatter
+	}()
+
+	static let atomDateFormatter = ISO8601DateFormatter()
+
+	/// Words for text in the profile’s encoding — non-ASCII where it allows,
+	/// so that transcoding does real work.
+	var vocabulary: [String] {
+		switch profile.encoding {
+		case .utf8, .utf16:
+			return Self.englishWords + ["café", "naïve", "“quoted”", "résumé", "東京", "日本語", "🎉"]
+		case .isoLatin1:
+			return Self.englishWords + ["café", "naïve", "résumé", "façade", "über", "señor"]
+		case .shiftJIS:
+			return ["日本語", "東京", "天気", "記事", "ニュース", "今日", "フィード", "読む", "新しい", "世界"] + Self.englishWords.prefix(10)
+		}
+	}
+
+	static let englishWords = ["the", "story", "feed", "reader", "article", "update", "news", "today", "release", "version", "people", "write", "about", "database", "search", "refresh", "network", "parser", "swift", "apple", "weather", "city", "market", "report", "science", "music", "review", "launch", "river", "mountain"]
+
+	/// A deterministic run of words: a linear congruential generator seeded by `seed`.
+	func words(seed: Int, count: Int) -> String {
+		let vocabulary = vocabulary
+		var state = UInt64(truncatingIfNeeded: seed) &* 6364136223846793005 &+ 1442695040888963407
+		var words = [String]()
+		words.reserveCapacity(count)
+		for _ in 0..<count {
+			state = state &* 6364136223846793005 &+ 1442695040888963407
+			words.append(vocabulary[Int(state >> 33) % vocabulary.count])
+		}
+		return words.joined(separator: " ")
+	}
+}
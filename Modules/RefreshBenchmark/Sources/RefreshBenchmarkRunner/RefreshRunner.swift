@@ -0,0 +1,240 @@
+//
+//  RefreshRunner.swift
+//  RefreshBenchmarkRunner
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+#if canImport(FoundationNetworking)
+import FoundationNetworking
+#endif
+#if canImport(FoundationXML)
+import FoundationXML
+#endif
+#if canImport(os)
+import os
+#endif
+import RefreshBenchmark
+
+enum RefreshPhase: String, CaseIterable, Codable, CodingKeyRepresentable, Sendable {
+	case generate
+	case download
+	case parse
+}
+
+struct RefreshPhaseMeasurement: Codable, Sendable {
+	let wallMilliseconds: Double
+	/// Process CPU time, across all threads.
+	let cpuMilliseconds: Double
+	/// Nil where allocation counting isn’t supported.
+	let allocations: AllocationCount?
+}
+
+struct RefreshRunnerReport: Codable {
+
+	let scenario: String
+	let platform: String
+	let feedCount: Int
+	let itemsPerFeed: Int
+	let itemsParsed: Int
+	let peakFootprintGrowthBytes: Int64
+	let server: FeedServer.Counts
+	let phases: [RefreshPhase: RefreshPhaseMeasurement]
+
+	var description: String {
+		"""
+		Refresh benchmark — \(scenario) on \(platform): \(feedCount) feeds × \(itemsPerFeed) items, \(itemsParsed) items parsed
+		\tpeak footprint growth: \(ByteCountFormatter.string(fromByteCount: peakFootprintGrowthBytes, countStyle: .memory))
+		\tserver: \(server.requests) requests — \(server.ok) 200, \(server.notModified) 304, \(server.tooManyRequests) 429 — \(ByteCountFormatter.string(fromByteCount: Int64(server.bodyBytesSent), countStyle: .file))
+		""" + phasesDescription
+	}
+
+	private var phasesDescription: String {
+		RefreshPhase.allCases.compactMap { phase in
+			guard let measurement = phases[phase] else {
+				return nil
+			}
+			var line = "\n\t\(phase.rawValue): wall \(String(format: "%.1f", measurement.wallMilliseconds)) ms, CPU \(String(format: "%.1f", measurement.cpuMilliseconds)) ms"
+			if let allocations = measurement.allocations {
+				line += ", \(allocations.allocations) allocations (\(ByteCountFormatter.string(fromByteCount: Int64(allocations.allocatedBytes), countStyle: .memory)))"
+			}
+			return line
+		}.joined()
+	}
+}
+
+/// The parts of a refresh that don’t need the app’s modules, one after
+/// another so each can be measured alone: generating the feeds, downloading
+/// them with conditional GETs, and parsing what changed.
+///
+/// None of it is NetNewsWire code — the download is a bare URLSession and
+/// the parse is XMLParser counting items — so this measures the harness
+/// and Foundation, not the refresh pipeline. The Account module’s
+/// RefreshBenchmarkTests measure that, on Apple platforms only.
+///
+/// The server runs in this process, so the download phase’s CPU time and
+/// allocations include its side of each request. There’s no host-level
+/// 429 handling here — that’s `DownloadSession`’s, measured by the Account
+/// benchmark.
+@MainActor final class RefreshRunner {
+
+	private let scenario: RefreshBenchmarkScenario
+	private let syntheticFeeds: SyntheticFeeds
+	private let server: FeedServer
+	private let session: URLSession
+	/// ETags from the last 200 for each feed, sent back as If-None-Match.
+	private var etags = [URL: String]()
+	private var sampler = ResourceSampler()
+
+	#if canImport(os)
+	private static let signposter = OSSignposter(subsystem: "com.ranchero.NetNewsWire", category: .pointsOfInterest)
+	#endif
+
+	init(_ scenario: RefreshBenchmarkScenario) throws {
+		self.scenario = scenario
+		self.syntheticFeeds = SyntheticFeeds(scenario.feeds)
+		self.server = try FeedServer(profile: scenario.server)
+
+		let configuration = URLSessionConfiguration.ephemeral
+		configuration.requestCachePolicy = .reloadIgnoringLocalCacheData
+		configuration.urlCache = nil
+		self.session = URLSession(configuration: configuration)
+	}
+
+	/// Refreshes `warmUpRounds` times unmeasured, then once more, measured.
+	func run() async throws -> RefreshRunnerReport {
+		for round in 0..<scenario.warmUpRounds {
+			let documents = syntheticFeeds.documents(round: round)
+			server.setDocuments(documents)
+			_ = try parse(try await download())
+		}
+
+		server.resetCounts()
+		sampler = ResourceSampler()
+		var phases = [RefreshPhase: RefreshPhaseMeasurement]()
+
+		let documents = try await measure(.generate, into: &phases) {
+			syntheticFeeds.documents(round: scenario.warmUpRounds)
+		}
+		server.setDocuments(documents)
+		let downloads = try await measure(.download, into: &phases) {
+			try await download()
+		}
+		let itemsParsed = try await measure(.parse, into: &phases) {
+			try parse(downloads)
+		}
+		sampler.sample()
+
+		return RefreshRunnerReport(scenario: scenario.name, platform: Self.platform, feedCount: scenario.feeds.feedCount, itemsPerFeed: scenario.feeds.itemsPerFeed, itemsParsed: itemsParsed, peakFootprintGrowthBytes: sampler.peakFootprintGrowth, server: server.counts, phases: phases)
+	}
+}
+
+private extension RefreshRunner {
+
+	static var platform: String {
+		#if os(macOS)
+		"macOS"
+		#elseif os(Linux)
+		"Linux"
+		#else
+		"unknown"
+		#endif
+	}
+
+	func measure<T>(_ phase: RefreshPhase, into phases: inout [RefreshPhase: RefreshPhaseMeasurement], _ body: () async throws -> T) async throws -> T {
+		#if canImport(os)
+		let signpostState = Self.signposter.beginInterval("RefreshPhase", id: Self.signposter.makeSignpostID(), "\(phase.rawValue, privacy: .public)")
+		defer {
+			Self.signposter.endInterval("RefreshPhase", signpostState)
+		}
+		#endif
+
+		sampler.sample()
+		let cpuSecondsBefore = processCPUSeconds()
+		let clock = ContinuousClock()
+		let startTime = clock.now
+
+		let (result, allocations) = try await AllocationCounter.measure(body)
+
+		let elapsed = clock.now - startTime
+		let cpuSeconds = processCPUSeconds() - cpuSecondsBefore
+		sampler.sample()
+
+		phases[phase] = RefreshPhaseMeasurement(wallMilliseconds: elapsed.milliseconds, cpuMilliseconds: cpuSeconds * 1000, allocations: allocations)
+		return result
+	}
+
+	/// Every feed at once, as a refresh does. Returns the bodies of the 200s.
+	func download() async throws -> [Data] {
+		let requests = syntheticFeeds.feedIndices.map { feedIndex in
+			let url = server.url(syntheticFeeds.path(feedIndex), feedIndex: feedIndex)
+			var request = URLRequest(url: url)
+			if let etag = etags[url] {
+				request.setValue(etag, forHTTPHeaderField: "If-None-Match")
+			}
+			return request
+		}
+
+		let responses = try await withThrowingTaskGroup(of: DownloadResult.self) { taskGroup in
+			for request in requests {
+				taskGroup.addTask { [session] in
+					let (data, response) = try await session.data(for: request)
+					let httpResponse = response as! HTTPURLResponse
+					return DownloadResult(url: request.url!, data: data, statusCode: httpResponse.statusCode, etag: httpResponse.value(forHTTPHeaderField: "ETag"))
+				}
+			}
+			return try await taskGroup.reduce(into: []) { $0.append($1) }
+		}
+
+		var bodies = [Data]()
+		for response in responses where response.statusCode == 200 {
+			etags[response.url] = response.etag
+			bodies.append(response.data)
+		}
+		return bodies
+	}
+
+	/// Parses every body, returning the number of items and entries.
+	func parse(_ bodies: [Data]) throws -> Int {
+		var itemCount = 0
+		for body in bodies {
+			let parser = XMLParser(data: body)
+			let delegate = ItemCounter()
+			parser.delegate = delegate
+			guard parser.parse() else {
+				throw parser.parserError ?? CocoaError(.coderReadCorrupt)
+			}
+			itemCount += delegate.itemCount
+			sampler.sample()
+		}
+		return itemCount
+	}
+}
+
+private struct DownloadResult: Sendable {
+	let url: URL
+	let data: Data
+	let statusCode: Int
+	let etag: String?
+}
+
+/// Counts RSS items and Atom entries.
+private final class ItemCounter: NSObject, XMLParserDelegate {
+
+	private(set) var itemCount = 0
+
+	func parser(_ parser: XMLParser, didStartElement elementName: String, namespaceURI: String?, qualifiedName: String?, attributes: [String: String] = [:]) {
+		if elementName == "item" || elementName == "entry" {
+			itemCount += 1
+		}
+	}
+}
+
+private extension Duration {
+
+	var milliseconds: Double {
+		let (seconds, attoseconds) = components
+		return Double(seconds) * 1000 + Double(attoseconds) / 1e15
+	}
+}
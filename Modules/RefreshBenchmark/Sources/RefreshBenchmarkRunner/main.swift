@@ -0,0 +1,58 @@
+//
+//  main.swift
+//  RefreshBenchmarkRunner
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import RefreshBenchmark
+
+// refresh-benchmark [--report <path>] [--list] [scenario ...]
+//
+// Runs the named scenarios, or all of them, printing each report. With
+// --report, or REFRESH_BENCHMARK_REPORT_PATH, each is also appended to that
+// file as a line of JSON.
+
+var reportPath = RefreshBenchmarkReportFile.pathFromEnvironment
+var scenarios = [RefreshBenchmarkScenario]()
+
+var arguments = CommandLine.arguments.dropFirst()
+while let argument = arguments.popFirst() {
+	switch argument {
+	case "--report":
+		guard let path = arguments.popFirst() else {
+			print("--report needs a path")
+			exit(2)
+		}
+		reportPath = path
+	case "--list":
+		for scenario in RefreshBenchmarkScenario.all {
+			print(scenario.name)
+		}
+		exit(0)
+	default:
+		guard let scenario = RefreshBenchmarkScenario.named(argument) else {
+			print("Unknown scenario \(argument). Scenarios: \(RefreshBenchmarkScenario.all.map(\.name).joined(separator: ", "))")
+			exit(2)
+		}
+		scenarios.append(scenario)
+	}
+}
+
+if !AllocationCounter.isSupported {
+	print("Allocation counting isn’t supported on this platform.")
+}
+
+do {
+	for scenario in scenarios.isEmpty ? RefreshBenchmarkScenario.all : scenarios {
+		let report = try await RefreshRunner(scenario).run()
+		print(report.description)
+		if let reportPath {
+			try RefreshBenchmarkReportFile.append(report, to: reportPath)
+		}
+	}
+} catch {
+	print("Refresh benchmark failed: \(error)")
+	exit(1)
+}
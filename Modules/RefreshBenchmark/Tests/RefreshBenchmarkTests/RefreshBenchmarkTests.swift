@@ -0,0 +1,69 @@
+//
+//  RefreshBenchmarkTests.swift
+//  RefreshBenchmarkTests
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Testing
+import Foundation
+#if canImport(FoundationNetworking)
+import FoundationNetworking
+#endif
+@testable import RefreshBenchmark
+
+@Suite struct RefreshBenchmarkTests {
+
+	@Test func syntheticFeedsAreDeterministic() {
+		let referenceDate = Date(timeIntervalSinceReferenceDate: 0)
+		let first = SyntheticFeeds(SyntheticFeedsProfile(), referenceDate: referenceDate)
+		let second = SyntheticFeeds(SyntheticFeedsProfile(), referenceDate: referenceDate)
+
+		#expect(first.documents(round: 3) == second.documents(round: 3))
+		#expect(first.documents(round: 0) != first.documents(round: 1))
+	}
+
+	@Test func unchangingFeedsServeTheSameBytes() {
+		var profile = SyntheticFeedsProfile()
+		profile.changingFeedRate = 0
+		let feeds = SyntheticFeeds(profile)
+
+		#expect(feeds.documents(round: 0) == feeds.documents(round: 1))
+	}
+
+	@Test func feedServerAnswersMatchingETagWithNotModified() async throws {
+		let feeds = SyntheticFeeds(SyntheticFeedsProfile())
+		let server = try FeedServer(siteCount: 2)
+		server.setDocuments(feeds.documents(round: 0))
+		let url = server.url(feeds.path(1), feedIndex: 1)
+
+		let (data, response) = try await URLSession.shared.data(from: url)
+		let httpResponse = try #require(response as? HTTPURLResponse)
+		#expect(httpResponse.statusCode == 200)
+		#expect(data == feeds.document(1, round: 0))
+		let etag = try #require(httpResponse.value(forHTTPHeaderField: "ETag"))
+
+		var request = URLRequest(url: url, cachePolicy: .reloadIgnoringLocalCacheData)
+		request.setValue(etag, forHTTPHeaderField: "If-None-Match")
+		let (_, notModifiedResponse) = try await URLSession.shared.data(for: request)
+		#expect((notModifiedResponse as? HTTPURLResponse)?.statusCode == 304)
+
+		let counts = server.counts
+		#expect(counts.requests == 2)
+		#expect(counts.ok == 1)
+		#expect(counts.notModified == 1)
+		#expect(counts.bodyBytesSent == data.count)
+	}
+
+	@Test func allocationCounterCountsAllocations() async {
+		guard AllocationCounter.isSupported else {
+			return
+		}
+		let (arrays, count) = await AllocationCounter.measure {
+			(0..<100).map { [Int](repeating: $0, count: 64) }
+		}
+		#expect(arrays.count == 100)
+		#expect((count?.allocations ?? 0) >= 100)
+		#expect((count?.allocatedBytes ?? 0) >= 100 * 64 * MemoryLayout<Int>.size)
+	}
+}
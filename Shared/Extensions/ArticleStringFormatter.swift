@@ -120,6 +120,12 @@ import RSParser
 	}
 
 	func truncatedSummary(_ article: Article) -> String {
+		// Made at ingest — no HTML work here.
+		if let preview = article.preview {
+			return preview == "Comments" ? "" : preview // Hacker News.
+		}
+
+		// Articles stored before previews were.
 		guard let body = article.body else {
 			return ""
 		}
@@ -84,10 +84,6 @@ extension Article {
 		return contentHTML ?? contentText ?? summary
 	}
 
-	var logicalDatePublished: Date {
-		return datePublished ?? dateModified ?? status.dateArrived
-	}
-
 }
 
 @MainActor extension Article {
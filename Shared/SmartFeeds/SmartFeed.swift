@@ -10,6 +10,7 @@ import Foundation
 import RSCore
 import Articles
 import ArticlesDatabase
+import RSDatabase
 import Account
 import Images
 
@@ -40,6 +41,10 @@ import Images
 		return delegate.smallIcon
 	}
 
+	var fetchType: FetchType {
+		delegate.fetchType
+	}
+
 	#if os(macOS)
 	var pasteboardWriter: NSPasteboardWriting {
 		return SmartFeedPasteboardWriter(smartFeed: self)
@@ -48,10 +53,14 @@ import Images
 
 	private let delegate: SmartFeedDelegate
 	private var unreadCounts = [String: Int]()
+	private var accountsNeedingUnreadCounts = Set<Account>()
 
 	init(delegate: SmartFeedDelegate) {
 		self.delegate = delegate
-		NotificationCenter.default.addObserver(self, selector: #selector(unreadCountDidChange(_:)), name: .UnreadCountDidChange, object: nil)
+		NotificationCenter.default.addObserver(self, selector: #selector(unreadCountsDidChange(_:)), name: .UnreadCountsDidChange, object: nil)
+		NotificationCenter.default.addObserver(self, selector: #selector(accountsDidChange(_:)), name: .AccountStateDidChange, object: nil)
+		NotificationCenter.default.addObserver(self, selector: #selector(accountsDidChange(_:)), name: .UserDidAddAccount, object: nil)
+		NotificationCenter.default.addObserver(self, selector: #selector(accountsDidChange(_:)), name: .UserDidDeleteAccount, object: nil)
 		// Refetch on activation and on day change to prevent staleness.
 		// <https://github.com/Ranchero-Software/NetNewsWire/issues/3936>
 		NotificationCenter.default.addObserver(self, selector: #selector(handleAppDidBecomeActive(_:)), name: .appDidBecomeActive, object: nil)
@@ -59,10 +68,17 @@ import Images
 		queueFetchUnreadCounts() // Fetch unread count at startup
 	}
 
-	@objc func unreadCountDidChange(_ note: Notification) {
-		if note.object is AppDelegate {
-			queueFetchUnreadCounts()
+	@objc func unreadCountsDidChange(_ note: Notification) {
+		// Only the accounts whose unread counts changed need to be asked again.
+		guard let changeSet = note.userInfo?[UnreadCountChangeSet.userInfoKey] as? UnreadCountChangeSet, !changeSet.accounts.isEmpty else {
+			return
 		}
+		accountsNeedingUnreadCounts.formUnion(changeSet.accounts)
+		CoalescingQueue.standard.add(self, #selector(fetchChangedUnreadCounts))
+	}
+
+	@objc func accountsDidChange(_ note: Notification) {
+		queueFetchUnreadCounts()
 	}
 
 	@objc func handleAppDidBecomeActive(_ note: Notification) {
@@ -96,6 +112,14 @@ import Images
 		}
 	}
 
+	@objc func fetchChangedUnreadCounts() {
+		let accounts = accountsNeedingUnreadCounts
+		accountsNeedingUnreadCounts.removeAll()
+		for account in accounts where account.isActive {
+			fetchUnreadCount(account: account)
+		}
+	}
+
 }
 
 extension SmartFeed: ArticleFetcher {
@@ -115,6 +139,14 @@ extension SmartFeed: ArticleFetcher {
 	func fetchUnreadArticlesAsync() async -> Set<Article> {
 		await delegate.fetchUnreadArticlesAsync()
 	}
+
+	func fetchArticlesAsync(cancellationToken: DatabaseCancellationToken) async -> Set<Article> {
+		await delegate.fetchArticlesAsync(cancellationToken: cancellationToken)
+	}
+
+	func fetchUnreadArticlesAsync(cancellationToken: DatabaseCancellationToken) async -> Set<Article> {
+		await delegate.fetchUnreadArticlesAsync(cancellationToken: cancellationToken)
+	}
 }
 
 private extension SmartFeed {
@@ -10,6 +10,7 @@ import Foundation
 import Account
 import Articles
 import ArticlesDatabase
+import RSDatabase
 import RSCore
 
 @MainActor protocol SmartFeedDelegate: SidebarItemIdentifiable, DisplayNameProvider, ArticleFetcher, SmallIconProvider {
@@ -35,4 +36,13 @@ import RSCore
 		let articles = await fetchArticlesAsync()
 		return articles.unreadArticles()
 	}
+
+	func fetchArticlesAsync(cancellationToken: DatabaseCancellationToken) async -> Set<Article> {
+		await AccountManager.shared.fetchArticlesAsync(fetchType, cancellationToken: cancellationToken)
+	}
+
+	func fetchUnreadArticlesAsync(cancellationToken: DatabaseCancellationToken) async -> Set<Article> {
+		let articles = await fetchArticlesAsync(cancellationToken: cancellationToken)
+		return articles.unreadArticles()
+	}
 }
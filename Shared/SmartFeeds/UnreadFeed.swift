@@ -15,6 +15,7 @@ import RSCore
 import Account
 import Articles
 import ArticlesDatabase
+import RSDatabase
 import Images
 
 // This just shows the global unread count, which AccountManager already has. Easy.
@@ -82,4 +83,12 @@ import Images
 	func fetchUnreadArticlesAsync() async -> Set<Article> {
 		await AccountManager.shared.fetchArticlesAsync(fetchType)
 	}
+
+	func fetchArticlesAsync(cancellationToken: DatabaseCancellationToken) async -> Set<Article> {
+		await fetchUnreadArticlesAsync(cancellationToken: cancellationToken)
+	}
+
+	func fetchUnreadArticlesAsync(cancellationToken: DatabaseCancellationToken) async -> Set<Article> {
+		await AccountManager.shared.fetchArticlesAsync(fetchType, cancellationToken: cancellationToken)
+	}
 }
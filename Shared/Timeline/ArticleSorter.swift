@@ -40,15 +40,7 @@ private extension ArticleSorter {
 	}
 
 	static func sortedByDate(articles: [Article], sortDirection: ComparisonResult) -> [Article] {
-		articles.sorted { article1, article2 in
-			if article1.logicalDatePublished == article2.logicalDatePublished {
-				article1.articleID < article2.articleID
-			} else if sortDirection == .orderedDescending {
-				article1.logicalDatePublished > article2.logicalDatePublished
-			} else {
-				article1.logicalDatePublished < article2.logicalDatePublished
-			}
-		}
+		articles.sortedByLogicalDate(sortDirection)
 	}
 }
 
@@ -30,9 +30,16 @@ typealias FetchRequestOperationResultBlock = (Set<Article>, FetchRequestOperatio
 	let id: Int
 	let readFilterEnabledTable: [SidebarItemIdentifier: Bool]
 	let resultBlock: FetchRequestOperationResultBlock
-	var isCanceled = false
+	var isCanceled = false {
+		didSet {
+			if isCanceled {
+				cancellationToken.cancel()
+			}
+		}
+	}
 	var isFinished = false
 	private let fetchers: [ArticleFetcher]
+	private let cancellationToken = DatabaseCancellationToken()
 
 	init(id: Int, readFilterEnabledTable: [SidebarItemIdentifier: Bool], fetchers: [ArticleFetcher], resultBlock: @escaping FetchRequestOperationResultBlock) {
 		precondition(Thread.isMainThread)
@@ -46,6 +53,8 @@ typealias FetchRequestOperationResultBlock = (Set<Article>, FetchRequestOperatio
 		precondition(Thread.isMainThread)
 		precondition(!isFinished)
 
+		// Canceling the operation cancels the fetch that’s waiting in or running
+		// on the database queue, so a superseded request stops using the database.
 		Task { @MainActor in
 			var didCallCompletion = false
 
@@ -96,12 +105,15 @@ typealias FetchRequestOperationResultBlock = (Set<Article>, FetchRequestOperatio
 				let articles: Set<Article>
 
 				if (fetcher as? SidebarItem)?.readFiltered(readFilterEnabledTable: readFilterEnabledTable) ?? true {
-					articles = await fetcher.fetchUnreadArticlesAsync()
+					articles = await fetcher.fetchUnreadArticlesAsync(cancellationToken: cancellationToken)
 				} else {
-					articles = await fetcher.fetchArticlesAsync()
+					articles = await fetcher.fetchArticlesAsync(cancellationToken: cancellationToken)
 				}
 
 				process(articles)
+				if isCanceled {
+					break
+				}
 			}
 
 			// Belt-and-suspenders: ensure the queue never deadlocks even if
@@ -118,9 +130,16 @@ typealias FetchRequestOperationResultBlock = (Set<Article>, FetchRequestOperatio
 	let id: Int
 	let hidingReadArticlesState: HidingReadArticlesState
 	let resultBlock: FetchRequestOperationResultBlock
-	var isCanceled = false
+	var isCanceled = false {
+		didSet {
+			if isCanceled {
+				cancellationToken.cancel()
+			}
+		}
+	}
 	var isFinished = false
 	private let fetchers: [ArticleFetcher]
+	private let cancellationToken = DatabaseCancellationToken()
 
 	init(id: Int, hidingReadArticlesState: HidingReadArticlesState, fetchers: [ArticleFetcher], resultBlock: @escaping FetchRequestOperationResultBlock) {
 		precondition(Thread.isMainThread)
@@ -134,6 +153,8 @@ typealias FetchRequestOperationResultBlock = (Set<Article>, FetchRequestOperatio
 		precondition(Thread.isMainThread)
 		precondition(!isFinished)
 
+		// Canceling the operation cancels the fetch that’s waiting in or running
+		// on the database queue, so a superseded request stops using the database.
 		Task { @MainActor in
 			var didCallCompletion = false
 
@@ -190,11 +211,14 @@ typealias FetchRequestOperationResultBlock = (Set<Article>, FetchRequestOperatio
 			for fetcher in fetchers {
 				let articles: Set<Article>
 				if fetcherHidesReadArticles(fetcher) {
-					articles = await fetcher.fetchUnreadArticlesAsync()
+					articles = await fetcher.fetchUnreadArticlesAsync(cancellationToken: cancellationToken)
 				} else {
-					articles = await fetcher.fetchArticlesAsync()
+					articles = await fetcher.fetchArticlesAsync(cancellationToken: cancellationToken)
 				}
 				process(articles)
+				if isCanceled {
+					break
+				}
 			}
 
 			// Ensure the queue never deadlocks even if
@@ -0,0 +1,183 @@
+//
+//  TimelinePager.swift
+//  NetNewsWire
+//
+//  Created by Brent Simmons on 10/18/26.
+//
+
+import Foundation
+import Articles
+import ArticlesDatabase
+import Account
+
+/// Loads a timeline a page at a time, in timeline order, so the first rows
+/// can show before the rest of the articles have been fetched.
+///
+/// Each source is one account’s share of the timeline, read from that
+/// account’s database with keyset pagination. The sources are merged as
+/// their pages arrive — the first page doesn’t wait for everything else.
+@MainActor final class TimelinePager {
+
+	struct Source {
+		let account: Account
+		let fetchType: FetchType
+		let unreadOnly: Bool
+	}
+
+	let sortDirection: ComparisonResult
+	private(set) var isFinished = false
+	private let streams: [SourceStream]
+
+	init(sources: [Source], sortDirection: ComparisonResult) {
+		self.sortDirection = sortDirection
+		self.streams = sources.map { SourceStream(source: $0) }
+		self.isFinished = sources.isEmpty
+	}
+
+	/// Up to `limit` more articles. Blocks the main thread while sources that
+	/// have run dry fetch their next pages.
+	func nextPage(limit: Int) -> [Article] {
+		var page = [Article]()
+		while !isFinished && page.count < limit {
+			for stream in streams where stream.needsRefill {
+				stream.refill(limit: limit, sortDirection: sortDirection)
+			}
+			takeMergedArticles(into: &page, limit: limit)
+		}
+		return page
+	}
+
+	/// Up to `limit` more articles, with sources fetching concurrently.
+	func nextPageAsync(limit: Int) async -> [Article] {
+		var page = [Article]()
+		while !isFinished && page.count < limit {
+			let streamsToRefill = streams.filter(\.needsRefill)
+			let sortDirection = sortDirection
+			await withTaskGroup(of: Void.self, isolation: MainActor.shared) { group in
+				for stream in streamsToRefill {
+					group.addTask {
+						await stream.refillAsync(limit: limit, sortDirection: sortDirection)
+					}
+				}
+			}
+			takeMergedArticles(into: &page, limit: limit)
+		}
+		return page
+	}
+}
+
+extension TimelinePager {
+
+	/// Nil unless the timeline is a single feed, folder, or Unread, Today, or
+	/// Starred smart feed — search results and multiple selections aren’t paged.
+	convenience init?(fetcher: ArticleFetcher, unreadOnly: Bool, sortDirection: ComparisonResult) {
+		let sources: [Source]
+		switch fetcher {
+		case let feed as Feed:
+			guard let account = feed.account else {
+				return nil
+			}
+			sources = [Source(account: account, fetchType: .feed(feed), unreadOnly: unreadOnly)]
+		case let folder as Folder:
+			guard let account = folder.account else {
+				return nil
+			}
+			sources = [Source(account: account, fetchType: .folder(folder, false), unreadOnly: unreadOnly)]
+		case let unreadFeed as UnreadFeed:
+			sources = Self.activeAccountSources(unreadFeed.fetchType, unreadOnly: unreadOnly)
+		case let smartFeed as SmartFeed:
+			switch smartFeed.fetchType {
+			case .unread, .today, .starred:
+				sources = Self.activeAccountSources(smartFeed.fetchType, unreadOnly: unreadOnly)
+			default:
+				return nil
+			}
+		default:
+			return nil
+		}
+		self.init(sources: sources, sortDirection: sortDirection)
+	}
+}
+
+// MARK: - Private
+
+private extension TimelinePager {
+
+	static func activeAccountSources(_ fetchType: FetchType, unreadOnly: Bool) -> [Source] {
+		AccountManager.shared.activeAccounts.map { Source(account: $0, fetchType: fetchType, unreadOnly: unreadOnly) }
+	}
+
+	/// The k-way merge. Takes the earliest head among the sources until the
+	/// page is full, or until a source runs dry and has to fetch more — its
+	/// next article might come before every other head.
+	func takeMergedArticles(into page: inout [Article], limit: Int) {
+		while page.count < limit {
+			if streams.contains(where: \.needsRefill) {
+				return
+			}
+
+			var nextStream: SourceStream?
+			for stream in streams {
+				guard let head = stream.head else {
+					continue
+				}
+				if let nextHead = nextStream?.head, !head.precedesByDate(nextHead, sortDirection: sortDirection) {
+					continue
+				}
+				nextStream = stream
+			}
+
+			guard let nextStream else {
+				isFinished = true
+				return
+			}
+			page.append(nextStream.removeHead())
+		}
+	}
+}
+
+// MARK: - SourceStream
+
+@MainActor private final class SourceStream {
+
+	let source: TimelinePager.Source
+	private var articles = [Article]()
+	private var position = 0
+	private var cursor: ArticlesPageCursor?
+	private var isExhausted = false
+
+	init(source: TimelinePager.Source) {
+		self.source = source
+	}
+
+	var head: Article? {
+		position < articles.count ? articles[position] : nil
+	}
+
+	var needsRefill: Bool {
+		head == nil && !isExhausted
+	}
+
+	func removeHead() -> Article {
+		let article = articles[position]
+		position += 1
+		return article
+	}
+
+	func refill(limit: Int, sortDirection: ComparisonResult) {
+		let page = source.account.fetchArticlesPage(source.fetchType, unreadOnly: source.unreadOnly, sortDirection: sortDirection, after: cursor, limit: limit)
+		add(page)
+	}
+
+	func refillAsync(limit: Int, sortDirection: ComparisonResult) async {
+		let page = await source.account.fetchArticlesPageAsync(source.fetchType, unreadOnly: source.unreadOnly, sortDirection: sortDirection, after: cursor, limit: limit)
+		add(page)
+	}
+
+	private func add(_ page: ArticlesPage) {
+		articles = page.articles
+		position = 0
+		cursor = page.nextCursor
+		isExhausted = page.nextCursor == nil
+	}
+}
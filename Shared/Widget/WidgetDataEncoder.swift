@@ -128,14 +128,9 @@ import Account
 @MainActor private extension WidgetDataEncoder {
 
 	func fetchWidgetData() async -> WidgetData {
-		let fetchedUnreadArticles = await AccountManager.shared.fetchArticlesAsync(.unread(fetchLimit))
-		let unreadArticles = sortedLatestArticles(fetchedUnreadArticles)
-
-		let fetchedStarredArticles = await AccountManager.shared.fetchArticlesAsync(.starred(fetchLimit))
-		let starredArticles = sortedLatestArticles(fetchedStarredArticles)
-
-		let fetchedTodayArticles = await AccountManager.shared.fetchArticlesAsync(.today(fetchLimit))
-		let todayArticles = sortedLatestArticles(fetchedTodayArticles)
+		let unreadArticles = await AccountManager.shared.fetchArticlesSortedByDateAsync(.unread(fetchLimit)).map(createLatestArticle)
+		let starredArticles = await AccountManager.shared.fetchArticlesSortedByDateAsync(.starred(fetchLimit)).map(createLatestArticle)
+		let todayArticles = await AccountManager.shared.fetchArticlesSortedByDateAsync(.today(fetchLimit)).map(createLatestArticle)
 
 		let totalTodayCount = await AccountManager.shared.fetchCountForTodayArticlesAsync()
 		let totalTodayUnreadCount = await AccountManager.shared.fetchUnreadCountForTodayAsync()
@@ -227,9 +222,4 @@ import Account
 										  pubDate: pubDate)
 		return latestArticle
 	}
-
-	func sortedLatestArticles(_ fetchedArticles: Set<Article>) -> [LatestArticle] {
-		let latestArticles = fetchedArticles.map(createLatestArticle)
-		return latestArticles.sorted(by: { $0.pubDate > $1.pubDate })
-	}
 }
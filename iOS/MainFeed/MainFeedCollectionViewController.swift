@@ -172,6 +172,7 @@ final class MainFeedCollectionViewController: UICollectionViewController, Undoab
 
 	func registerForNotifications() {
 		NotificationCenter.default.addObserver(self, selector: #selector(unreadCountDidChange(_:)), name: .UnreadCountDidChange, object: nil)
+		NotificationCenter.default.addObserver(self, selector: #selector(unreadCountsDidChange(_:)), name: .UnreadCountsDidChange, object: nil)
 		NotificationCenter.default.addObserver(self, selector: #selector(faviconDidBecomeAvailable(_:)), name: .FaviconDidBecomeAvailable, object: nil)
 		// TODO: fix this temporary hack, which will probably require refactoring image handling.
 		// We want to know when to possibly reconfigure our cells with a new image, and we don’t
@@ -882,6 +883,25 @@ final class MainFeedCollectionViewController: UICollectionViewController, Undoab
 		reconfigureItems(nodesToReconfigure)
 	}
 
+	@objc func unreadCountsDidChange(_ note: Notification) {
+		// Feeds report unread count changes only in the change set — one
+		// reconfigure for all of them, instead of one per feed.
+		guard let changeSet = note.userInfo?[UnreadCountChangeSet.userInfoKey] as? UnreadCountChangeSet, !changeSet.feedDeltas.isEmpty else {
+			return
+		}
+		let feeds = changeSet.feeds
+		let nodesToReconfigure = dataSource.snapshot().itemIdentifiers.filter {
+			guard let feed = $0.node.representedObject as? Feed else {
+				return false
+			}
+			return feeds.contains(feed)
+		}
+		guard !nodesToReconfigure.isEmpty else {
+			return
+		}
+		reconfigureItems(nodesToReconfigure)
+	}
+
 	@objc func feedSettingDidChange(_ note: Notification) {
 		guard let feed = note.object as? Feed, let key = note.userInfo?[Feed.SettingUserInfoKey] as? Feed.SettingKey else {
 			return
@@ -662,6 +662,7 @@ private extension MainTimelineModernViewController {
 
 	func addNotificationObservers() {
 		NotificationCenter.default.addObserver(self, selector: #selector(unreadCountDidChange(_:)), name: .UnreadCountDidChange, object: nil)
+		NotificationCenter.default.addObserver(self, selector: #selector(unreadCountsDidChange(_:)), name: .UnreadCountsDidChange, object: nil)
 		NotificationCenter.default.addObserver(self, selector: #selector(statusesDidChange(_:)), name: .StatusesDidChange, object: nil)
 		NotificationCenter.default.addObserver(self, selector: #selector(feedIconDidBecomeAvailable(_:)), name: .feedIconDidBecomeAvailable, object: nil)
 		NotificationCenter.default.addObserver(self, selector: #selector(avatarDidBecomeAvailable(_:)), name: .AvatarDidBecomeAvailable, object: nil)
@@ -997,6 +998,9 @@ private extension MainTimelineModernViewController {
 		dataSource.apply(snapshot, animatingDifferences: animated) { [weak self] in
 			self?.restoreSelectionIfNecessary(adjustScroll: false)
 			completion?()
+			if !snapshot.itemIdentifiers.isEmpty {
+				AccountManager.shared.runDeferredStartupWork()
+			}
 		}
 	}
 
@@ -1009,6 +1013,18 @@ private extension MainTimelineModernViewController {
 		queueUpdateUI()
 	}
 
+	@objc func unreadCountsDidChange(_ note: Notification) {
+		// Feeds report unread count changes only in the change set.
+		guard let feed = timelineFeed as? Feed else {
+			return
+		}
+		guard let changeSet = note.userInfo?[UnreadCountChangeSet.userInfoKey] as? UnreadCountChangeSet, changeSet.feeds.contains(feed) else {
+			return
+		}
+		Self.logger.debug("MainTimelineModernViewController: unreadCountsDidChange")
+		queueUpdateUI()
+	}
+
 	@objc func statusesDidChange(_ note: Notification) {
 		Self.logger.debug("MainTimelineModernViewController: statusesDidChange")
 
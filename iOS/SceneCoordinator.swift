@@ -361,6 +361,7 @@ struct SidebarItemNode: Hashable, Sendable {
 
 		NotificationCenter.default.addObserver(self, selector: #selector(unreadCountDidInitialize(_:)), name: .UnreadCountDidInitialize, object: nil)
 		NotificationCenter.default.addObserver(self, selector: #selector(unreadCountDidChange(_:)), name: .UnreadCountDidChange, object: nil)
+		NotificationCenter.default.addObserver(self, selector: #selector(unreadCountsDidChange(_:)), name: .UnreadCountsDidChange, object: nil)
 		NotificationCenter.default.addObserver(self, selector: #selector(statusesDidChange(_:)), name: .StatusesDidChange, object: nil)
 		NotificationCenter.default.addObserver(self, selector: #selector(containerChildrenDidChange(_:)), name: .ChildrenDidChange, object: nil)
 		NotificationCenter.default.addObserver(self, selector: #selector(displayNameDidChange(_:)), name: .DisplayNameDidChange, object: nil)
@@ -537,6 +538,19 @@ struct SidebarItemNode: Hashable, Sendable {
 		queueRebuildBackingStores()
 	}
 
+	@objc func unreadCountsDidChange(_ note: Notification) {
+		// Feeds report unread count changes only in the change set. Their
+		// folders and accounts post UnreadCountDidChange only when their own
+		// totals change — which they may not, if the feeds’ changes cancel out.
+		guard AccountManager.shared.areUnreadCountsInitialized else {
+			return
+		}
+		guard let changeSet = note.userInfo?[UnreadCountChangeSet.userInfoKey] as? UnreadCountChangeSet, !changeSet.feedDeltas.isEmpty else {
+			return
+		}
+		queueRebuildBackingStores()
+	}
+
 	@objc func statusesDidChange(_ note: Notification) {
 		updateUnreadCount()
 	}
@@ -986,7 +1000,7 @@ struct SidebarItemNode: Hashable, Sendable {
 	}
 
 	func mainFeedIndexPathForCurrentTimeline() -> IndexPath? {
-		guard let node = treeController.rootNode.descendantNodeRepresentingObject(timelineFeed as AnyObject) else {
+		guard let node = treeController.nodeInTreeRepresentingObject(timelineFeed as AnyObject) else {
 			return nil
 		}
 		return indexPathFor(node)
@@ -1861,7 +1875,7 @@ private extension SceneCoordinator {
 	}
 
 	func addParentFolderToFilterExceptions(_ sidebarItem: SidebarItem) {
-		guard let node = treeController.rootNode.descendantNodeRepresentingObject(sidebarItem as AnyObject),
+		guard let node = treeController.nodeInTreeRepresentingObject(sidebarItem as AnyObject),
 			  let folder = node.parent?.representedObject as? Folder,
 			  let folderSidebarItemID = folder.sidebarItemID else {
 			return
@@ -1987,7 +2001,7 @@ private extension SceneCoordinator {
 	}
 
 	func indexPathFor(_ object: AnyObject) -> IndexPath? {
-		guard let node = treeController.rootNode.descendantNodeRepresentingObject(object) else {
+		guard let node = treeController.nodeInTreeRepresentingObject(object) else {
 			return nil
 		}
 		return indexPathFor(node)
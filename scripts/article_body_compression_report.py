@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+"""
+Report how much compressed body storage would save on a real articles
+database, and what it costs to read.
+
+Point it at a copy of an account's DB.sqlite3 (the database is opened
+read-only, but a copy avoids contending with a running app):
+
+    scripts/article_body_compression_report.py ~/Desktop/DB.sqlite3
+
+For the body columns (contentHTML, contentText, markdown, summary) it
+reports:
+
+- bytes stored as plain text today
+- bytes stored with compression as ArticlesDatabase does it: raw DEFLATE
+  at zlib level 5 (what Apple's Compression framework uses for `.zlib`),
+  only for bodies of at least 1024 UTF-8 bytes, and only when smaller
+- the same, with a preset dictionary trained on a sample of the bodies —
+  to show whether dictionary support would be worth adding
+- per-body compress and decompress latency (median, p95, max)
+
+Bodies already stored compressed are decompressed first, so the report
+works on databases written with `CompressArticleBodies` on or off.
+"""
+
+import argparse
+import sqlite3
+import statistics
+import sys
+import time
+import zlib
+from collections import Counter
+
+BODY_COLUMNS = ("contentHTML", "contentText", "markdown", "summary")
+MINIMUM_LENGTH = 1024
+ZLIB_LEVEL = 5
+RAW_DEFLATE = -15
+
+
+def compress(data, zdict=None):
+    if zdict:
+        compressor = zlib.compressobj(ZLIB_LEVEL, zlib.DEFLATED, RAW_DEFLATE, zdict=zdict)
+    else:
+        compressor = zlib.compressobj(ZLIB_LEVEL, zlib.DEFLATED, RAW_DEFLATE)
+    return compressor.compress(data) + compressor.flush()
+
+
+def decompress(data, zdict=None):
+    if zdict:
+        decompressor = zlib.decompressobj(RAW_DEFLATE, zdict=zdict)
+    else:
+        decompressor = zlib.decompressobj(RAW_DEFLATE)
+    return decompressor.decompress(data) + decompressor.flush()
+
+
+def read_bodies(path, limit):
+    connection = sqlite3.connect(f"file:{path}?mode=ro", uri=True)
+    page_size = connection.execute("pragma page_size;").fetchone()[0]
+    page_count = connection.execute("pragma page_count;").fetchone()[0]
+    columns = ", ".join(BODY_COLUMNS)
+    sql = f"select {columns} from articles"
+    if limit:
+        sql += f" limit {int(limit)}"
+    bodies = []
+    for row in connection.execute(sql + ";"):
+        for value in row:
+            if value is None:
+                continue
+            if isinstance(value, bytes):
+                bodies.append(decompress(value))
+            else:
+                bodies.append(value.encode("utf-8"))
+    connection.close()
+    return bodies, page_size * page_count
+
+
+def train_dictionary(bodies, size):
+    """Most frequent tag-sized chunks, most frequent last — DEFLATE reaches
+    the end of the dictionary with the shortest distances."""
+    counts = Counter()
+    for body in bodies[::max(1, len(bodies) // 2000)]:
+        for chunk in body.split(b">"):
+            if 4 <= len(chunk) <= 64:
+                counts[chunk + b">"] += 1
+    dictionary = b""
+    for chunk, _ in counts.most_common():
+        if len(dictionary) + len(chunk) > size:
+            break
+        dictionary = chunk + dictionary
+    return dictionary
+
+
+def stored_size(body, zdict, compress_times, decompress_times):
+    if len(body) < MINIMUM_LENGTH:
+        return len(body)
+    start = time.perf_counter()
+    compressed = compress(body, zdict)
+    compress_times.append(time.perf_counter() - start)
+    if len(compressed) >= len(body):
+        return len(body)
+    start = time.perf_counter()
+    decompress(compressed, zdict)
+    decompress_times.append(time.perf_counter() - start)
+    return len(compressed)
+
+
+def latency_line(name, times):
+    if not times:
+        return f"  {name}: no bodies compressed"
+    milliseconds = sorted(t * 1000 for t in times)
+    p95 = milliseconds[int(len(milliseconds) * 0.95) - 1] if len(milliseconds) >= 20 else milliseconds[-1]
+    return f"  {name}: median {statistics.median(milliseconds):.3f} ms, p95 {p95:.3f} ms, max {milliseconds[-1]:.3f} ms ({len(milliseconds)} bodies)"
+
+
+def megabytes(count):
+    return f"{count / (1024 * 1024):.1f} MB"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("database", help="path to a copy of DB.sqlite3")
+    parser.add_argument("--limit", type=int, default=0, help="only read this many articles")
+    parser.add_argument("--dictionary-size", type=int, default=32 * 1024, help="trained dictionary size in bytes (DEFLATE uses at most 32 KB)")
+    arguments = parser.parse_args()
+
+    bodies, file_size = read_bodies(arguments.database, arguments.limit)
+    if not bodies:
+        print("No article bodies found.")
+        return 1
+
+    raw_size = sum(len(body) for body in bodies)
+    compress_times, decompress_times = [], []
+    compressed_size = sum(stored_size(body, None, compress_times, decompress_times) for body in bodies)
+
+    zdict = train_dictionary(bodies, min(arguments.dictionary_size, 32 * 1024))
+    dictionary_compress_times, dictionary_decompress_times = [], []
+    dictionary_size = sum(stored_size(body, zdict, dictionary_compress_times, dictionary_decompress_times) for body in bodies)
+
+    print(f"Database file: {megabytes(file_size)}")
+    print(f"Bodies: {len(bodies)} ({sum(1 for body in bodies if len(body) >= MINIMUM_LENGTH)} at least {MINIMUM_LENGTH} bytes)")
+    print(f"  plain text:                {megabytes(raw_size)}")
+    print(f"  compressed:                {megabytes(compressed_size)} ({100 * compressed_size / raw_size:.1f}%)")
+    print(f"  compressed, {len(zdict) // 1024} KB dictionary: {megabytes(dictionary_size)} ({100 * dictionary_size / raw_size:.1f}%)")
+    print("Latency, compressed:")
+    print(latency_line("compress", compress_times))
+    print(latency_line("decompress", decompress_times))
+    print("Latency, compressed with dictionary:")
+    print(latency_line("compress", dictionary_compress_times))
+    print(latency_line("decompress", dictionary_decompress_times))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())